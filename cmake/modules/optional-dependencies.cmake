@@ -60,6 +60,94 @@ If ( SCOTCH_FOUND AND NOT USE_SCOTCH MATCHES OFF)
   SET( LIBRARIES ${SCOTCH_LIBRARIES} ${LIBRARIES})
 ENDIF()
 
+############################################################################
+#####
+#####         PT-Scotch
+#####
+############################################################################
+# add PT-Scotch library (graph partitioner)?
+SET ( USE_PTSCOTCH "" CACHE STRING "Use PT-SCOTCH as graph partitioner (ON, OFF or <empty>)" )
+SET_PROPERTY(CACHE USE_PTSCOTCH PROPERTY STRINGS "ON" "OFF" "")
+
+IF ( NOT DEFINED USE_PTSCOTCH OR USE_PTSCOTCH STREQUAL "" OR USE_PTSCOTCH MATCHES " +" OR USE_PTSCOTCH )
+  # Variable is not provided by the user or is setted to on
+  FIND_PATH(PTSCOTCH_INCLUDE_DIR
+    NAMES ptscotch.h
+    HINTS ${SCOTCH_DIR} $ENV{SCOTCH_DIR}
+    PATH_SUFFIXES include include/scotch)
+  FIND_LIBRARY(PTSCOTCH_LIBRARY
+    NAMES ptscotch
+    HINTS ${SCOTCH_DIR} $ENV{SCOTCH_DIR}
+    PATH_SUFFIXES lib lib32 lib64)
+  FIND_LIBRARY(PTSCOTCHERR_LIBRARY
+    NAMES ptscotcherr
+    HINTS ${SCOTCH_DIR} $ENV{SCOTCH_DIR}
+    PATH_SUFFIXES lib lib32 lib64)
+  FIND_LIBRARY(PTSCOTCH_SCOTCH_LIBRARY
+    NAMES scotch
+    HINTS ${SCOTCH_DIR} $ENV{SCOTCH_DIR}
+    PATH_SUFFIXES lib lib32 lib64)
+
+  IF ( PTSCOTCH_INCLUDE_DIR AND PTSCOTCH_LIBRARY AND PTSCOTCHERR_LIBRARY
+      AND PTSCOTCH_SCOTCH_LIBRARY )
+    SET ( PTSCOTCH_FOUND TRUE )
+    SET ( PTSCOTCH_LIBRARIES ${PTSCOTCH_LIBRARY} ${PTSCOTCH_SCOTCH_LIBRARY}
+      ${PTSCOTCHERR_LIBRARY} )
+  ELSEIF ( USE_PTSCOTCH )
+    # USE_PTSCOTCH is not empty so user explicitely ask for PT-Scotch...
+    # but it is not found: raise an error
+    MESSAGE ( FATAL_ERROR "PT-Scotch library not found: "
+      "If you have already installed PT-Scotch and want to use it, "
+      "please set the CMake variable or environment variable SCOTCH_DIR "
+      "to your scotch directory.")
+  ENDIF ( )
+  MARK_AS_ADVANCED(PTSCOTCH_INCLUDE_DIR PTSCOTCH_LIBRARY PTSCOTCHERR_LIBRARY
+    PTSCOTCH_SCOTCH_LIBRARY)
+ENDIF ( )
+
+IF ( PTSCOTCH_FOUND AND NOT USE_PTSCOTCH MATCHES OFF )
+  add_definitions(-DUSE_PTSCOTCH)
+  INCLUDE_DIRECTORIES(${PTSCOTCH_INCLUDE_DIR})
+
+  MESSAGE(STATUS
+    "Compilation with PT-Scotch: ${PTSCOTCH_LIBRARIES}")
+  SET( LIBRARIES ${PTSCOTCH_LIBRARIES} ${LIBRARIES})
+ENDIF()
+
+############################################################################
+#####
+#####         Zlib (compression of the large messages)
+#####
+############################################################################
+# add Zlib library?
+SET ( USE_ZLIB "" CACHE STRING "Use Zlib to compress the large messages (ON, OFF or <empty>)" )
+SET_PROPERTY(CACHE USE_ZLIB PROPERTY STRINGS "ON" "OFF" "")
+
+IF ( NOT DEFINED USE_ZLIB OR USE_ZLIB STREQUAL "" OR USE_ZLIB MATCHES " +" )
+  # Variable is not provided by user
+  FIND_PACKAGE(ZLIB QUIET)
+
+ELSE ()
+  IF ( USE_ZLIB )
+    # User wants to use zlib
+    FIND_PACKAGE(ZLIB)
+    IF ( NOT ZLIB_FOUND )
+      MESSAGE ( FATAL_ERROR "Zlib library not found: "
+        "please set the CMake variable ZLIB_ROOT to your zlib directory or "
+        "set USE_ZLIB to OFF to disable the compression of the messages.")
+    ENDIF ( )
+  ENDIF ( )
+
+ENDIF ( )
+
+IF ( ZLIB_FOUND AND NOT USE_ZLIB MATCHES OFF )
+  add_definitions(-DUSE_ZLIB)
+  INCLUDE_DIRECTORIES(${ZLIB_INCLUDE_DIRS})
+
+  MESSAGE(STATUS
+    "Compilation with zlib: ${ZLIB_LIBRARIES}")
+  SET( LIBRARIES ${ZLIB_LIBRARIES} ${LIBRARIES})
+ENDIF()
 
 ############################################################################
 #####
@@ -0,0 +1,79 @@
+## =============================================================================
+##  This file is part of the parmmg software package for parallel tetrahedral
+##  mesh modification.
+##  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+##
+##  parmmg is free software: you can redistribute it and/or modify it
+##  under the terms of the GNU Lesser General Public License as published
+##  by the Free Software Foundation, either version 3 of the License, or
+##  (at your option) any later version.
+##
+##  parmmg is distributed in the hope that it will be useful, but WITHOUT
+##  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+##  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+##  License for more details.
+##
+##  You should have received a copy of the GNU Lesser General Public
+##  License and of the GNU General Public License along with parmmg (in
+##  files COPYING.LESSER and COPYING). If not, see
+##  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+##  use this copy of the parmmg distribution only if you accept them.
+## =============================================================================
+
+###############################################################################
+#####
+#####   Compare two ASCII Medit meshes: usage
+#####   cmake -DMESH_A=<file> -DMESH_B=<file> -P compare_medit.cmake
+#####
+#####   The meshes must have the same number of vertices, triangles, tetrahedra
+#####   and corners, and the same set of vertices (the numbering may differ).
+#####
+###############################################################################
+
+# Keep the empty lines of the files in the lists
+CMAKE_POLICY ( SET CMP0007 NEW )
+
+IF ( NOT MESH_A OR NOT MESH_B )
+  MESSAGE ( FATAL_ERROR "Usage: cmake -DMESH_A=<file> -DMESH_B=<file> -P ${CMAKE_CURRENT_LIST_FILE}" )
+ENDIF ( )
+
+FOREACH ( mesh A B )
+  IF ( NOT EXISTS "${MESH_${mesh}}" )
+    MESSAGE ( FATAL_ERROR "File ${MESH_${mesh}} not found." )
+  ENDIF ( )
+
+  FILE ( STRINGS "${MESH_${mesh}}" lines_${mesh} )
+
+  FOREACH ( kw Vertices Triangles Tetrahedra Corners )
+    LIST ( FIND lines_${mesh} "${kw}" idx )
+    IF ( idx EQUAL -1 )
+      SET ( count_${mesh}_${kw} 0 )
+    ELSE ( )
+      MATH ( EXPR idx "${idx}+1" )
+      LIST ( GET lines_${mesh} ${idx} count )
+      STRING ( STRIP "${count}" count_${mesh}_${kw} )
+    ENDIF ( )
+
+    IF ( kw STREQUAL "Vertices" AND NOT idx EQUAL -1 )
+      # Vertex lines, with normalized spaces and sorted to ignore the numbering
+      MATH ( EXPR idx "${idx}+1" )
+      LIST ( SUBLIST lines_${mesh} ${idx} ${count_${mesh}_${kw}} vertices_${mesh} )
+      LIST ( TRANSFORM vertices_${mesh} REPLACE "[ \t]+" " " )
+      LIST ( TRANSFORM vertices_${mesh} STRIP )
+      LIST ( SORT vertices_${mesh} )
+    ENDIF ( )
+  ENDFOREACH ( )
+ENDFOREACH ( )
+
+FOREACH ( kw Vertices Triangles Tetrahedra Corners )
+  IF ( NOT count_A_${kw} EQUAL count_B_${kw} )
+    MESSAGE ( FATAL_ERROR "${kw}: ${count_A_${kw}} in ${MESH_A} but ${count_B_${kw}} in ${MESH_B}." )
+  ENDIF ( )
+ENDFOREACH ( )
+
+IF ( NOT "${vertices_A}" STREQUAL "${vertices_B}" )
+  MESSAGE ( FATAL_ERROR "The vertices of ${MESH_A} and ${MESH_B} differ." )
+ENDIF ( )
+
+MESSAGE ( STATUS "Meshes match: ${count_A_Vertices} vertices, "
+  "${count_A_Triangles} triangles, ${count_A_Tetrahedra} tetrahedra." )
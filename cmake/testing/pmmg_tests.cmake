@@ -319,6 +319,41 @@ IF( BUILD_TESTING )
       -in ${CI_DIR}/Parallel_IO/hdf5/4p/cube-unit-coarse.h5 -v 5 -centralized-output
       -out ${CI_DIR_RESULTS}/hdf5-DisIn-MeshOnly-8.o.mesh)
 
+    ## hdf5 checkpoint written after each iteration then restart from the first one
+    add_test( NAME hdf5-Checkpoint-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -v 5 -niter 3 -checkpoint 1
+      -out ${CI_DIR_RESULTS}/hdf5-Checkpoint-4.o.h5)
+    set_property(TEST hdf5-Checkpoint-4
+      PROPERTY PASS_REGULAR_EXPRESSION "checkpoint written in")
+
+    add_test( NAME hdf5-Restart-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR_RESULTS}/hdf5-Checkpoint-4.o.chk1.h5 -restart
+      -v 5 -niter 3
+      -out ${CI_DIR_RESULTS}/hdf5-Restart-4.o.h5)
+    set_tests_properties(hdf5-Restart-4 PROPERTIES DEPENDS hdf5-Checkpoint-4 )
+    set_property(TEST hdf5-Restart-4
+      PROPERTY PASS_REGULAR_EXPRESSION "RESTART FROM ITERATION 2")
+
+    ## hdf5 output with chunked datasets, compressed metric and fields and MPI-IO hints
+    add_test( NAME hdf5-ChunkDeflate-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Interpolation/coarse.meshb
+      -field ${CI_DIR}/Interpolation/sol-fields-coarse.sol
+      -v 5 -niter 2 -h5-chunk 4096 -h5-deflate -mpiio-cb-write 1 -mpiio-cb-nodes 2
+      -out ${CI_DIR_RESULTS}/hdf5-ChunkDeflate-4.o.h5)
+
+    ## read back the compressed and chunked datasets (mesh, metric and fields)
+    add_test( NAME hdf5-ChunkDeflate-reload-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR_RESULTS}/hdf5-ChunkDeflate-4.o.h5
+      -v 5 -niter 1
+      -out ${CI_DIR_RESULTS}/hdf5-ChunkDeflate-reload-4.o.h5)
+    set_tests_properties(hdf5-ChunkDeflate-reload-4 PROPERTIES DEPENDS hdf5-ChunkDeflate-4 )
+
 
     IF ( (NOT HDF5_FOUND) OR USE_HDF5 MATCHES OFF )
       SET(expr "HDF5 library not found")
@@ -327,6 +362,8 @@ IF( BUILD_TESTING )
         Medit-DisIn-MeshOnly-6 hdf5-DisIn-MeshOnly-2 hdf5-DisIn-MeshAndMet-2
         hdf5-DisIn-MeshAndMet-8  hdf5-DisIn-MeshOnly-8
         hdf5-DisIn-MeshAndMet-4  hdf5-DisIn-MeshOnly-4
+        hdf5-Checkpoint-4 hdf5-Restart-4 hdf5-ChunkDeflate-4
+        hdf5-ChunkDeflate-reload-4
         PROPERTY PASS_REGULAR_EXPRESSION "${expr}")
     ENDIF ( )
 
@@ -1165,6 +1202,218 @@ IF( BUILD_TESTING )
       ${CI_DIR}/HausdLoc_2Spheres/centralized/2spheres.mesh -v 5 -centralized-output
       -out ${CI_DIR_RESULTS}/locParam-Run-DisIn-CenOut-2.o.mesh)
 
+    ###############################################################################
+    #####
+    #####        Tests performance options
+    #####
+    ###############################################################################
+    #-- Threaded remeshing of the groups (sequential if built without OpenMP)
+    foreach( NP 1 2 )
+      add_test( NAME nthreads-cube-unit-coarse-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.meshb
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+        -out ${CI_DIR_RESULTS}/nthreads-cube-unit-coarse-${NP}-out.mesh
+        -nthreads 4 -mesh-size ${mesh_size} ${myargs} )
+    endforeach()
+
+    #-- Localization trees as fallback of the interpolation walk
+    foreach( NP 1 4 )
+      add_test( NAME loctree-TennisSurf_interp-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Tennis/tennis.meshb
+        -sol ${CI_DIR}/Tennis/tennis.sol
+        -out ${CI_DIR_RESULTS}/loctree-TennisSurf_interp-${NP}-out.mesh
+        -loctree -niter 3 -v 10 )
+    endforeach()
+
+    #-- Batched localization along a Hilbert curve
+    foreach( NP 1 4 )
+      add_test( NAME locbatch-TennisSurf_interp-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Tennis/tennis.meshb
+        -sol ${CI_DIR}/Tennis/tennis.sol
+        -out ${CI_DIR_RESULTS}/locbatch-TennisSurf_interp-${NP}-out.mesh
+        -locbatch -niter 3 -v 10 )
+    endforeach()
+
+    #-- Threaded interpolation of the metrics and fields of batched points
+    add_test( NAME locbatch-nthreads-InterpolationFields-withMet-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Interpolation/coarse.meshb
+      -out ${CI_DIR_RESULTS}/locbatch-nthreads-InterpolationFields-withMet-4-out.mesh
+      -field ${CI_DIR}/Interpolation/sol-fields-coarse.sol
+      -sol ${CI_DIR}/Interpolation/field3_iso-coarse.sol
+      -locbatch -nthreads 4 -mesh-size 60000 ${myargs} )
+
+    #-- Partition weights from the predicted remeshing cost
+    foreach( NP 2 4 )
+      add_test( NAME cost-weights-cube-unit-coarse-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.meshb
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+        -out ${CI_DIR_RESULTS}/cost-weights-cube-unit-coarse-${NP}-out.mesh
+        -cost-weights -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+      set_property(TEST cost-weights-cube-unit-coarse-${NP}
+        PROPERTY PASS_REGULAR_EXPRESSION "partition weights +predicted remeshing cost")
+    endforeach()
+
+    #-- Per-phase performance trace
+    add_test( NAME trace-jsonl-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/trace-jsonl-cube-unit-coarse-4-out.mesh
+      -trace jsonl -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+    set_property(TEST trace-jsonl-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "[1-9][0-9]* trace events of 4 processes written")
+
+    add_test( NAME trace-chrome-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/trace-chrome-cube-unit-coarse-4-out.mesh
+      -trace chrome -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+    set_property(TEST trace-chrome-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "trace-chrome-cube-unit-coarse-4-out.trace.json OPENED")
+
+    #-- Tuning of the mesh size from the measured remeshing throughput
+    add_test( NAME tune-mesh-size-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/tune-mesh-size-cube-unit-coarse-4-out.mesh
+      -tune-mesh-size -v 5 ${myargs} -niter 3 ) #override previous value of -niter
+    set_property(TEST tune-mesh-size-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "mesh size tuning: mean group size")
+
+    #-- Skip the groups that already conform to the metric
+    add_test( NAME freeze-groups-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -field ${CI_DIR}/Interpolation/cube-unit-coarse-field.sol
+      -out ${CI_DIR_RESULTS}/freeze-groups-cube-unit-coarse-4-out.mesh
+      -freeze-groups -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+    set_property(TEST freeze-groups-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "[0-9]+/[0-9]+ groups already conform to the metric")
+
+    #-- Convergence-driven number of iterations (loose targets: stop after the
+    #   first iteration)
+    add_test( NAME converge-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/converge-cube-unit-coarse-4-out.mesh
+      -converge-length 1 -converge-quality 0 -v 5
+      -mesh-size ${mesh_size} ${myargs} -niter 5 ) #override previous value of -niter
+    set_property(TEST converge-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "adaptation converged after 1 iterations")
+
+    #-- PT-Scotch graph partitioner
+    IF ( PTSCOTCH_FOUND AND NOT USE_PTSCOTCH MATCHES OFF )
+      add_test( NAME partitioner-ptscotch-cube-unit-coarse-4
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.meshb
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+        -out ${CI_DIR_RESULTS}/partitioner-ptscotch-cube-unit-coarse-4-out.mesh
+        -partitioner ptscotch -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+      set_property(TEST partitioner-ptscotch-cube-unit-coarse-4
+        PROPERTY PASS_REGULAR_EXPRESSION "partitioner +ptscotch")
+    ENDIF()
+
+    #-- Geometric partitioner (Hilbert curve), final graph balancing included
+    add_test( NAME partitioner-sfc-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/partitioner-sfc-cube-unit-coarse-4-out.mesh
+      -partitioner sfc -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+    set_property(TEST partitioner-sfc-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "partitioner +sfc")
+
+    #-- Migration-minimizing relabeling of the parts
+    add_test( NAME repart-itr-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/repart-itr-cube-unit-coarse-4-out.mesh
+      -repart-itr 1000 -v 5 -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+    set_property(TEST repart-itr-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "groups migration")
+
+    #-- Node-aware mapping of the parts (2 fake nodes of 2 processes)
+    add_test( NAME hierarchical-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/hierarchical-cube-unit-coarse-4-out.mesh
+      -hierarchical 2 -v 5 -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+    set_property(TEST hierarchical-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "inter-node cut")
+
+    #-- Compression of all the migration and gather messages
+    IF ( ZLIB_FOUND AND NOT USE_ZLIB MATCHES OFF )
+      add_test( NAME compress-cube-unit-coarse-4
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.meshb
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+        -out ${CI_DIR_RESULTS}/compress-cube-unit-coarse-4-out.mesh
+        -compress 0 -mesh-size ${mesh_size} ${myargs} -niter 3 ) #override previous value of -niter
+      set_property(TEST compress-cube-unit-coarse-4
+        PROPERTY PASS_REGULAR_EXPRESSION "compressed messages +[0-9.e+-]+ MB -> [0-9.e+-]+ MB")
+    ENDIF()
+
+    #-- Centralized output written in parallel (ASCII and binary Medit)
+    add_test( NAME mpiio-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/mpiio-cube-unit-coarse-4-out.mesh
+      -mpiio-output -mesh-size ${mesh_size} ${myargs} )
+
+    add_test( NAME mpiio-cube-unit-coarse-bin-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-dual_density.sol
+      -out ${CI_DIR_RESULTS}/mpiio-cube-unit-coarse-bin-4-out.meshb
+      -mpiio-output -mesh-size ${mesh_size} ${myargs} )
+
+    # parallel read of the binary output of the previous test
+    add_test( NAME mpiio-input-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR_RESULTS}/mpiio-cube-unit-coarse-bin-4-out.meshb
+      -out ${CI_DIR_RESULTS}/mpiio-input-cube-unit-coarse-4-out.mesh
+      -mpiio-input -mesh-size ${mesh_size} ${myargs} )
+    set_tests_properties(mpiio-input-cube-unit-coarse-4
+      PROPERTIES DEPENDS mpiio-cube-unit-coarse-bin-4 )
+    set_property(TEST mpiio-input-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "\\(PARALLEL READ\\)")
+
+    # the parallel writer must give the same mesh as the centralized one (no
+    # remeshing to have the same vertices)
+    add_test( NAME mpiio-noiter-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -out ${CI_DIR_RESULTS}/mpiio-noiter-cube-unit-coarse-4-out.mesh
+      -mpiio-output -mesh-size ${mesh_size} ${myargs} -niter 0 ) #override previous value of -niter
+    set_property(TEST mpiio-noiter-cube-unit-coarse-4
+      PROPERTY PASS_REGULAR_EXPRESSION "\\(PARALLEL WRITE\\)")
+
+    add_test( NAME merged-noiter-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.meshb
+      -out ${CI_DIR_RESULTS}/merged-noiter-cube-unit-coarse-4-out.mesh
+      -mesh-size ${mesh_size} ${myargs} -niter 0 ) #override previous value of -niter
+
+    add_test( NAME mpiio-compare-cube-unit-coarse-4
+      COMMAND ${CMAKE_COMMAND}
+      -DMESH_A=${CI_DIR_RESULTS}/mpiio-noiter-cube-unit-coarse-4-out.mesh
+      -DMESH_B=${CI_DIR_RESULTS}/merged-noiter-cube-unit-coarse-4-out.mesh
+      -P ${PROJECT_SOURCE_DIR}/cmake/testing/compare_medit.cmake )
+    set_tests_properties(mpiio-compare-cube-unit-coarse-4
+      PROPERTIES DEPENDS "mpiio-noiter-cube-unit-coarse-4;merged-noiter-cube-unit-coarse-4" )
+
   ENDIF()
 
   ###############################################################################
@@ -489,6 +489,30 @@ void PMMG_Init_parameters(PMMG_pParMesh parmesh,MPI_Comm comm) {
   parmesh->info.loadbalancing_mode = PMMG_LOADBALANCING_metis;
   parmesh->info.contiguous_mode    = PMMG_CONTIG_DEF;
   parmesh->info.target_mesh_size   = PMMG_REMESHER_TARGET_MESH_SIZE;
+  parmesh->info.nthreads           = PMMG_NTHREADS;
+  parmesh->info.locateTree         = MMG5_OFF;
+  parmesh->info.locateBatch        = MMG5_OFF;
+  parmesh->info.costWeights        = MMG5_OFF;
+  parmesh->info.trace              = PMMG_TRACE_none;
+  parmesh->info.tuneGrpSize        = MMG5_OFF;
+  parmesh->info.freezeGrps         = MMG5_OFF;
+  parmesh->info.convergence        = MMG5_OFF;
+  parmesh->info.conv_length        = PMMG_CONV_LENGTH;
+  parmesh->info.conv_quality       = PMMG_CONV_QUALITY;
+  parmesh->info.repartItr          = 0.;
+  parmesh->info.hierarchical       = MMG5_OFF;
+  parmesh->info.compressSize       = -1;
+  parmesh->info.mpiioOutput        = MMG5_OFF;
+  parmesh->info.mpiioInput         = MMG5_OFF;
+  parmesh->info.checkpoint         = 0;
+  parmesh->info.restart            = MMG5_OFF;
+  parmesh->info.iterStart          = 0;
+  parmesh->info.h5Chunk            = 0;
+  parmesh->info.h5Deflate          = 0;
+  parmesh->info.mpiioCbNodes       = 0;
+  parmesh->info.mpiioCbWrite       = -1;
+  parmesh->info.mpiioStripeCount   = 0;
+  parmesh->info.mpiioStripeSize    = 0;
   parmesh->info.metis_ratio        = PMMG_RATIO_MMG_METIS;
   parmesh->info.API_mode           = PMMG_APIDISTRIB_faces;
   parmesh->info.globalNum          = PMMG_NUL;
@@ -685,6 +709,132 @@ int PMMG_Set_iparameter(PMMG_pParMesh parmesh, int iparam,int val) {
   case PMMG_IPARAM_niter :
     parmesh->niter = val;
     break;
+  case PMMG_IPARAM_nthreads :
+    if ( val < 1 ) {
+      fprintf(stderr,"  ## Warning: %s: number of threads must be strictly"
+              " positive. Reset to default value.\n",__func__);
+      val = PMMG_NTHREADS;
+    }
+#ifndef USE_OPENMP
+    if ( val > 1 ) {
+      fprintf(stderr,"  ## Warning: %s: ParMmg built without OpenMP support."
+              " Groups will be remeshed sequentially.\n",__func__);
+      val = 1;
+    }
+#endif
+    parmesh->info.nthreads = val;
+    break;
+  case PMMG_IPARAM_locateTree :
+    parmesh->info.locateTree = val;
+    break;
+  case PMMG_IPARAM_locateBatch :
+    parmesh->info.locateBatch = val;
+    break;
+  case PMMG_IPARAM_costWeights :
+    parmesh->info.costWeights = val;
+    break;
+  case PMMG_IPARAM_trace :
+    if ( val < PMMG_TRACE_none || val > PMMG_TRACE_chrome ) {
+      fprintf(stderr,"  ## Error: %s: unexpected trace format (%d).\n",
+              __func__,val);
+      return 0;
+    }
+    parmesh->info.trace = val;
+    break;
+  case PMMG_IPARAM_partitioner :
+    if ( !PMMG_partitioner_get(val) ) {
+      fprintf(stderr,"  ## Error: %s: graph partitioner %d not available in"
+              " this build.\n",__func__,val);
+      return 0;
+    }
+    parmesh->info.loadbalancing_mode = val;
+    break;
+  case PMMG_IPARAM_hierarchical :
+    if ( val < 0 ) {
+      fprintf(stderr,"  ## Error: %s: the number of processes per node must be"
+              " positive.\n",__func__);
+      return 0;
+    }
+    parmesh->info.hierarchical = val;
+    break;
+  case PMMG_IPARAM_compressSize :
+#ifndef USE_ZLIB
+    if ( val >= 0 ) {
+      fprintf(stderr,"  ## Warning: %s: compression of the messages not available"
+              " (ParMmg built without zlib). Option ignored.\n",__func__);
+      break;
+    }
+#endif
+    parmesh->info.compressSize = val < 0 ? -1 : val;
+    break;
+  case PMMG_IPARAM_mpiioOutput :
+    parmesh->info.mpiioOutput = val;
+    break;
+  case PMMG_IPARAM_mpiioInput :
+    parmesh->info.mpiioInput = val;
+    break;
+  case PMMG_IPARAM_tuneMeshSize :
+    parmesh->info.tuneGrpSize = val;
+    break;
+  case PMMG_IPARAM_freezeGroups :
+    parmesh->info.freezeGrps = val;
+    break;
+  case PMMG_IPARAM_convergence :
+    parmesh->info.convergence = val;
+    break;
+  case PMMG_IPARAM_checkpoint :
+    if ( val < 0 ) {
+      fprintf(stderr,"  ## Error: %s: the checkpoint period must be positive.\n",
+              __func__);
+      return 0;
+    }
+#ifndef USE_HDF5
+    if ( val > 0 ) {
+      fprintf(stderr,"  ## Warning: %s: restart checkpoints not available"
+              " (ParMmg built without HDF5). Option ignored.\n",__func__);
+      break;
+    }
+#endif
+    parmesh->info.checkpoint = val;
+    break;
+  case PMMG_IPARAM_restart :
+    parmesh->info.restart = val;
+    break;
+  case PMMG_IPARAM_h5Chunk :
+    if ( val < 0 ) {
+      fprintf(stderr,"  ## Error: %s: the HDF5 chunk size must be positive.\n",
+              __func__);
+      return 0;
+    }
+    parmesh->info.h5Chunk = val;
+    break;
+  case PMMG_IPARAM_h5Deflate :
+    if ( val < 0 || val > 9 ) {
+      fprintf(stderr,"  ## Error: %s: the HDF5 deflate level must be in [0-9].\n",
+              __func__);
+      return 0;
+    }
+#ifndef USE_HDF5
+    if ( val > 0 ) {
+      fprintf(stderr,"  ## Warning: %s: HDF5 compression not available"
+              " (ParMmg built without HDF5). Option ignored.\n",__func__);
+      break;
+    }
+#endif
+    parmesh->info.h5Deflate = val;
+    break;
+  case PMMG_IPARAM_mpiioCbNodes :
+    parmesh->info.mpiioCbNodes = MG_MAX(val,0);
+    break;
+  case PMMG_IPARAM_mpiioCbWrite :
+    parmesh->info.mpiioCbWrite = val < 0 ? -1 : ( val ? 1 : 0 );
+    break;
+  case PMMG_IPARAM_mpiioStripeCount :
+    parmesh->info.mpiioStripeCount = MG_MAX(val,0);
+    break;
+  case PMMG_IPARAM_mpiioStripeSize :
+    parmesh->info.mpiioStripeSize = MG_MAX(val,0);
+    break;
 
 #ifndef PATTERN
   case PMMG_IPARAM_octree :
@@ -914,6 +1064,30 @@ int PMMG_Set_dparameter(PMMG_pParMesh parmesh, int dparam,double val){
   case PMMG_DPARAM_groupsRatio :
     parmesh->info.grps_ratio = val;
     break;
+  case PMMG_DPARAM_convergenceLength :
+    if ( val < 0. || val > 1. ) {
+      fprintf(stderr,"  ## Error: %s: the fraction of edges must lie in [0,1].\n",
+              __func__);
+      return 0;
+    }
+    parmesh->info.conv_length = val;
+    break;
+  case PMMG_DPARAM_convergenceQuality :
+    if ( val < 0. || val > 1. ) {
+      fprintf(stderr,"  ## Error: %s: the element quality must lie in [0,1].\n",
+              __func__);
+      return 0;
+    }
+    parmesh->info.conv_quality = val;
+    break;
+  case PMMG_DPARAM_repartItr :
+    if ( val < 0. ) {
+      fprintf(stderr,"  ## Error: %s: the edge cut to migration cost ratio"
+              " must be positive.\n",__func__);
+      return 0;
+    }
+    parmesh->info.repartItr = val;
+    break;
   default :
     fprintf(stderr,"  ## Error: unknown type of parameter\n");
     return 0;
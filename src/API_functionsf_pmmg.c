@@ -1451,6 +1451,25 @@ FORTRAN_NAME(PMMG_LOADMESH_HDF5,pmmg_loadmesh_hdf5,
   return;
 }
 
+/**
+ * See \ref PMMG_loadCheckpoint function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADCHECKPOINT,pmmg_loadcheckpoint,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadCheckpoint(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 /**
  * See \ref PMMG_saveMesh_hdf5 function in \ref libparmmg.h file.
  */
@@ -1470,6 +1489,82 @@ FORTRAN_NAME(PMMG_SAVEMESH_HDF5,pmmg_savemesh_hdf5,
   return;
 }
 
+/**
+ * See \ref PMMG_loadMesh_mpiio function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADMESH_MPIIO,pmmg_loadmesh_mpiio,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadMesh_mpiio(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_saveMesh_mpiio function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVEMESH_MPIIO,pmmg_savemesh_mpiio,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveMesh_mpiio(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_saveMet_mpiio function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVEMET_MPIIO,pmmg_savemet_mpiio,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveMet_mpiio(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_saveLs_mpiio function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVELS_MPIIO,pmmg_savels_mpiio,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen, retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveLs_mpiio(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 
 /**
  * See \ref PMMG_Free_names function in \ref libparmmg.h file.
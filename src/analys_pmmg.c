@@ -664,8 +664,7 @@ int PMMG_hashNorver_communication_ext( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MPI
   PMMG_pExt_comm ext_node_comm;
   double         *rtosend,*rtorecv,*doublevalues;
   int            *itosend,*itorecv,*intvalues;
-  int            k,nitem,color,i,idx,j,pos,d;
-  MPI_Status     status;
+  int            k,nitem,i,idx,j,pos,d;
 
   assert( parmesh->ngrp == 1 );
   assert( grp->mesh == mesh );
@@ -678,7 +677,6 @@ int PMMG_hashNorver_communication_ext( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MPI
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -699,23 +697,17 @@ int PMMG_hashNorver_communication_ext( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MPI
         }
       }
     }
+  }
 
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),MPI_Abort(parmesh->comm,PMMG_TMPFAILURE));
-
-    MPI_CHECK(
-      MPI_Sendrecv(rtosend,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+3,
-                   rtorecv,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+3,
-                   comm,&status),MPI_Abort(parmesh->comm,PMMG_TMPFAILURE) );
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_node_comm,
+                              parmesh->next_node_comm,2,6,
+                              MPI_ANALYS_TAG+2,MPI_ANALYS_TAG+3,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /* Fill internal communicator */
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
-    color = ext_node_comm->color_out;
 
     itorecv = ext_node_comm->itorecv;
     rtorecv = ext_node_comm->rtorecv;
@@ -774,8 +766,7 @@ int PMMG_hashNorver_communication_ext( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MPI
 int PMMG_hashNorver_communication( PMMG_pParMesh parmesh,MPI_Comm comm ){
   PMMG_pExt_comm ext_edge_comm;
   int            *itosend,*itorecv,*intvalues;
-  int            k,nitem,color,i,idx,j;
-  MPI_Status     status;
+  int            k,nitem,i,idx,j;
 
   intvalues = parmesh->int_edge_comm->intvalues;
 
@@ -783,7 +774,6 @@ int PMMG_hashNorver_communication( PMMG_pParMesh parmesh,MPI_Comm comm ){
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -795,12 +785,12 @@ int PMMG_hashNorver_communication( PMMG_pParMesh parmesh,MPI_Comm comm ){
         itosend[2*i+j] = intvalues[2*idx+j];
        }
     }
+  }
 
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),MPI_Abort(parmesh->comm,PMMG_TMPFAILURE) );
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_edge_comm,
+                              parmesh->next_edge_comm,2,0,
+                              MPI_ANALYS_TAG+2,MPI_ANALYS_TAG+2,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /* Fill internal communicator */
@@ -838,8 +828,7 @@ int PMMG_hashNorver_communication( PMMG_pParMesh parmesh,MPI_Comm comm ){
 int PMMG_hashNorver_communication_nor( PMMG_pParMesh parmesh,MPI_Comm comm ) {
   PMMG_pExt_comm ext_node_comm;
   double         *rtosend,*rtorecv,*doublevalues;
-  int            *itosend,*itorecv,*intvalues,k,nitem,color,i,idx,j;
-  MPI_Status     status;
+  int            *itosend,*itorecv,*intvalues,k,nitem,i,idx,j;
 
   intvalues    = parmesh->int_node_comm->intvalues;
   doublevalues = parmesh->int_node_comm->doublevalues;
@@ -848,7 +837,6 @@ int PMMG_hashNorver_communication_nor( PMMG_pParMesh parmesh,MPI_Comm comm ) {
   for( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -863,16 +851,12 @@ int PMMG_hashNorver_communication_nor( PMMG_pParMesh parmesh,MPI_Comm comm ) {
         rtosend[6*i+j] = doublevalues[6*idx+j];
        }
     }
+  }
 
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_ANALYS_TAG+1,
-                   itorecv,nitem,MPI_INT,color,MPI_ANALYS_TAG+1,
-                   comm,&status),MPI_Abort(parmesh->comm,PMMG_TMPFAILURE) );
-     MPI_CHECK(
-      MPI_Sendrecv(rtosend,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+2,
-                   rtorecv,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+2,
-                   comm,&status),MPI_Abort(parmesh->comm,PMMG_TMPFAILURE) );
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_node_comm,
+                              parmesh->next_node_comm,1,6,
+                              MPI_ANALYS_TAG+1,MPI_ANALYS_TAG+2,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /* Fill internal communicator */
@@ -1273,9 +1257,8 @@ int PMMG_set_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar,MPI_Comm comm )
   MMG5_pxTetra   pxt;
   MMG5_pEdge     pa;
   int            *intvalues,*itosend,*itorecv;
-  int            idx,k,nitem,color,edg,ia,ie,ifac,ip[2],i;
+  int            idx,k,nitem,edg,ia,ie,ifac,ip[2],i;
   uint16_t       tag;
-  MPI_Status     status;
 
   assert( parmesh->ngrp == 1 );
   mesh = parmesh->listgrp[0].mesh;
@@ -1314,7 +1297,6 @@ int PMMG_set_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar,MPI_Comm comm )
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -1324,12 +1306,12 @@ int PMMG_set_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar,MPI_Comm comm )
       idx  = ext_edge_comm->int_comm_index[i];
       itosend[i] = intvalues[idx];
     }
+  }
 
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),MPI_Abort(parmesh->comm,PMMG_TMPFAILURE) );
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_edge_comm,
+                              parmesh->next_edge_comm,1,0,
+                              MPI_ANALYS_TAG+2,MPI_ANALYS_TAG+2,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /* Fill internal communicator */
@@ -1375,8 +1357,7 @@ int PMMG_check_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar,MPI_Comm comm
   MMG5_pMesh     mesh;
   MMG5_pEdge     pa;
   int            *intvalues, *itosend, *itorecv;
-  int            i, idx, k, nitem, color, ia;
-  MPI_Status     status;
+  int            i, idx, k, nitem, ia;
 
   assert( parmesh->ngrp == 1 );
   mesh = parmesh->listgrp[0].mesh;
@@ -1398,7 +1379,6 @@ int PMMG_check_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar,MPI_Comm comm
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -1408,13 +1388,12 @@ int PMMG_check_edge_owners( PMMG_pParMesh parmesh,MMG5_HGeom *hpar,MPI_Comm comm
       idx  = ext_edge_comm->int_comm_index[i];
       itosend[i] = intvalues[idx];
     }
+  }
 
-    /* Communication */
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),
-      MPI_Abort(parmesh->comm,PMMG_TMPFAILURE));
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_edge_comm,
+                              parmesh->next_edge_comm,1,0,
+                              MPI_ANALYS_TAG+2,MPI_ANALYS_TAG+2,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /* Check that all edges have the same owner over the whole mesh */
@@ -1729,12 +1708,11 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var,MPI_C
   PMMG_pGrp      grp;
   PMMG_pInt_comm int_node_comm;
   PMMG_pExt_comm ext_node_comm;
-  MPI_Status     status;
   MMG5_pPoint    ppt;
   double         ux,uy,uz,vx,vy,vz,dd;
   int            nc,xp,nr,ns0,ns1,nre;
   int            ip,idx,iproc,k,i,j,d;
-  int            nitem,color;
+  int            nitem;
   int            *intvalues,*itosend,*itorecv,*iproc2comm;
   double         *doublevalues,*rtosend,*rtorecv;
 
@@ -1819,7 +1797,6 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var,MPI_C
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -1832,20 +1809,18 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var,MPI_C
       for( j = 0; j < 2; j++ )
         itosend[2*i+j] = intvalues[2*idx+j];
     }
+  }
 
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG,
-                   comm,&status),
-      MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
-      );
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_node_comm,
+                              parmesh->next_node_comm,2,0,
+                              MPI_ANALYS_TAG,MPI_ANALYS_TAG,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /* Get tags and reset buffers and communicator */
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -1881,7 +1856,6 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var,MPI_C
   for ( k = 0; k < parmesh->next_node_comm; ++k ) {
     ext_node_comm = &parmesh->ext_node_comm[k];
     nitem         = ext_node_comm->nitem;
-    color         = ext_node_comm->color_out;
 
     itosend = ext_node_comm->itosend;
     itorecv = ext_node_comm->itorecv;
@@ -1898,20 +1872,12 @@ int PMMG_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh,PMMG_hn_loopvar *var,MPI_C
           rtosend[6*i+3*j+d] = doublevalues[6*idx+3*j+d];
       }
     }
+  }
 
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG,
-                   comm,&status),
-      MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
-      );
-
-    MPI_CHECK(
-      MPI_Sendrecv(rtosend,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+1,
-                   rtorecv,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+1,
-                   comm,&status),
-      MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
-      );
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_node_comm,
+                              parmesh->next_node_comm,2,6,
+                              MPI_ANALYS_TAG,MPI_ANALYS_TAG+1,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /** First pass: Sum nb. of singularities, Store received edge vectors in
@@ -2074,13 +2040,12 @@ int PMMG_setfeatures(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash,MPI
   MMG5_pTria     ptr;
   int            *intvalues,*itorecv,*itosend;
   double         *doublevalues,*rtorecv,*rtosend;
-  int            nitem,color,nt0,nt1;
+  int            nitem,nt0,nt1;
   double         n1[3],n2[3],dhd;
   int            k,ne,nr,nm,j;
   int            i,i1,i2;
   int            idx,edg,d;
   uint16_t       tag;
-  MPI_Status     status;
 
   assert( parmesh->ngrp == 1 );
   grp = &parmesh->listgrp[0];
@@ -2158,7 +2123,6 @@ int PMMG_setfeatures(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash,MPI
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -2168,12 +2132,12 @@ int PMMG_setfeatures(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash,MPI
       idx  = ext_edge_comm->int_comm_index[i];
       itosend[i] = intvalues[idx];
     }
+  }
 
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status),
-      MPI_Abort(parmesh->comm,PMMG_TMPFAILURE));
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_edge_comm,
+                              parmesh->next_edge_comm,1,0,
+                              MPI_ANALYS_TAG+2,MPI_ANALYS_TAG+2,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /* Update edge tags in the internal communicator */
@@ -2290,7 +2254,6 @@ int PMMG_setfeatures(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash,MPI
   for ( k = 0; k < parmesh->next_edge_comm; ++k ) {
     ext_edge_comm = &parmesh->ext_edge_comm[k];
     nitem         = ext_edge_comm->nitem;
-    color         = ext_edge_comm->color_out;
 
     itosend = ext_edge_comm->itosend;
     itorecv = ext_edge_comm->itorecv;
@@ -2307,16 +2270,12 @@ int PMMG_setfeatures(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *pHash,MPI
           rtosend[6*i+3*j+d] = doublevalues[6*idx+3*j+d];
       }
     }
+  }
 
-    MPI_CHECK(
-      MPI_Sendrecv(itosend,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   itorecv,2*nitem,MPI_INT,color,MPI_ANALYS_TAG+2,
-                   comm,&status), MPI_Abort(parmesh->comm,PMMG_TMPFAILURE) );
-
-    MPI_CHECK(
-      MPI_Sendrecv(rtosend,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+3,
-                   rtorecv,6*nitem,MPI_DOUBLE,color,MPI_ANALYS_TAG+3,
-                   comm,&status), MPI_Abort(parmesh->comm,PMMG_TMPFAILURE) );
+  if ( !PMMG_extComm_exchange(parmesh,parmesh->ext_edge_comm,
+                              parmesh->next_edge_comm,2,6,
+                              MPI_ANALYS_TAG+2,MPI_ANALYS_TAG+3,comm) ) {
+    MPI_Abort(parmesh->comm,PMMG_TMPFAILURE);
   }
 
   /** Step 4 - First pass: Increment the number of seen triangles, check for reference
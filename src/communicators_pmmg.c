@@ -1069,7 +1069,14 @@ int PMMG_build_faceCommIndex( PMMG_pParMesh parmesh, MMG5_int* permtria ) {
  *
  * \return 0 if fail, 1 if succeed
  *
- * Construction of the face communicators from the node communicators
+ * Construction of the face communicators from the node communicators.
+ *
+ * A face shared with the processor \a color has its three nodes in the node
+ * communicator with \a color, so boundary faces are only matched among
+ * processors that already share nodes: each processor sends to each of its
+ * neighbours the global node triplets of its candidate faces, and looks up the
+ * received triplets in its local face hash. Memory and traffic are thus
+ * proportional to the local interface (no global gather of the faces).
  *
  */
 int PMMG_build_faceCommFromNodes( PMMG_pParMesh parmesh,MPI_Comm comm ) {
@@ -1078,14 +1085,17 @@ int PMMG_build_faceCommFromNodes( PMMG_pParMesh parmesh,MPI_Comm comm ) {
   MMG5_pMesh     mesh;
   MMG5_pTria     ptt;
   MMG5_Hash      hash;
-  int            **local_index,**global_index;
-  int            *fNodes_loc,*fNodes_par,*fColors;
-  int            nb_fNodes_loc,*nb_fNodes_par,*displs,*counter,*iproc2comm;
-  int            kt,ia,ib,ic,i,icomm,iproc,iloc,iglob,myrank,next_face_comm,ier;
+  MPI_Request    *request;
+  MPI_Status     status;
+  int            **local_index,**global_index,**fNodes_send;
+  int            *nb_fNodes_send,*fNodes_recv,nb_fNodes_recv,size_fNodes_recv;
+  int            *fColors,*mark,*head,*next,*counter,*icomm2face;
+  int            kt,ia,ib,ic,i,k,icomm,iface,iloc,iglob,color,offset,nt;
+  int            next_node_comm,next_face_comm,ier;
 
-  myrank = parmesh->myrank;
   grp    = &parmesh->listgrp[0];
   mesh   = grp->mesh;
+  next_node_comm = parmesh->next_node_comm;
 
   /** 1) Store global node ids in point flags */
   /* Reset point flags */
@@ -1093,28 +1103,23 @@ int PMMG_build_faceCommFromNodes( PMMG_pParMesh parmesh,MPI_Comm comm ) {
     mesh->point[i].flag = PMMG_NUL;
 
   /* Loop on ext node communicators to get global node IDs */
-  for( icomm=0; icomm<parmesh->next_node_comm; icomm++ ) {
+  for( icomm=0; icomm<next_node_comm; icomm++ ) {
     ext_node_comm = &parmesh->ext_node_comm[icomm];
-    if( !ext_node_comm->nitem_to_share ) continue;
     for( i=0; i<ext_node_comm->nitem_to_share; i++ ) {
       iloc  = ext_node_comm->itosend[i];
       iglob = ext_node_comm->itorecv[i];
       mesh->point[iloc].flag = iglob;
     }
-    /* Deallocate arrays that have been used to store local/global interface
-     * nodes enuleration */
-    PMMG_DEL_MEM(parmesh,ext_node_comm->itosend,int,"ext comm itosend array");
-    PMMG_DEL_MEM(parmesh,ext_node_comm->itorecv,int,"ext comm itorecv array");
-    ext_node_comm->nitem_to_share = 0;
   }
 
   /** 2) Hash triangles with global node index: This avoids the occurrence of
-   * non-boundary faces connected to three parallel nodes. */
-  nb_fNodes_loc = 3*mesh->nt;
-  PMMG_CALLOC(parmesh,fNodes_loc,nb_fNodes_loc,int,"fNodes_loc",return 0);
+   * non-boundary faces connected to three parallel nodes. Candidate triangles
+   * are also listed by their first vertex. */
   PMMG_MALLOC(parmesh,fColors,2*mesh->nt,int,"fColors",return 0);
   for( i=0; i<2*mesh->nt; i++ )
     fColors[i] = PMMG_UNSET;
+  PMMG_CALLOC(parmesh,head,mesh->np+1,int,"head",return 0);
+  PMMG_CALLOC(parmesh,next,mesh->nt+1,int,"next",return 0);
 
   if ( ! MMG5_hashNew(mesh,&hash,0.51*mesh->nt,1.51*mesh->nt) ) return 0;
 
@@ -1128,100 +1133,153 @@ int PMMG_build_faceCommFromNodes( PMMG_pParMesh parmesh,MPI_Comm comm ) {
         MMG5_DEL_MEM(mesh,hash.item);
         return 0;
       }
-      fNodes_loc[3*(kt-1)+0] = ia;
-      fNodes_loc[3*(kt-1)+1] = ib;
-      fNodes_loc[3*(kt-1)+2] = ic;
+      next[kt] = head[ptt->v[0]];
+      head[ptt->v[0]] = kt;
     }
   }
 
+  /* Offset of the local triangles in the global (injective) enumeration */
+  nt     = mesh->nt;
+  offset = 0;
+  MPI_CHECK( MPI_Exscan(&nt,&offset,1,MPI_INT,MPI_SUM,comm), return 0 );
+  if ( !parmesh->myrank ) offset = 0;
+
 
-  /** 3) Communicate face nodes */
-  PMMG_CALLOC(parmesh,nb_fNodes_par,parmesh->nprocs,int,"nb_fNodes_par",return 0);
-  PMMG_CALLOC(parmesh,displs,parmesh->nprocs+1,int,"displs",return 0);
-
-  MPI_CHECK( MPI_Allgather(&nb_fNodes_loc,1,MPI_INT,nb_fNodes_par,1,MPI_INT,comm),
-             return 0 );
-  
-  displs[0] = 0;
-  for( i=0; i<parmesh->nprocs; i++ )
-    displs[i+1] = displs[i]+nb_fNodes_par[i];
-
-  PMMG_CALLOC(parmesh,fNodes_par,displs[parmesh->nprocs],int,"fNodes_par",return 0);
-
-  MPI_CHECK( MPI_Allgatherv(fNodes_loc,nb_fNodes_loc,MPI_INT,
-                            fNodes_par,nb_fNodes_par,displs,MPI_INT,comm), return 0);
-
-
-  /** 4) For each proc pair, get "other" tria in the local hash table,
-   * count and store tria color. */
-  PMMG_CALLOC(parmesh,counter,parmesh->nprocs,int,"counter",return 0);
-  PMMG_CALLOC(parmesh,iproc2comm,parmesh->nprocs,int,"iproc2comm",return 0);
-  for( iproc=0; iproc<parmesh->nprocs; iproc++ )
-    iproc2comm[iproc] = PMMG_UNSET;
-
-  /* Get face colors and count faces for each color */
-  icomm = 0;
-  for( iproc=0; iproc<parmesh->nprocs; iproc++ ) {
-    if( iproc == myrank ) continue;
-    for( i=displs[iproc]/3; i<displs[iproc+1]/3; i++ ) {
-      ia = fNodes_par[3*i+0];
-      ib = fNodes_par[3*i+1];
-      ic = fNodes_par[3*i+2];
-      if( ia && ib && ic ) {
-        kt = MMG5_hashGetFace(&hash,ia,ib,ic);
-        if( kt ) { /*it can be zero if (i) is an internal boundary on iproc  */
-          if( iproc2comm[iproc] == PMMG_UNSET ) iproc2comm[iproc] = icomm++;
-          /* Store face color and face global ID (starting from 1) on the other
-           * proc */
-          fColors[2*(kt-1)+0] = iproc;
-          fColors[2*(kt-1)+1] = i+1;
-          counter[iproc]++;
+  /** 3) For each neighbour, list the triangles whose three nodes are shared
+   * with it: store their global node triplet and their global index */
+  PMMG_CALLOC(parmesh,mark,mesh->np+1,int,"mark",return 0);
+  PMMG_CALLOC(parmesh,nb_fNodes_send,next_node_comm,int,"nb_fNodes_send",return 0);
+  PMMG_CALLOC(parmesh,fNodes_send,next_node_comm,int*,"fNodes_send pointer",return 0);
+
+  for( icomm=0; icomm<next_node_comm; icomm++ ) {
+    ext_node_comm = &parmesh->ext_node_comm[icomm];
+
+    for( i=0; i<ext_node_comm->nitem_to_share; i++ )
+      mark[ext_node_comm->itosend[i]] = icomm+1;
+
+    for( k=0; k<2; k++ ) {
+      /* First pass: count, second pass: fill */
+      nb_fNodes_send[icomm] = 0;
+      for( i=0; i<ext_node_comm->nitem_to_share; i++ ) {
+        for( kt=head[ext_node_comm->itosend[i]]; kt; kt=next[kt] ) {
+          ptt = &mesh->tria[kt];
+          if( mark[ptt->v[1]] != icomm+1 || mark[ptt->v[2]] != icomm+1 ) continue;
+          if( k ) {
+            fNodes_send[icomm][nb_fNodes_send[icomm]+0] = mesh->point[ptt->v[0]].flag;
+            fNodes_send[icomm][nb_fNodes_send[icomm]+1] = mesh->point[ptt->v[1]].flag;
+            fNodes_send[icomm][nb_fNodes_send[icomm]+2] = mesh->point[ptt->v[2]].flag;
+            fNodes_send[icomm][nb_fNodes_send[icomm]+3] = offset+kt;
+          }
+          nb_fNodes_send[icomm] += 4;
         }
       }
+      if( !k ) {
+        PMMG_MALLOC(parmesh,fNodes_send[icomm],MG_MAX(1,nb_fNodes_send[icomm]),
+                    int,"fNodes_send",return 0);
+      }
     }
+
+    /* Deallocate arrays that have been used to store local/global interface
+     * nodes enuleration */
+    PMMG_DEL_MEM(parmesh,ext_node_comm->itosend,int,"ext comm itosend array");
+    PMMG_DEL_MEM(parmesh,ext_node_comm->itorecv,int,"ext comm itorecv array");
+    ext_node_comm->nitem_to_share = 0;
   }
-  assert( iproc2comm[myrank] == PMMG_UNSET );
+  PMMG_DEL_MEM(parmesh,mark,int,"mark");
+  PMMG_DEL_MEM(parmesh,head,int,"head");
+  PMMG_DEL_MEM(parmesh,next,int,"next");
+
+
+  /** 4) Exchange the candidate faces with the neighbours, get "other" tria in
+   * the local hash table, count and store tria color. */
+  PMMG_MALLOC(parmesh,request,MG_MAX(1,next_node_comm),MPI_Request,
+              "mpi request array",return 0);
+  PMMG_CALLOC(parmesh,counter,next_node_comm,int,"counter",return 0);
+
+  for( icomm=0; icomm<next_node_comm; icomm++ ) {
+    color = parmesh->ext_node_comm[icomm].color_out;
+    MPI_CHECK( MPI_Isend(fNodes_send[icomm],nb_fNodes_send[icomm],MPI_INT,color,
+                         MPI_COMMUNICATORS_FACE_TAG,comm,&request[icomm]),
+               return 0 );
+  }
+
+  size_fNodes_recv = 1;
+  PMMG_MALLOC(parmesh,fNodes_recv,size_fNodes_recv,int,"fNodes_recv",return 0);
+  for( icomm=0; icomm<next_node_comm; icomm++ ) {
+    color = parmesh->ext_node_comm[icomm].color_out;
+
+    MPI_CHECK( MPI_Probe(color,MPI_COMMUNICATORS_FACE_TAG,comm,&status),return 0 );
+    MPI_CHECK( MPI_Get_count(&status,MPI_INT,&nb_fNodes_recv),return 0 );
+    if( nb_fNodes_recv > size_fNodes_recv ) {
+      PMMG_REALLOC(parmesh,fNodes_recv,nb_fNodes_recv,size_fNodes_recv,int,
+                   "fNodes_recv",return 0);
+      size_fNodes_recv = nb_fNodes_recv;
+    }
+    MPI_CHECK( MPI_Recv(fNodes_recv,nb_fNodes_recv,MPI_INT,color,
+                        MPI_COMMUNICATORS_FACE_TAG,comm,&status),return 0 );
+
+    for( i=0; i<nb_fNodes_recv/4; i++ ) {
+      ia = fNodes_recv[4*i+0];
+      ib = fNodes_recv[4*i+1];
+      ic = fNodes_recv[4*i+2];
+      kt = MMG5_hashGetFace(&hash,ia,ib,ic);
+      if( kt ) { /*it can be zero if (i) is an internal boundary on color  */
+        /* Store face communicator and face global ID on the other proc */
+        fColors[2*(kt-1)+0] = icomm;
+        fColors[2*(kt-1)+1] = fNodes_recv[4*i+3];
+        counter[icomm]++;
+      }
+    }
+  }
+
+  MPI_CHECK( MPI_Waitall(next_node_comm,request,MPI_STATUSES_IGNORE), return 0 );
+
+  PMMG_DEL_MEM(parmesh,fNodes_recv,int,"fNodes_recv");
+  for( icomm=0; icomm<next_node_comm; icomm++ )
+    PMMG_DEL_MEM(parmesh,fNodes_send[icomm],int,"fNodes_send");
+  PMMG_DEL_MEM(parmesh,fNodes_send,int*,"fNodes_send pointer");
+  PMMG_DEL_MEM(parmesh,nb_fNodes_send,int,"nb_fNodes_send");
+  PMMG_DEL_MEM(parmesh,request,MPI_Request,"mpi request array");
 
 
   /** 5) Fill face communicators. */
 
   /* Set nb of communicators */
+  PMMG_MALLOC(parmesh,icomm2face,next_node_comm,int,"icomm2face",return 0);
   next_face_comm = 0;
-  for( iproc=0; iproc<parmesh->nprocs; iproc++ ) {
-    if( iproc2comm[iproc] != PMMG_UNSET ) next_face_comm++;
+  for( icomm=0; icomm<next_node_comm; icomm++ ) {
+    icomm2face[icomm] = counter[icomm] ? next_face_comm++ : PMMG_UNSET;
   }
   ier = PMMG_Set_numberOfFaceCommunicators(parmesh,next_face_comm);
 
   PMMG_CALLOC(parmesh, local_index,next_face_comm,int*, "local_index pointer",return 0);
   PMMG_CALLOC(parmesh,global_index,next_face_comm,int*,"global_index pointer",return 0);
-  for( iproc=0; iproc<parmesh->nprocs; iproc++ ) {
-    if( iproc2comm[iproc] == PMMG_UNSET ) continue;
+  for( icomm=0; icomm<next_node_comm; icomm++ ) {
+    iface = icomm2face[icomm];
+    if( iface == PMMG_UNSET ) continue;
     /* Set communicator size and reset counter */
-    icomm = iproc2comm[iproc];
-    PMMG_CALLOC(parmesh, local_index[icomm],counter[iproc],int, "local_index array",return 0);
-    PMMG_CALLOC(parmesh,global_index[icomm],counter[iproc],int,"global_index array",return 0);
-    ier = PMMG_Set_ithFaceCommunicatorSize(parmesh,icomm,iproc,counter[iproc]);
-    counter[iproc] = 0;
+    color = parmesh->ext_node_comm[icomm].color_out;
+    PMMG_CALLOC(parmesh, local_index[iface],counter[icomm],int, "local_index array",return 0);
+    PMMG_CALLOC(parmesh,global_index[iface],counter[icomm],int,"global_index array",return 0);
+    ier = PMMG_Set_ithFaceCommunicatorSize(parmesh,iface,color,counter[icomm]);
+    counter[icomm] = 0;
   }
 
   /* Create injective, non-surjective global face enumeration */
   for (kt=1; kt<=mesh->nt; kt++) {
-    iproc = fColors[2*(kt-1)];
-    if( iproc == PMMG_UNSET ) continue;
+    icomm = fColors[2*(kt-1)];
+    if( icomm == PMMG_UNSET ) continue;
     iglob = fColors[2*(kt-1)+1];
-    icomm = iproc2comm[iproc];
-    i = counter[iproc]++;
-    local_index[icomm][i] = kt;
-    global_index[icomm][i] = MG_MIN(displs[myrank]/3+kt,iglob);
+    iface = icomm2face[icomm];
+    i = counter[icomm]++;
+    local_index[iface][i] = kt;
+    global_index[iface][i] = MG_MIN(offset+kt,iglob);
   }
- 
- 
+
   /* Fill and sort each communicator */
-  for( iproc=0; iproc<parmesh->nprocs; iproc++ ) {
-    if( iproc2comm[iproc] == PMMG_UNSET ) continue;
-    icomm = iproc2comm[iproc];
-    ier = PMMG_Set_ithFaceCommunicator_faces( parmesh, icomm, local_index[icomm],
-                                              global_index[icomm], 1 );
+  for( iface=0; iface<next_face_comm; iface++ ) {
+    ier = PMMG_Set_ithFaceCommunicator_faces( parmesh, iface, local_index[iface],
+                                              global_index[iface], 1 );
   }
 
   /** 6) Set communicators indexing, convert tria index into iel face index */
@@ -1232,16 +1290,11 @@ int PMMG_build_faceCommFromNodes( PMMG_pParMesh parmesh,MPI_Comm comm ) {
   /* Free memory */
   MMG5_DEL_MEM(mesh,hash.item);
   PMMG_DEL_MEM(parmesh,fColors,int,"fColors");
-  PMMG_DEL_MEM(parmesh,fNodes_loc,int,"fNodes_loc");
-  PMMG_DEL_MEM(parmesh,fNodes_loc,int,"fNodes_par");
-  PMMG_DEL_MEM(parmesh,nb_fNodes_par,int,"nb_fNodes_par");
-  PMMG_DEL_MEM(parmesh,fNodes_par,int,"fNodes_par");
-  PMMG_DEL_MEM(parmesh,displs,int,"displs");
   PMMG_DEL_MEM(parmesh,counter,int,"counter");
-  PMMG_DEL_MEM(parmesh,iproc2comm,int,"iproc2comm");
-  for( icomm=0; icomm<next_face_comm; icomm++ ) {
-    PMMG_DEL_MEM(parmesh, local_index[icomm],int, "local_index array");
-    PMMG_DEL_MEM(parmesh,global_index[icomm],int,"global_index array");
+  PMMG_DEL_MEM(parmesh,icomm2face,int,"icomm2face");
+  for( iface=0; iface<next_face_comm; iface++ ) {
+    PMMG_DEL_MEM(parmesh, local_index[iface],int, "local_index array");
+    PMMG_DEL_MEM(parmesh,global_index[iface],int,"global_index array");
   }
   PMMG_DEL_MEM(parmesh, local_index,int*, "local_index pointer");
   PMMG_DEL_MEM(parmesh,global_index,int*,"global_index pointer");
@@ -2233,3 +2286,81 @@ end:
 
   return ier;
 }
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param ext_comm array of external communicators.
+ * \param next_comm number of external communicators.
+ * \param nint number of integers to exchange per item (stored in the \a
+ * itosend/\a itorecv buffers).
+ * \param ndouble number of doubles to exchange per item (stored in the \a
+ * rtosend/\a rtorecv buffers).
+ * \param itag MPI tag of the integer messages.
+ * \param rtag MPI tag of the double messages.
+ * \param comm MPI communicator to use.
+ *
+ * \return 0 if fail, 1 if success.
+ *
+ * Exchange the \a nint*nitem integers and \a ndouble*nitem doubles of the send
+ * buffers of each external communicator with the matching receive buffers of
+ * the neighbour process. All the receives and sends are posted at once and
+ * completed by a single wait, so the neighbours are not served one after the
+ * other as with successive blocking MPI_Sendrecv.
+ *
+ * \remark the buffers must be allocated by the caller with at least nint
+ * (resp. ndouble) values per item.
+ */
+int PMMG_extComm_exchange( PMMG_pParMesh parmesh,PMMG_pExt_comm ext_comm,
+                           int next_comm,int nint,int ndouble,int itag,
+                           int rtag,MPI_Comm comm ) {
+  PMMG_pExt_comm pext_comm;
+  MPI_Request    *request;
+  int            k,nreq,nitem,color,ier;
+
+  if ( !next_comm ) return 1;
+
+  request = NULL;
+  PMMG_MALLOC(parmesh,request,4*next_comm,MPI_Request,"mpi request array",
+              return 0);
+
+  ier  = 1;
+  nreq = 0;
+
+  /* Post all the receives first so matching sends can complete eagerly */
+  for ( k=0; k<next_comm; ++k ) {
+    pext_comm = &ext_comm[k];
+    nitem     = pext_comm->nitem;
+    color     = pext_comm->color_out;
+
+    if ( nint ) {
+      MPI_CHECK( MPI_Irecv(pext_comm->itorecv,nint*nitem,MPI_INT,color,itag,
+                           comm,&request[nreq++]),ier = 0 );
+    }
+    if ( ndouble ) {
+      MPI_CHECK( MPI_Irecv(pext_comm->rtorecv,ndouble*nitem,MPI_DOUBLE,color,
+                           rtag,comm,&request[nreq++]),ier = 0 );
+    }
+  }
+
+  for ( k=0; k<next_comm; ++k ) {
+    pext_comm = &ext_comm[k];
+    nitem     = pext_comm->nitem;
+    color     = pext_comm->color_out;
+
+    if ( nint ) {
+      MPI_CHECK( MPI_Isend(pext_comm->itosend,nint*nitem,MPI_INT,color,itag,
+                           comm,&request[nreq++]),ier = 0 );
+    }
+    if ( ndouble ) {
+      MPI_CHECK( MPI_Isend(pext_comm->rtosend,ndouble*nitem,MPI_DOUBLE,color,
+                           rtag,comm,&request[nreq++]),ier = 0 );
+    }
+    PMMG_trace_bytes(parmesh,(size_t)nitem*(nint*sizeof(int)+ndouble*sizeof(double)));
+  }
+
+  MPI_CHECK( MPI_Waitall(nreq,request,MPI_STATUSES_IGNORE),ier = 0 );
+
+  PMMG_DEL_MEM(parmesh,request,MPI_Request,"mpi request array");
+
+  return ier;
+}
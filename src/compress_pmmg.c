@@ -0,0 +1,249 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file compress_pmmg.c
+ * \brief Compression of the large messages (groups migration and mesh gather).
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * A compressed message is made of the size of the uncompressed data (stored
+ * on 8 bytes) followed by the zlib stream of the data. A message is compressed
+ * only if its size is larger than the \a compressSize threshold and only if
+ * the compression reduces its size, thus a receiver that knows the
+ * uncompressed size of the data can detect a compressed message from its size.
+ *
+ */
+#include "parmmg.h"
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+/** Size of the prefix of a compressed message */
+#define PMMG_COMPRESS_PREFIX sizeof(uint64_t)
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param size size (in bytes) of the message to send.
+ *
+ * \return 1 if the message has to be compressed, 0 otherwise.
+ *
+ */
+int PMMG_compress_isUsed( PMMG_pParMesh parmesh,size_t size ) {
+#ifdef USE_ZLIB
+  if ( parmesh->info.compressSize < 0 ) return 0;
+
+  return size > (size_t)parmesh->info.compressSize*1024;
+#else
+  return 0;
+#endif
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param in data to compress.
+ * \param size size (in bytes) of \a in.
+ * \param out pointer toward the compressed message (allocated here).
+ * \param outsize size of the compressed message.
+ *
+ * \return 1 if \a in has been compressed, 0 if the compression fails or doesn't
+ * reduce the message size (\a out is not allocated in this case).
+ *
+ */
+int PMMG_compress_buffer( PMMG_pParMesh parmesh,const char *in,size_t size,
+                          char **out,size_t *outsize ) {
+#ifdef USE_ZLIB
+  uLongf   zsize;
+  uint64_t rawsize;
+  int      ier;
+
+  *out     = NULL;
+  *outsize = 0;
+
+  if ( (uLong)size != size ) return 0;
+
+  zsize = compressBound((uLong)size);
+
+  ier = 1;
+  PMMG_MALLOC(parmesh,*out,PMMG_COMPRESS_PREFIX+zsize,char,"compressed buffer",
+              ier = 0);
+  if ( !ier ) return 0;
+
+  rawsize = (uint64_t)size;
+  memcpy(*out,&rawsize,PMMG_COMPRESS_PREFIX);
+
+  if ( Z_OK != compress2((Bytef*)(*out+PMMG_COMPRESS_PREFIX),&zsize,
+                         (const Bytef*)in,(uLong)size,Z_BEST_SPEED) ||
+       PMMG_COMPRESS_PREFIX + zsize >= size ) {
+    PMMG_DEL_MEM(parmesh,*out,char,"compressed buffer");
+    return 0;
+  }
+
+  *outsize = PMMG_COMPRESS_PREFIX + zsize;
+
+  return 1;
+#else
+  *out     = NULL;
+  *outsize = 0;
+
+  return 0;
+#endif
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param in compressed message.
+ * \param insize size of the compressed message.
+ * \param out buffer in which we uncompress the data.
+ * \param size size (in bytes) of \a out.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Uncompress a message built by \a PMMG_compress_buffer.
+ *
+ */
+int PMMG_uncompress_buffer( PMMG_pParMesh parmesh,const char *in,size_t insize,
+                            char *out,size_t size ) {
+#ifdef USE_ZLIB
+  uLongf   zsize;
+  uint64_t rawsize;
+
+  if ( insize < PMMG_COMPRESS_PREFIX ) return 0;
+
+  memcpy(&rawsize,in,PMMG_COMPRESS_PREFIX);
+  if ( rawsize != (uint64_t)size ) {
+    fprintf(stderr,"\n  ## Error: %s: rank %d: unexpected size of the compressed"
+            " data (%zu bytes instead of %zu).\n",__func__,
+            parmesh->myrank,(size_t)rawsize,size);
+    return 0;
+  }
+
+  zsize = (uLongf)size;
+  if ( Z_OK != uncompress((Bytef*)out,&zsize,(const Bytef*)(in+PMMG_COMPRESS_PREFIX),
+                          (uLong)(insize-PMMG_COMPRESS_PREFIX)) || zsize != size ) {
+    fprintf(stderr,"\n  ## Error: %s: rank %d: unable to uncompress the"
+            " received data.\n",__func__,parmesh->myrank);
+    return 0;
+  }
+
+  return 1;
+#else
+  fprintf(stderr,"\n  ## Error: %s: rank %d: compressed message received but"
+          " ParMmg has been built without zlib.\n",__func__,parmesh->myrank);
+  return 0;
+#endif
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param datatype MPI data type describing the data to send from \a MPI_BOTTOM.
+ * \param out pointer toward the compressed message (allocated here).
+ * \param outsize size of the compressed message.
+ *
+ * \return 1 if the data have been compressed, 0 if the compression fails or
+ * doesn't reduce the message size (\a out is not allocated in this case).
+ *
+ * Pack the data described by \a datatype in a contiguous buffer and compress
+ * it. The packing removes the fields and the padding of the structures that
+ * are not described by the data type.
+ *
+ * \remark The pack functions count the bytes with int: data larger than
+ * INT_MAX bytes are not compressed.
+ *
+ */
+int PMMG_compress_datatype( PMMG_pParMesh parmesh,MPI_Datatype datatype,
+                            char **out,size_t *outsize ) {
+  MPI_Count tsize;
+  char      *packed;
+  int       size,position,ier;
+
+  *out     = NULL;
+  *outsize = 0;
+
+  /* Check the data size before MPI_Pack_size, whose result would overflow */
+  MPI_CHECK( MPI_Type_size_x(datatype,&tsize), return 0 );
+  if ( tsize == MPI_UNDEFINED || tsize > INT_MAX ) return 0;
+
+  MPI_CHECK( MPI_Pack_size(1,datatype,parmesh->comm,&size), return 0 );
+  if ( size < 0 || size == MPI_UNDEFINED ) return 0;
+
+  ier    = 1;
+  packed = NULL;
+  PMMG_MALLOC(parmesh,packed,size,char,"packed data",ier = 0);
+  if ( !ier ) return 0;
+
+  position = 0;
+  MPI_CHECK( MPI_Pack(MPI_BOTTOM,1,datatype,packed,size,&position,parmesh->comm),
+             ier = 0 );
+
+  if ( ier ) {
+    ier = PMMG_compress_buffer(parmesh,packed,(size_t)position,out,outsize);
+  }
+
+  PMMG_DEL_MEM(parmesh,packed,char,"packed data");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param in compressed message.
+ * \param insize size of the compressed message.
+ * \param datatype MPI data type describing the storage of the data from
+ * \a MPI_BOTTOM.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Uncompress a message built by \a PMMG_compress_datatype and unpack its data in
+ * their final storage.
+ *
+ */
+int PMMG_uncompress_datatype( PMMG_pParMesh parmesh,const char *in,size_t insize,
+                              MPI_Datatype datatype ) {
+  uint64_t rawsize;
+  char     *packed;
+  int      position,ier;
+
+  if ( insize < PMMG_COMPRESS_PREFIX ) return 0;
+
+  memcpy(&rawsize,in,PMMG_COMPRESS_PREFIX);
+  if ( rawsize > INT_MAX ) return 0;
+
+  ier    = 1;
+  packed = NULL;
+  PMMG_MALLOC(parmesh,packed,rawsize,char,"packed data",ier = 0);
+  if ( !ier ) return 0;
+
+  ier = PMMG_uncompress_buffer(parmesh,in,insize,packed,(size_t)rawsize);
+
+  if ( ier ) {
+    position = 0;
+    MPI_CHECK( MPI_Unpack(packed,(int)rawsize,&position,MPI_BOTTOM,1,datatype,
+                          parmesh->comm), ier = 0 );
+  }
+
+  PMMG_DEL_MEM(parmesh,packed,char,"packed data");
+
+  return ier;
+}
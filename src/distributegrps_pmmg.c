@@ -956,7 +956,9 @@ end:
  * \param nitem_recv_ext_idx size of recv_ext_idx buffer
  * \param ext_recv_comm external communicator \a myrank - \a recv
  * \param irequest mpi request of the send of the integer buffer
- * \param drequest mpi request of the send of the double buffer
+ * \param drequest mpi request of the send of the group headers buffer
+ * \param arequest mpi request of the in place send of the group arrays
+ * \param mpi_grps MPI data type describing the group arrays to send
  * \param trequest array of mpi requests of the send of the external comm
  *
  * \return 0 if fail, 1 if we success
@@ -964,6 +966,11 @@ end:
  * Transfer and update the data that are modified due to the transfer of the
  * groups from the local processor (\myrank) toward the proc \a recv.
  *
+ * \remark the mesh and solution arrays of the groups are sent in place so the
+ * transfered groups can't be freed before the completion of \a arequest. If
+ * the arrays are large enough to be compressed (see \a PMMG_compress_isUsed),
+ * they are appended to the headers buffer instead.
+ *
  */
 static inline
 int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
@@ -972,17 +979,20 @@ int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
                                  int *nitem_recv_ext_idx,
                                  PMMG_pExt_comm ext_recv_comm,char **grps2send,
                                  int *pack_size,MPI_Request *irequest,
-                                 MPI_Request *drequest,MPI_Request **trequest ) {
+                                 MPI_Request *drequest,MPI_Request *arequest,
+                                 MPI_Datatype *mpi_grps,MPI_Request **trequest ) {
 
   PMMG_pGrp      grp;
   PMMG_pInt_comm int_comm;
   PMMG_pExt_comm ext_face_comm;
   MPI_Status     status;
-  int            offset,nitem_recv_intcomm;
+  MPI_Count      arrays_size;
+  size_t         zsize;
+  int            offset,nitem_recv_intcomm,ier_arrays,compressed;
   int            k,i,count,ier,ier0,old_nitem,idx;
   int            *send2recv_int_comm,old_offset,nitem,nextcomm;
   int            nitem_ext_recv_comm;
-  char           *ptr;
+  char           *ptr,*zbuf;
 
   const int      myrank      = parmesh->myrank;
   const int      nprocs      = parmesh->nprocs;
@@ -1318,34 +1328,87 @@ int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
       grp->face2int_face_comm_index2[i] = send2recv_int_comm ? send2recv_int_comm[idx] : 0;
     }
 
-    *pack_size += PMMG_mpisizeof_grp(grp);
+    *pack_size += PMMG_mpisizeof_grpHeader(grp);
+  }
+
+  /* Describe the mesh and solution arrays in their storage */
+  arrays_size = 0;
+  ier_arrays  = PMMG_create_MPI_grpArrays(parmesh,parmesh->listgrp,ngrp,recv,
+                                          mpi_grps);
+  if ( ier_arrays ) {
+    MPI_CHECK ( MPI_Type_size_x(*mpi_grps,&arrays_size), arrays_size = 0 );
+  }
+  else {
+    ier = 0;
+  }
+
+  /* Large arrays may be compressed: in this case they are sent at the end of
+   * the headers buffer instead of in place */
+  compressed = 0;
+  zsize      = 0;
+  zbuf       = NULL;
+  if ( ier_arrays && PMMG_compress_isUsed(parmesh,(size_t)arrays_size) ) {
+    compressed = PMMG_compress_datatype(parmesh,*mpi_grps,&zbuf,&zsize);
+  }
+
+  /* The headers buffer size is an int: send the arrays uncompressed if the
+   * compressed ones don't fit in it */
+  if ( compressed && zsize > (size_t)INT_MAX - sizeof(int) - (size_t)*pack_size ) {
+    PMMG_DEL_MEM ( parmesh,zbuf,char,"compressed buffer" );
+    compressed = 0;
+    zsize      = 0;
   }
 
-  /* Pack the groups */
+  /* Pack the group headers */
+  *pack_size += sizeof(int) + zsize;
   PMMG_MALLOC ( parmesh,*grps2send,*pack_size,char,"grps2send",
                 ier = MG_MIN(ier,0) );
 
-  ptr = *grps2send;
-  for ( k=0; k<ngrp; ++k ) {
-    grp = &parmesh->listgrp[k];
+  if ( *grps2send ) {
+    ptr = *grps2send;
+    *( (int *) ptr ) = compressed; ptr += sizeof(int);
+    for ( k=0; k<ngrp; ++k ) {
+      grp = &parmesh->listgrp[k];
 
-    if ( grp->flag != recv ) continue;
-    PMMG_mpipack_grp(grp,&ptr);
+      if ( grp->flag != recv ) continue;
+      PMMG_mpipack_grpHeader(grp,&ptr);
+    }
+    if ( compressed ) {
+      memcpy(ptr,zbuf,zsize);
+      parmesh->trace.zbytesIn  += (size_t)arrays_size;
+      parmesh->trace.zbytesOut += zsize;
+    }
   }
+  else {
+    /* Send an empty headers buffer: the receiver can't unpack the groups */
+    *pack_size = 0;
+    compressed = 0;
+  }
+  PMMG_DEL_MEM ( parmesh,zbuf,char,"compressed buffer" );
 
   /* Send its */
   *drequest = MPI_REQUEST_NULL;
   MPI_CHECK ( MPI_Isend ( *grps2send,*pack_size,MPI_CHAR,recv,MPI_SENDGRP_TAG,
                            comm,drequest), ier = 0 );
 
-  /** Free the memory */
-  /* Group deletion */
-  for ( k=0; k<parmesh->ngrp; ++k ) {
-    if ( parmesh->listgrp[k].flag == recv ) {
-      PMMG_grp_free ( parmesh,&parmesh->listgrp[k] );
-    }
+  /* Send the mesh and solution arrays from their storage: the receiver
+   * allocates its arrays from the headers and receives them in place */
+  *arequest = MPI_REQUEST_NULL;
+  if ( ier_arrays && !compressed && *grps2send ) {
+    MPI_CHECK ( MPI_Isend ( MPI_BOTTOM,1,*mpi_grps,recv,MPI_SENDGRP_ARRAYS_TAG,
+                            comm,arequest), ier = 0 );
   }
+  else {
+    /* Unlock the receiver (the arrays are in the headers buffer or can't be
+     * sent) */
+    arrays_size = 0;
+    MPI_CHECK ( MPI_Isend ( NULL,0,MPI_BYTE,recv,MPI_SENDGRP_ARRAYS_TAG,
+                            comm,arequest), ier = 0 );
+  }
+  PMMG_trace_bytes(parmesh,(size_t)*pack_size+(size_t)arrays_size);
+  parmesh->trace.nbytesGrps += (size_t)*pack_size+(size_t)arrays_size;
 
+  /** Free the memory */
   PMMG_DEL_MEM ( parmesh,send2recv_int_comm,int,"send2recv_int_comm" );
 
   return ier;
@@ -1378,8 +1441,9 @@ int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
 
   PMMG_pExt_comm ext_face_comm;
   MPI_Status     status;
-  int            pack_size;
-  int            k,ier,ier0,recv_int_nitem,offset,old_nitem;
+  MPI_Datatype   mpi_grps;
+  int            pack_size,compressed;
+  int            k,ier,ier0,ier_arrays,recv_int_nitem,offset,old_nitem;
   int            *send2recv_int_comm,nitem,nextcomm;
   int            old_offset,grpscount,idx,color_out,n,err;
   char           *buffer,*ptr;
@@ -1570,10 +1634,17 @@ int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
   MPI_CHECK ( MPI_Probe(sndr,MPI_SENDGRP_TAG,comm,&status), ier = 0 );
   MPI_CHECK ( MPI_Get_count(&status,MPI_CHAR,&pack_size), ier = 0 );
 
+  buffer = NULL;
   PMMG_MALLOC ( parmesh,buffer,pack_size,char,"buffer", ier = 0 );
 
-  MPI_CHECK ( MPI_Recv(buffer,pack_size,MPI_CHAR,sndr,MPI_SENDGRP_TAG,comm,&status),
-              ier = 0 );
+  if ( buffer ) {
+    MPI_CHECK ( MPI_Recv(buffer,pack_size,MPI_CHAR,sndr,MPI_SENDGRP_TAG,comm,&status),
+                ier = 0 );
+  }
+  else {
+    /* Match the message anyway (truncated if not empty) */
+    MPI_Recv(NULL,0,MPI_CHAR,sndr,MPI_SENDGRP_TAG,comm,&status);
+  }
 
   ier0 = 1;
   if( ngrp ) {
@@ -1603,17 +1674,74 @@ int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
   }
 #endif
 
-  ptr = buffer;
+  /* Unpack the headers: it allocates the group arrays at their final size */
+  ptr        = buffer;
+  compressed = 0;
+  if ( buffer && pack_size >= (int)sizeof(int) ) {
+    compressed = *( (int *) ptr ); ptr += sizeof(int);
+  }
+  else {
+    /* No headers: the groups can't be unpacked */
+    ier0 = 0;
+    ier  = 0;
+  }
+  ier_arrays = ier0;
   if ( ier0 ) {
     for ( k=0; k<grpscount; ++k ) {
-      err = PMMG_mpiunpack_grp(parmesh,parmesh->listgrp,ngrp+k,&ptr);
-      ier = MG_MIN(ier,err);
+      err = PMMG_mpiunpack_grpHeader(parmesh,parmesh->listgrp,ngrp+k,&ptr);
+      ier_arrays = MG_MIN(ier_arrays,err);
       parmesh->listgrp[ngrp+k].flag = PMMG_UNSET;
     }
+  }
+
+  /** Step 6: Receive the group arrays in place */
+  mpi_grps = MPI_DATATYPE_NULL;
+  if ( ier_arrays ) {
+    ier_arrays = PMMG_create_MPI_grpArrays(parmesh,parmesh->listgrp+ngrp,
+                                           grpscount,PMMG_UNSET,&mpi_grps);
+  }
+
+  if ( compressed ) {
+    /* The arrays have been compressed at the end of the headers buffer */
+    if ( ier_arrays ) {
+      err = PMMG_uncompress_datatype(parmesh,ptr,(size_t)(pack_size-(ptr-buffer)),
+                                     mpi_grps);
+      ier = MG_MIN(ier,err);
+      MPI_Type_free(&mpi_grps);
+    }
+    else {
+      ier = 0;
+    }
+    PMMG_DEL_MEM ( parmesh,buffer,char,"buffer" );
+
+    /* Empty message that unlocks the receiver */
+    MPI_CHECK ( MPI_Recv(NULL,0,MPI_BYTE,sndr,MPI_SENDGRP_ARRAYS_TAG,comm,&status),
+                ier = 0 );
+  }
+  else if ( ier_arrays ) {
+    PMMG_DEL_MEM ( parmesh,buffer,char,"buffer" );
+
+    MPI_CHECK ( MPI_Recv(MPI_BOTTOM,1,mpi_grps,sndr,MPI_SENDGRP_ARRAYS_TAG,comm,&status),
+                ier = 0 );
+    MPI_Type_free(&mpi_grps);
+  }
+  else {
+    PMMG_DEL_MEM ( parmesh,buffer,char,"buffer" );
 
+    /* Drain the message in a scratch buffer */
+    ier = 0;
+    MPI_CHECK ( MPI_Probe(sndr,MPI_SENDGRP_ARRAYS_TAG,comm,&status), ier = 0 );
+    MPI_CHECK ( MPI_Get_count(&status,MPI_BYTE,&pack_size), pack_size = 0 );
+
+    buffer = NULL;
+    if ( pack_size > 0 ) {
+      PMMG_MALLOC ( parmesh,buffer,pack_size,char,"buffer", pack_size = 0 );
+    }
+    MPI_CHECK ( MPI_Recv(buffer,pack_size,MPI_BYTE,sndr,MPI_SENDGRP_ARRAYS_TAG,comm,
+                         &status), ier = 0 );
+    PMMG_DEL_MEM ( parmesh,buffer,char,"buffer" );
   }
 
-  PMMG_DEL_MEM ( parmesh,buffer,char,"buffer" );
   return ier;
 }
 
@@ -1638,8 +1766,9 @@ int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
 
   PMMG_pExt_comm ext_face_comm,ext_send_comm,ext_recv_comm;
   MPI_Status     status;
-  MPI_Request    irequest,drequest;
+  MPI_Request    irequest,drequest,arequest;
   MPI_Request    *trequest;
+  MPI_Datatype   mpi_grps;
   int            k,count,ier,ier0,*recv_ext_idx,old_nitem,idx,pack_size,err;
   int            *intcomm_flag,nitem_intcomm_flag,nitem_recv_ext_idx;
   char           *grps2send;
@@ -1682,6 +1811,7 @@ int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
   intcomm_flag = NULL;
   recv_ext_idx = NULL;
   trequest     = NULL;
+  mpi_grps     = MPI_DATATYPE_NULL;
 
   if ( myrank == sndr ) {
     /* j = recv */
@@ -1689,7 +1819,8 @@ int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
                                        &intcomm_flag,&nitem_intcomm_flag,
                                        &recv_ext_idx,&nitem_recv_ext_idx,
                                        ext_recv_comm,&grps2send,&pack_size,
-                                       &irequest,&drequest,&trequest);
+                                       &irequest,&drequest,&arequest,
+                                       &mpi_grps,&trequest);
   }
   else if ( myrank == recv ) {
     /* i = sndr */
@@ -1795,9 +1926,20 @@ int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
 
     MPI_CHECK( MPI_Wait(&irequest,&status), return 0 );
     MPI_CHECK( MPI_Wait(&drequest,&status), return 0 );
+    MPI_CHECK( MPI_Wait(&arequest,&status), return 0 );
 
     /* Free the memory */
     PMMG_DEL_MEM ( parmesh,grps2send,char,"grps2send" );
+    if ( mpi_grps != MPI_DATATYPE_NULL ) {
+      MPI_Type_free(&mpi_grps);
+    }
+
+    /* Group deletion (the groups arrays have been sent in place) */
+    for ( k=0; k<parmesh->ngrp; ++k ) {
+      if ( parmesh->listgrp[k].flag == recv ) {
+        PMMG_grp_free ( parmesh,&parmesh->listgrp[k] );
+      }
+    }
   }
   else if ( myrank == recv ) {
     MPI_CHECK( MPI_Wait(&irequest,&status), return 0 );
@@ -1945,6 +2087,18 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
       ier = MG_MIN ( ier,err );
     }
   }
+  else if ( called_from_distrib_mesh ) {
+    /* Initial distribution: only the root owns groups, so it is the only
+     * sender (scatter of the groups) */
+    k = parmesh->info.root;
+    for ( j=0; j<nprocs; ++j ) {
+      if ( j==k ) {
+        continue;
+      }
+      err =  PMMG_transfer_grps_fromItoJ(parmesh,k,j,interaction_map,called_from_distrib_mesh);
+      ier = MG_MIN ( ier,err );
+    }
+  }
   else {
     for ( k=0; k<nprocs; ++k ) {
       for ( j=0; j<nprocs; ++j ) {
@@ -2062,20 +2216,7 @@ int PMMG_distribute_grps( PMMG_pParMesh parmesh, int repartitioning_mode ) {
 
   } else {
 
-    switch ( parmesh->info.loadbalancing_mode ) {
-
-#ifdef USE_PARMETIS
-    case PMMG_LOADBALANCING_parmetis:
-      ier = PMMG_part_parmeshGrps2parmetis(parmesh,part,parmesh->nprocs);
-      break;
-#endif
-
-    case PMMG_LOADBALANCING_metis:
-    default:
-
-      ier = PMMG_part_parmeshGrps2metis(parmesh,part,parmesh->nprocs);
-      break;
-    }
+    ier = PMMG_part_parmeshGrps(parmesh,part,parmesh->nprocs);
   }
 
   if ( !ier )
@@ -64,6 +64,8 @@ void PMMG_listgrp_free( PMMG_pParMesh parmesh, PMMG_pGrp *listgrp, int ngrp )
 {
   int k;
 
+  if ( !*listgrp ) return;
+
   for ( k = 0; k < ngrp; ++k )
     PMMG_grp_free( parmesh, listgrp[0] + k );
 
@@ -91,6 +93,13 @@ void PMMG_grp_free( PMMG_pParMesh parmesh, PMMG_pGrp grp )
                               &grp->face2int_face_comm_index2,
                               &grp->nitem_int_face_comm);
 
+  PMMG_DEL_MEM(parmesh,grp->faceAreas,double,"faceAreas");
+  PMMG_DEL_MEM(parmesh,grp->triaNormals,double,"triaNormals");
+  PMMG_DEL_MEM(parmesh,grp->nodeTrias,int,"nodeTrias");
+
+  /* Background groups of frozen groups are empty */
+  if ( !grp->mesh ) return;
+
   MMG3D_Free_all( MMG5_ARG_start,
                   MMG5_ARG_ppMesh, &grp->mesh,
                   MMG5_ARG_ppSols, &grp->field,
@@ -130,6 +139,7 @@ void PMMG_parmesh_Free_Comm( PMMG_pParMesh parmesh )
 void PMMG_parmesh_Free_Listgrp( PMMG_pParMesh parmesh )
 {
   PMMG_listgrp_free( parmesh, &parmesh->listgrp, parmesh->ngrp );
+  PMMG_listgrp_free( parmesh, &parmesh->old_listgrp, parmesh->nold_grp );
 }
 
 /**
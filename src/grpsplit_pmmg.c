@@ -204,20 +204,21 @@ static int PMMG_f2ifcAppend( PMMG_pParMesh parmesh, PMMG_pGrp grp, int *max,
  * communication structures, info.inputMet == 1 if a metrics is provided by the
  * user).
  *
+ * The background group only stores what the interpolation reads: the points,
+ * the tetra and their adjacency, the boundary triangles, the user metric and
+ * the solution fields. The level-set and the displacement are not kept and the
+ * solution fields are handed off from the current group instead of being
+ * copied (see \ref PMMG_oldGrp_handOffFields).
+ *
  */
 int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
   MMG5_pMesh const meshOld  = parmesh->listgrp[igrp].mesh;
   MMG5_pSol  const metOld   = parmesh->listgrp[igrp].met;
-  MMG5_pSol  const dispOld  = parmesh->listgrp[igrp].disp;
-  MMG5_pSol  const lsOld    = parmesh->listgrp[igrp].ls;
   MMG5_pSol  const fieldOld = parmesh->listgrp[igrp].field;
   PMMG_pGrp        grp;
   MMG5_pMesh       mesh;
-  MMG5_pSol        met,ls,disp,field,psl,pslOld;
-  MMG5_pTetra      pt,ptCur;
-  MMG5_pPoint      ppt,pptCur;
+  MMG5_pSol        met,field,psl,pslOld;
   MMG5_Hash        hash;
-  int              *adja,*oldAdja;
   int              ie,ip,is;
 
   grp = &parmesh->old_listgrp[igrp];
@@ -238,23 +239,6 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
   /* Set maximum memory */
   mesh->memMax = parmesh->memGloMax;
 
-  if ( lsOld ) {
-    PMMG_CALLOC(parmesh,grp->ls,1,MMG5_Sol,"ls",return 0);
-    ls = grp->ls;
-  }
-  else {
-    ls = NULL;
-  }
-
-  if ( dispOld ) {
-    assert ( meshOld->nsols );
-    PMMG_CALLOC(parmesh,grp->disp,1,MMG5_Sol,"disp",return 0);
-    disp = grp->disp;
-  }
-  else {
-    disp = NULL;
-  }
-
   if ( meshOld->nsols ) {
     assert ( fieldOld );
     mesh->nsols = meshOld->nsols;
@@ -267,16 +251,12 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
 
   /** 1) Create old group */
 
-  /* Copy the mesh and metric,ls,disp and fields filenames */
+  /* Copy the mesh, metric and fields filenames */
   if ( !MMG5_Set_inputMeshName(  mesh,meshOld->namein) )      return 0;
   if ( !MMG5_Set_inputSolName(   mesh,met,metOld->namein ) )  return 0;
-  if ( ls   && !MMG5_Set_inputSolName( mesh,ls,lsOld->namein     ) )  return 0;
-  if ( disp && !MMG5_Set_inputSolName( mesh,disp,dispOld->namein ) )  return 0;
 
   if ( !MMG5_Set_outputMeshName( mesh,meshOld->nameout ) )    return 0;
   if ( !MMG5_Set_outputSolName(  mesh,met,metOld->nameout ) ) return 0;
-  if ( ls   && !MMG5_Set_outputSolName( mesh,  ls,lsOld->nameout   ) ) return 0;
-  if ( disp && !MMG5_Set_outputSolName( mesh,disp,dispOld->nameout ) ) return 0;
 
   if ( field ) {
     for ( is=0; is<mesh->nsols; ++is ) {
@@ -299,30 +279,22 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
       return 0;
   }
 
-  /* Set ls size */
-  if ( lsOld && lsOld->m ) {
-    assert ( lsOld->np );
-    if ( !MMG3D_Set_solSize(mesh,ls,MMG5_Vertex,lsOld->np,lsOld->type) )
-      return 0;
-  }
-
-  /* Set disp size */
-  if ( dispOld && dispOld->m ) {
-    assert ( dispOld->np );
-    if ( !MMG3D_Set_solSize(mesh,disp,MMG5_Vertex,dispOld->np,dispOld->type) )
-      return 0;
-  }
-
-  /* Set fields size */
+  /* Set fields size (the values are handed off by PMMG_oldGrp_handOffFields
+   * just before the remeshing) */
   if ( meshOld->nsols ) {
     assert ( field );
     for ( is=0; is<meshOld->nsols; ++is ) {
       psl    = field + is;
       pslOld = fieldOld + is;
-      psl->ver = 2;
-
-      if ( !MMG3D_Set_solSize(mesh,psl,MMG5_Vertex,meshOld->np,pslOld->type) )
-        return 0;
+      psl->ver      = 2;
+      psl->dim      = pslOld->dim;
+      psl->entities = pslOld->entities;
+      psl->type     = pslOld->type;
+      psl->size     = pslOld->size;
+      psl->np       = meshOld->np;
+      psl->npi      = meshOld->np;
+      psl->npmax    = 0;
+      psl->m        = NULL;
     }
   }
 
@@ -330,72 +302,28 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
    * options */
   if ( !PMMG_copy_mmgInfo ( &meshOld->info,&mesh->info ) ) return 0;
 
-  /* Loop on tetras */
+  /* Copy the tetra and their adjacency (unused tetra are copied too, they are
+   * not valid in the background mesh neither), skip the xtetra */
+  memcpy( &mesh->tetra[1],&meshOld->tetra[1],meshOld->ne*sizeof(MMG5_Tetra) );
   for ( ie = 1; ie < meshOld->ne+1; ++ie ) {
-    pt = &meshOld->tetra[ie];
-    ptCur = &mesh->tetra[ie];
-
-    if ( !MG_EOK(pt) ) continue;
-
-    /* Copy tetra */
-    memcpy( ptCur, pt, sizeof(MMG5_Tetra) );
-
-    /* Copy element's adjacency */
-    assert( meshOld->adja );
-    if( meshOld->adja ) {
-      adja    =    &mesh->adja[ 4*( ie-1 )+1 ];
-      oldAdja = &meshOld->adja[ 4*( ie-1 )+1 ];
-      memcpy( adja, oldAdja, 4*sizeof(int) );
-    }
-
-    /* Skip xtetra */
-    ptCur->xt = 0;
+    mesh->tetra[ie].xt = 0;
+  }
 
+  assert( meshOld->adja );
+  if( meshOld->adja ) {
+    memcpy( &mesh->adja[1],&meshOld->adja[1],4*meshOld->ne*sizeof(int) );
   }
 
-  /* Loop on points */
+  /* Copy the points, skip the xpoints */
+  memcpy( &mesh->point[1],&meshOld->point[1],meshOld->np*sizeof(MMG5_Point) );
   for ( ip = 1; ip < meshOld->np+1; ++ip ) {
-    ppt = &meshOld->point[ip];
-    pptCur = &mesh->point[ip];
-
-    if ( !MG_VOK(ppt) ) {
-
-      /* Only copy the tag (to detect the not VOK point) */
-      pptCur->tag = ppt->tag;
-
-    } else {
-
-      /* Copy point */
-      memcpy( pptCur, ppt, sizeof(MMG5_Point) );
-
-      /* Copy metrics */
-      if ( parmesh->info.inputMet == 1 ) {
-        memcpy( &met->m[ ip*met->size ], &metOld->m[ip*met->size], met->size*sizeof(double) );
-      }
-
-      /* Copy ls */
-      if ( ls && ls->m ) {
-        assert ( lsOld && lsOld->m );
-        memcpy( &ls->m[ ip*ls->size ], &lsOld->m[ip*ls->size], ls->size*sizeof(double) );
-      }
-
-      /* Copy disp */
-      if ( disp && disp->m ) {
-        assert ( dispOld && dispOld->m );
-        memcpy( &disp->m[ ip*disp->size ], &dispOld->m[ip*dispOld->size], disp->size*sizeof(double) );
-      }
-
-      /* Copy fields */
-      for ( is=0; is<mesh->nsols; ++is ) {
-        psl    = field + is;
-        pslOld = fieldOld + is;
-        assert ( psl && pslOld );
-        memcpy( &psl->m[ ip*psl->size ], &pslOld->m[ip*pslOld->size], psl->size*sizeof(double) );
-      }
+    mesh->point[ip].xp = 0;
+  }
 
-      /* Skip xpoint */
-      pptCur->xp = 0;
-    }
+  /* Copy metrics */
+  if ( parmesh->info.inputMet == 1 ) {
+    memcpy( &met->m[met->size],&metOld->m[met->size],
+            meshOld->np*met->size*sizeof(double) );
   }
 
   /** 1) Create the boundary on the background mesh */
@@ -1251,12 +1179,55 @@ int PMMG_splitGrps_cleanMesh( PMMG_pParMesh parmesh,PMMG_pGrp grp,int np )
   return 1;
 }
 
+/**
+ * \param grp pointer toward the current group
+ * \param oldGrp pointer toward the matching background group
+ *
+ * Move the solution fields of the current group into the background group
+ * without copying them. Called after a successful remeshing: the current values
+ * are rebuilt by the interpolation, so the arrays of the current group are
+ * reallocated (see \ref PMMG_remesh_grp). The memory counters of the two
+ * meshes are updated accordingly.
+ *
+ * \remark Only \a grp and \a oldGrp are modified, so different groups can be
+ * handled concurrently.
+ *
+ */
+void PMMG_oldGrp_handOffFields( PMMG_pGrp grp,PMMG_pGrp oldGrp ) {
+  MMG5_pMesh mesh,oldMesh;
+  MMG5_pSol  psl,oldPsl;
+  size_t     size;
+  int        is;
+
+  mesh    = grp->mesh;
+  oldMesh = oldGrp->mesh;
+
+  for ( is=0; is<mesh->nsols; ++is ) {
+    psl    = grp->field + is;
+    oldPsl = oldGrp->field + is;
+
+    if ( !psl->m ) continue;
+    assert ( !oldPsl->m );
+
+    size = (size_t)psl->size*(psl->npmax+1)*sizeof(double);
+
+    oldPsl->m     = psl->m;
+    oldPsl->npmax = psl->npmax;
+    oldMesh->memCur += size;
+
+    psl->m = NULL;
+    assert ( mesh->memCur >= size );
+    mesh->memCur -= size;
+  }
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  *
  * \return 0 if fail, 1 if success
  *
- * Copy all groups from the current to the background list.
+ * Copy all groups from the current to the background list. Frozen groups are
+ * not interpolated so their background group is left empty.
  *
  */
 int PMMG_update_oldGrps( PMMG_pParMesh parmesh ) {
@@ -1272,6 +1243,8 @@ int PMMG_update_oldGrps( PMMG_pParMesh parmesh ) {
   /** Copy every group */
   for ( grpId = 0; grpId < parmesh->ngrp; ++grpId ) {
 
+    if ( parmesh->listgrp[grpId].frozen ) continue;
+
     /* New group initialisation */
     /* New group initialisation and fill */
     if ( !PMMG_create_oldGrp( parmesh, grpId ) ) {
@@ -1778,7 +1751,7 @@ int PMMG_splitPart_grps( PMMG_pParMesh parmesh,int target,int fitMesh,int redist
       if ( (redistrMode == PMMG_REDISTRIBUTION_ifc_displacement) &&
            (parmesh->info.imprim > PMMG_VERB_ITWAVES) )
         fprintf(stdout,"\n         calling Metis on proc%d\n\n",parmesh->myrank);
-      if ( !PMMG_part_meshElts2metis(parmesh, part, ngrp) ) {
+      if ( !PMMG_part_meshElts(parmesh, part, ngrp) ) {
         ret_val = 0;
         goto fail_part;
       }
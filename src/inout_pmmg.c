@@ -1599,6 +1599,70 @@ static int PMMG_saveHeader_hdf5(PMMG_pParMesh parmesh, hid_t file_id) {
   return 1;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param loc_id identifier of the HDF5 group in which to create the dataset.
+ * \param name name of the dataset.
+ * \param type_id datatype of the dataset.
+ * \param dspace_id identifier of the dataspace of the dataset in the file.
+ * \param dcpl_id identifier of the dataset creation property list (no fill value).
+ * \param compress 1 if the dataset can be compressed, 0 otherwise.
+ *
+ * \return the identifier of the created dataset (negative if fail).
+ *
+ * Create a dataset with the chunking asked by the user (chunks of
+ * parmesh->info.h5Chunk entities, the other dimensions being stored entirely),
+ * and, for the datasets that can be compressed, the shuffle and deflate
+ * filters if parmesh->info.h5Deflate is set (compressed datasets are always
+ * chunked). Empty datasets and contiguous layouts use \a dcpl_id unchanged.
+ *
+ */
+static hid_t PMMG_Dcreate_hdf5(PMMG_pParMesh parmesh, hid_t loc_id, const char *name,
+                               hid_t type_id, hid_t dspace_id, hid_t dcpl_id, int compress) {
+  hsize_t dims[2] = {0, 0}, cdims[2];
+  hid_t   lcpl_id, dset_id;
+  int     ndims, deflate;
+
+  deflate = compress ? parmesh->info.h5Deflate : 0;
+
+  if ( deflate && !H5Zfilter_avail(H5Z_FILTER_DEFLATE) ) {
+    if ( parmesh->myrank == parmesh->info.root && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+      fprintf(stderr,"\n  ## Warning: %s: deflate filter not available in the HDF5"
+              " library. %s saved without compression.\n",__func__,name);
+    }
+    deflate = 0;
+  }
+
+  ndims = H5Sget_simple_extent_ndims(dspace_id);
+  if ( ndims == 1 || ndims == 2 ) {
+    H5Sget_simple_extent_dims(dspace_id, dims, NULL);
+  }
+
+  if ( (!parmesh->info.h5Chunk && !deflate) || ndims < 1 || ndims > 2 || !dims[0] ) {
+    /* Contiguous layout (an empty dataset can't be chunked) */
+    return H5Dcreate(loc_id, name, type_id, dspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+  }
+
+  /* The chunks of a fixed size dataset can't be larger than the dataset */
+  cdims[0] = parmesh->info.h5Chunk ? parmesh->info.h5Chunk : PMMG_H5_CHUNK;
+  cdims[0] = MG_MIN(cdims[0], dims[0]);
+  if ( ndims == 2 ) cdims[1] = dims[1];
+
+  /* Chunks allocated at creation as needed by the parallel filtered writes */
+  lcpl_id = H5Pcopy(dcpl_id);
+  H5Pset_chunk(lcpl_id, ndims, cdims);
+  H5Pset_alloc_time(lcpl_id, H5D_ALLOC_TIME_EARLY);
+  if ( deflate ) {
+    H5Pset_shuffle(lcpl_id);
+    H5Pset_deflate(lcpl_id, deflate);
+  }
+
+  dset_id = H5Dcreate(loc_id, name, type_id, dspace_id, H5P_DEFAULT, lcpl_id, H5P_DEFAULT);
+  H5Pclose(lcpl_id);
+
+  return dset_id;
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param grp_entities_id identifier of the HDF5 group in which to write the mesh entities.
@@ -1825,7 +1889,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(2, hnp, NULL);
     dspace_file_id = H5Screate_simple(2, hnpg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Vertex], NULL, hnp, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "Vertices", H5T_NATIVE_DOUBLE, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Vertices", H5T_NATIVE_DOUBLE, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, dspace_mem_id, dspace_file_id, dxpl_id, ppoint);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -1835,7 +1899,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(1, hnp, NULL);
     dspace_file_id = H5Screate_simple(1, hnpg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Vertex], NULL, hnp, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "VerticesRef", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "VerticesRef", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pref);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -1846,7 +1910,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nc, NULL);
       dspace_file_id = H5Screate_simple(1, &ncg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Corner], NULL, &nc, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "Corners", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Corners", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pcr);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1858,7 +1922,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &npreq, NULL);
       dspace_file_id = H5Screate_simple(1, &npreqg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_RequiredVertex], NULL, &npreq, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "RequiredVertices", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "RequiredVertices", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, preq);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1870,7 +1934,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nppar, NULL);
       dspace_file_id = H5Screate_simple(1, &npparg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_ParallelVertex], NULL, &nppar, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "ParallelVertices", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "ParallelVertices", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, ppar);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1882,7 +1946,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(2, hnnor, NULL);
       dspace_file_id = H5Screate_simple(2, hnnorg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Normal], NULL, hnnor, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "Normals", H5T_NATIVE_DOUBLE, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Normals", H5T_NATIVE_DOUBLE, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, dspace_mem_id, dspace_file_id, dxpl_id, pnor);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1892,7 +1956,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, hnnor, NULL);
       dspace_file_id = H5Screate_simple(1, hnnorg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Normal], NULL, hnnor, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "NormalsAtVertices", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "NormalsAtVertices", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pnorat);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1904,7 +1968,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(2, hntan, NULL);
       dspace_file_id = H5Screate_simple(2, hntang, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Tangent], NULL, hntan, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "Tangents", H5T_NATIVE_DOUBLE, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Tangents", H5T_NATIVE_DOUBLE, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, dspace_mem_id, dspace_file_id, dxpl_id, ptan);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1914,7 +1978,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, hntan, NULL);
       dspace_file_id = H5Screate_simple(1, hntang, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Tangent], NULL, hntan, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "TangentsAtVertices", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "TangentsAtVertices", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, ptanat);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1952,7 +2016,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(2, hna, NULL);
     dspace_file_id = H5Screate_simple(2, hnag, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Edge], NULL, hna, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "Edges", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Edges", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pent);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -1962,7 +2026,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(1, hna, NULL);
     dspace_file_id = H5Screate_simple(1, hnag, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Edge], NULL, hna, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "EdgesRef", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "EdgesRef", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pref);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -1973,7 +2037,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nr, NULL);
       dspace_file_id = H5Screate_simple(1, &nrg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Ridge], NULL, &nr, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "Ridges", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Ridges", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pcr);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1985,7 +2049,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nedreq, NULL);
       dspace_file_id = H5Screate_simple(1, &nedreqg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_RequiredEdge], NULL, &nedreq, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "RequiredEdges", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "RequiredEdges", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, preq);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -1997,7 +2061,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nedpar, NULL);
       dspace_file_id = H5Screate_simple(1, &nedparg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_ParallelEdge], NULL, &nedpar, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "ParallelEdges", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "ParallelEdges", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, ppar);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -2041,7 +2105,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(2, hnt, NULL);
     dspace_file_id = H5Screate_simple(2, hntg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Tria], NULL, hnt, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "Triangles", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Triangles", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pent);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -2051,7 +2115,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(1, hnt, NULL);
     dspace_file_id = H5Screate_simple(1, hntg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Tria], NULL, hnt, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "TrianglesRef", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "TrianglesRef", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pref);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -2062,7 +2126,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &ntreq, NULL);
       dspace_file_id = H5Screate_simple(1, &ntreqg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_RequiredTria], NULL, &ntreq, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "RequiredTriangles", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "RequiredTriangles", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, preq);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -2074,7 +2138,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &ntpar, NULL);
       dspace_file_id = H5Screate_simple(1, &ntparg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_ParallelTria], NULL, &ntpar, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "ParallelTriangles", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "ParallelTriangles", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, ppar);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -2121,7 +2185,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(2, hnquad, NULL);
     dspace_file_id = H5Screate_simple(2, hnquadg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Quad], NULL, hnquad, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "Quadrilaterals", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Quadrilaterals", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pent);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -2131,7 +2195,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(1, hnquad, NULL);
     dspace_file_id = H5Screate_simple(1, hnquadg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Quad], NULL, hnquad, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "QuadrilateralsRef", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "QuadrilateralsRef", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pref);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -2142,7 +2206,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nqreq, NULL);
       dspace_file_id = H5Screate_simple(1, &nqreqg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_RequiredQuad], NULL, &nqreq, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "RequiredQuadrilaterals", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "RequiredQuadrilaterals", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, preq);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -2154,7 +2218,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nqpar, NULL);
       dspace_file_id = H5Screate_simple(1, &nqparg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_ParallelQuad], NULL, &nqpar, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "ParallelQuadrilaterals", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "ParallelQuadrilaterals", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, ppar);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -2191,7 +2255,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(2, hne, NULL);
     dspace_file_id = H5Screate_simple(2, hneg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Tetra], NULL, hne, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "Tetrahedra", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Tetrahedra", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pent);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -2201,7 +2265,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(1, hne, NULL);
     dspace_file_id = H5Screate_simple(1, hneg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Tetra], NULL, hne, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "TetrahedraRef", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "TetrahedraRef", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pref);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -2212,7 +2276,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nereq, NULL);
       dspace_file_id = H5Screate_simple(1, &nereqg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_RequiredTetra], NULL, &nereq, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "RequiredTetrahedra", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "RequiredTetrahedra", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, preq);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -2224,7 +2288,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
       dspace_mem_id  = H5Screate_simple(1, &nepar, NULL);
       dspace_file_id = H5Screate_simple(1, &neparg, NULL);
       H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_ParallelTetra], NULL, &nepar, NULL);
-      dset_id = H5Dcreate(grp_entities_id, "ParallelTetrahedra", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+      dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "ParallelTetrahedra", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
       H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, ppar);
       H5Dclose(dset_id);
       H5Sclose(dspace_mem_id);
@@ -2251,7 +2315,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(2, hnprism, NULL);
     dspace_file_id = H5Screate_simple(2, hnprismg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Prism], NULL, hnprism, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "Prisms", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "Prisms", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pent);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -2261,7 +2325,7 @@ static int PMMG_saveMeshEntities_hdf5(PMMG_pParMesh parmesh, hid_t grp_entities_
     dspace_mem_id  = H5Screate_simple(1, hnprism, NULL);
     dspace_file_id = H5Screate_simple(1, hnprismg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &offset[2 * PMMG_IO_Prism], NULL, hnprism, NULL);
-    dset_id = H5Dcreate(grp_entities_id, "PrismsRef", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_entities_id, "PrismsRef", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
     H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, pref);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -2366,7 +2430,7 @@ static int PMMG_savePartitioning_hdf5(PMMG_pParMesh parmesh, hid_t grp_part_id,
   /* Write the number of entities per proc */
   hsize_t hn[2] = {nprocs, PMMG_IO_ENTITIES_size};
   dspace_file_id = H5Screate_simple(2, hn, NULL);
-  dset_id = H5Dcreate(grp_part_id, "NumberOfEntities", H5T_NATIVE_HSIZE, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+  dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "NumberOfEntities", H5T_NATIVE_HSIZE, dspace_file_id, dcpl_id, 0);
   if (rank == parmesh->info.root)
     H5Dwrite(dset_id, H5T_NATIVE_HSIZE, H5S_ALL, H5S_ALL, H5P_DEFAULT, nentities);
   H5Dclose(dset_id);
@@ -2423,9 +2487,9 @@ static int PMMG_savePartitioning_hdf5(PMMG_pParMesh parmesh, hid_t grp_part_id,
   hsize_t hnprocs = nprocs;
   dspace_file_id = H5Screate_simple(1, &hnprocs, NULL);
   if (parmesh->info.API_mode == PMMG_APIDISTRIB_faces)
-    dset_id = H5Dcreate(grp_part_id, "NumberOfFaceCommunicators", H5T_NATIVE_HSIZE, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "NumberOfFaceCommunicators", H5T_NATIVE_HSIZE, dspace_file_id, dcpl_id, 0);
   else
-    dset_id = H5Dcreate(grp_part_id, "NumberOfNodeCommunicators", H5T_NATIVE_HSIZE, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "NumberOfNodeCommunicators", H5T_NATIVE_HSIZE, dspace_file_id, dcpl_id, 0);
   if (rank == parmesh->info.root)
     H5Dwrite(dset_id, H5T_NATIVE_HSIZE, H5S_ALL, H5S_ALL, H5P_DEFAULT, ncomms);
   H5Dclose(dset_id);
@@ -2436,14 +2500,14 @@ static int PMMG_savePartitioning_hdf5(PMMG_pParMesh parmesh, hid_t grp_part_id,
   dspace_file_id = H5Screate_simple(1, &ncommg, NULL);
   H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &comm_offset, NULL, &ncomms[rank], NULL);
 
-  dset_id = H5Dcreate(grp_part_id, "ColorsOut", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+  dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "ColorsOut", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
   H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, colors);
   H5Dclose(dset_id);
 
   if (parmesh->info.API_mode == PMMG_APIDISTRIB_faces)
-    dset_id = H5Dcreate(grp_part_id, "NumberOfCommunicatorFaces", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "NumberOfCommunicatorFaces", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
   else
-    dset_id = H5Dcreate(grp_part_id, "NumberOfCommunicatorNodes", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "NumberOfCommunicatorNodes", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
 
   H5Dwrite(dset_id, H5T_NATIVE_HSIZE, dspace_mem_id, dspace_file_id, dxpl_id, nitem);
   H5Dclose(dset_id);
@@ -2504,9 +2568,9 @@ static int PMMG_savePartitioning_hdf5(PMMG_pParMesh parmesh, hid_t grp_part_id,
   dspace_file_id = H5Screate_simple(1, &nitemg, NULL);
 
   if (parmesh->info.API_mode == PMMG_APIDISTRIB_faces)
-    dset_id = H5Dcreate(grp_part_id, "LocalFaceIndices", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "LocalFaceIndices", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
   else
-    dset_id = H5Dcreate(grp_part_id, "LocalNodeIndices", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "LocalNodeIndices", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
   dspace_mem_id = H5Screate_simple(1, &nitem_proc[rank], NULL);
   H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &rank_offset, NULL, &nitem_proc[rank], NULL);
   H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, loc_buf);
@@ -2515,9 +2579,9 @@ static int PMMG_savePartitioning_hdf5(PMMG_pParMesh parmesh, hid_t grp_part_id,
 
   /* Write the global indices */
   if (parmesh->info.API_mode == PMMG_APIDISTRIB_faces)
-    dset_id = H5Dcreate(grp_part_id, "GlobalFaceIndices", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "GlobalFaceIndices", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
   else
-    dset_id = H5Dcreate(grp_part_id, "GlobalNodeIndices", H5T_NATIVE_INT, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_part_id, "GlobalNodeIndices", H5T_NATIVE_INT, dspace_file_id, dcpl_id, 0);
   dspace_mem_id = H5Screate_simple(1, &nitem_proc[rank], NULL);
   H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, &rank_offset, NULL, &nitem_proc[rank], NULL);
   H5Dwrite(dset_id, H5T_NATIVE_INT, dspace_mem_id, dspace_file_id, dxpl_id, glob_buf);
@@ -2558,6 +2622,7 @@ static int PMMG_savePartitioning_hdf5(PMMG_pParMesh parmesh, hid_t grp_part_id,
 }
 
 /**
+ * \param parmesh pointer toward the parmesh structure.
  * \param mesh pointer toward the mesh associated to the solution.
  * \param sol pointer toward the solution structure to save.
  * \param dset_id identifier of the HDF5 group in which to write the solution.
@@ -2569,13 +2634,14 @@ static int PMMG_savePartitioning_hdf5(PMMG_pParMesh parmesh, hid_t grp_part_id,
  *
  * \return 0 if fail, 1 otherwise
  *
- * Save at hdf5 format a given solution structure defined at vertices.
+ * Save at hdf5 format a given solution structure defined at vertices (with
+ * shuffle+deflate compression if parmesh->info.h5Deflate is set).
  *
  */
 static
-int PMMG_saveSolAtVertices_hdf5(MMG5_pMesh mesh,MMG5_pSol sol,hid_t grp_sol_id,
-                                hid_t dcpl_id,hid_t dxpl_id,int np,int npg,
-                                hsize_t *offset) {
+int PMMG_saveSolAtVertices_hdf5(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_pSol sol,
+                                hid_t grp_sol_id,hid_t dcpl_id,hid_t dxpl_id,
+                                int np,int npg,hsize_t *offset) {
   int         mcount;
   MMG5_pPoint ppt;
   double      *sol_buf;
@@ -2605,7 +2671,7 @@ int PMMG_saveSolAtVertices_hdf5(MMG5_pMesh mesh,MMG5_pSol sol,hid_t grp_sol_id,
   dspace_mem_id = H5Screate_simple(2, hns, NULL);
   dspace_file_id = H5Screate_simple(2, hnsg, NULL);
   H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, sol_offset, NULL, hns, NULL);
-  dset_id = H5Dcreate(grp_sol_id, "SolAtVertices", H5T_NATIVE_DOUBLE, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+  dset_id = PMMG_Dcreate_hdf5(parmesh, grp_sol_id, "SolAtVertices", H5T_NATIVE_DOUBLE, dspace_file_id, dcpl_id, 1);
   H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, dspace_mem_id, dspace_file_id, dxpl_id, sol_buf);
   H5Dclose(dset_id);
   H5Sclose(dspace_mem_id);
@@ -2666,7 +2732,7 @@ static int PMMG_saveMetric_hdf5(PMMG_pParMesh parmesh, hid_t grp_sols_id, hid_t
              fprintf(stderr,"\n  ## Error: %s: Could not create the /Solutions/Metric group.\n",__func__);
              return 0 );
 
-  ier = PMMG_saveSolAtVertices_hdf5(mesh,met,grp_sol_id,dcpl_id,dxpl_id,np,npg,offset);
+  ier = PMMG_saveSolAtVertices_hdf5(parmesh,mesh,met,grp_sol_id,dcpl_id,dxpl_id,np,npg,offset);
 
   if (!ier) {
     if (parmesh->myrank == parmesh->info.root) {
@@ -2731,7 +2797,7 @@ static int PMMG_saveLs_hdf5(PMMG_pParMesh parmesh, hid_t grp_sols_id, hid_t dcpl
              H5Gclose(grp_sols_id);
              return 0 );
 
-  ier = PMMG_saveSolAtVertices_hdf5(mesh,ls,grp_sol_id,dcpl_id,dxpl_id,np,npg,offset);
+  ier = PMMG_saveSolAtVertices_hdf5(parmesh,mesh,ls,grp_sol_id,dcpl_id,dxpl_id,np,npg,offset);
 
   if (!ier) {
     if (parmesh->myrank == parmesh->info.root) {
@@ -2877,7 +2943,7 @@ static int PMMG_saveAllSols_hdf5(PMMG_pParMesh parmesh, hid_t grp_sols_id, hid_t
     dspace_mem_id = H5Screate_simple(2, hns, NULL);
     dspace_file_id = H5Screate_simple(2, hnsg, NULL);
     H5Sselect_hyperslab(dspace_file_id, H5S_SELECT_SET, sol_offset, NULL, hns, NULL);
-    dset_id = H5Dcreate(grp_sol_id, solname, H5T_NATIVE_DOUBLE, dspace_file_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    dset_id = PMMG_Dcreate_hdf5(parmesh, grp_sol_id, solname, H5T_NATIVE_DOUBLE, dspace_file_id, dcpl_id, 1);
     H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, dspace_mem_id, dspace_file_id, dxpl_id, sol_buf);
     H5Dclose(dset_id);
     H5Sclose(dspace_mem_id);
@@ -3081,6 +3147,8 @@ int PMMG_saveMesh_hdf5_i(PMMG_pParMesh parmesh, int *save_entities, const char *
   hid_t      file_id, grp_mesh_id, grp_part_id, grp_entities_id, grp_sols_id; /* HDF5 objects */
   hid_t      fapl_id, dxpl_id, dcpl_id;                                       /* HDF5 property lists */
   MPI_Info   info = MPI_INFO_NULL;
+  hsize_t    fsize;                                                           /* Size of the written file */
+  double     twrite;                                                          /* Time spent in the HDF5 writes */
   mytime     ctim[TIMEMAX];
   int8_t     tim;
   char       stim[32];
@@ -3209,19 +3277,28 @@ int PMMG_saveMesh_hdf5_i(PMMG_pParMesh parmesh, int *save_entities, const char *
   HDF_CHECK( H5Eset_auto(H5E_DEFAULT, NULL, NULL),
              goto free_and_return );
 
-  /* TODO ? Pass MPI hints via the info struct */
-  MPI_Info_create(&info);
+  /* MPI-IO hints (collective buffering and striping) */
+  if ( !PMMG_mpiio_hints(parmesh, &info) ) {
+    fprintf(stderr,"\n  ## Warning: %s: Rank %d could not set the MPI-IO hints.\n",
+            __func__, parmesh->myrank);
+  }
 
   /* Create the property lists */
   fapl_id = H5Pcreate(H5P_FILE_ACCESS);
   H5Pset_fapl_mpio(fapl_id, parmesh->comm, info);
   H5Pset_coll_metadata_write(fapl_id, 1);
+  if ( info != MPI_INFO_NULL ) MPI_Info_free(&info);
+  if ( parmesh->info.mpiioStripeSize ) {
+    /* Align the large datasets on the file stripes */
+    H5Pset_alignment(fapl_id, 65536, (hsize_t)parmesh->info.mpiioStripeSize*1024);
+  }
   dxpl_id = H5Pcreate(H5P_DATASET_XFER);
   H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE);
   dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
   H5Pset_fill_time(dcpl_id, H5D_FILL_TIME_NEVER);
 
   /* Create the file */
+  twrite = MPI_Wtime();
   HDF_CHECK( file_id = H5Fcreate(h5_name, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id),
              fprintf(stderr,"\n  ## Error: %s: Rank %d could not create the hdf5 file %s.\n",
                      __func__, parmesh->myrank, h5_name);
@@ -3385,11 +3462,21 @@ int PMMG_saveMesh_hdf5_i(PMMG_pParMesh parmesh, int *save_entities, const char *
   }
 
   /* Release all HDF5 IDs */
+  fsize = 0;
+  H5Fget_filesize(file_id, &fsize);
   H5Fclose(file_id);
   H5Pclose(fapl_id);
   H5Pclose(dxpl_id);
   H5Pclose(dcpl_id);
 
+  /* Write bandwidth (the file is written when all the procs have closed it) */
+  twrite = MPI_Wtime() - twrite;
+  MPI_Allreduce(MPI_IN_PLACE, &twrite, 1, MPI_DOUBLE, MPI_MAX, parmesh->comm);
+  if ( parmesh->myrank == parmesh->info.root && parmesh->info.imprim >= PMMG_VERB_STEPS ) {
+    fprintf(stdout,"  -- HDF5 write: %.2f MB in %.3f s (%.2f MB/s)\n",
+            fsize/1048576., twrite, twrite > 0. ? fsize/1048576./twrite : 0.);
+  }
+
   /* We no longer need the offset nor the local nuumber of entities */
   PMMG_DEL_MEM(parmesh, offset, hsize_t, "offset");
   PMMG_DEL_MEM(parmesh, nentitiesl, hsize_t, "nentitiesl");
@@ -4690,28 +4777,117 @@ static int PMMG_loadLs_hdf5(PMMG_pParMesh parmesh, hid_t grp_sols_id, hid_t dxpl
  * \param nentitiesl array of number of local entities.
  * \param offset array of size PMMG_IO_ENTITIES_size containing the offset for parallel loading.
  *
- * \return 0 if fail and we want the calling process to fail too, -1 if fail but
- * we want to let the calling process continue, 0 if fields are succesfully
- * readed.
+ * \return 0 if fail and we want the calling process to fail too, -1 if there
+ * is no field to read, 1 if fields are succesfully readed.
  *
- * Load solutions fields at hdf5 format.
+ * Load solutions fields at hdf5 format. Only the fields at vertices are
+ * loaded (the fields at tetrahedra are ignored).
  *
  */
 static int  PMMG_loadAllSols_hdf5(PMMG_pParMesh parmesh, hid_t grp_sols_id,
                                   hid_t dxpl_id, hsize_t *nentitiesl,
                                   hsize_t *offset) {
+  MMG5_pMesh  mesh;
+  MMG5_pSol   sols;
+  hsize_t     hnsg[2] = {0, 0};
+  hid_t       grp_sol_id, attr_id, dset_id, dspace_file_id;
+  int         nsols, ntsols, np, ier, *typSol;
+  char        solname[32];
 
-  /* Get the metric size */
-  hid_t tmp = H5Gopen(grp_sols_id, "Fields", H5P_DEFAULT);
-  if ( tmp < 0) return -1;
+  assert ( parmesh->ngrp == 1 );
 
-  /* Input mesh has solution fields: hdf5 input is not yet implemented */
-  if (parmesh->myrank == parmesh->info.root) {
-    fprintf(stderr, "\n  ## Error: %s: Solution fields input not yet"
-            " implemented at hdf5 format.\n Ignored.\n", __func__);
+  mesh = parmesh->listgrp[0].mesh;
+  np   = nentitiesl[PMMG_IO_Vertex];
+
+  /* Open the fields group */
+  grp_sol_id = H5Gopen(grp_sols_id, "Fields", H5P_DEFAULT);
+  if ( grp_sol_id < 0 ) return -1;
+
+  /* Get the number of fields (see PMMG_saveAllSols_hdf5) */
+  nsols = ntsols = 0;
+  attr_id = H5Aopen(grp_sol_id, "NSolsAtVertices", H5P_DEFAULT);
+  if ( attr_id >= 0 ) {
+    H5Aread(attr_id, H5T_NATIVE_INT, &nsols);
+    H5Aclose(attr_id);
+  }
+  attr_id = H5Aopen(grp_sol_id, "NSolsAtTetrahedra", H5P_DEFAULT);
+  if ( attr_id >= 0 ) {
+    H5Aread(attr_id, H5T_NATIVE_INT, &ntsols);
+    H5Aclose(attr_id);
   }
 
-  return -1;
+  if ( ntsols && parmesh->myrank == parmesh->info.root ) {
+    fprintf(stderr, "\n  ## Warning: %s: solution fields at tetrahedra not"
+            " yet implemented at hdf5 format.\n Ignored.\n", __func__);
+  }
+
+  if ( !nsols ) {
+    H5Gclose(grp_sol_id);
+    return -1;
+  }
+
+  /* Get the type of the fields from their number of components */
+  PMMG_MALLOC(parmesh, typSol, nsols, int, "typSol",
+              H5Gclose(grp_sol_id); return 0);
+
+  ier = 1;
+  for ( int i = 0 ; i < nsols ; i++ ) {
+    snprintf(solname, sizeof(solname), "SolAtVertices%d", i);
+    dset_id = H5Dopen(grp_sol_id, solname, H5P_DEFAULT);
+    if ( dset_id < 0 ) {
+      ier = 0;
+      break;
+    }
+    dspace_file_id = H5Dget_space(dset_id);
+    H5Sget_simple_extent_dims(dspace_file_id, hnsg, NULL);
+    H5Sclose(dspace_file_id);
+    H5Dclose(dset_id);
+
+    if ( hnsg[1] == 1 )      typSol[i] = MMG5_Scalar;
+    else if ( hnsg[1] == 3 ) typSol[i] = MMG5_Vector;
+    else if ( hnsg[1] == 6 ) typSol[i] = MMG5_Tensor;
+    else {
+      ier = 0;
+      break;
+    }
+  }
+
+  if ( !ier ) {
+    if (parmesh->myrank == parmesh->info.root) {
+      fprintf(stderr, "\n  ## Error: %s: Wrong solution field %s.\n", __func__, solname);
+    }
+    PMMG_DEL_MEM(parmesh, typSol, int, "typSol");
+    H5Gclose(grp_sol_id);
+    return 0;
+  }
+
+  ier = PMMG_Set_solsAtVerticesSize(parmesh, nsols, np, typSol);
+  PMMG_DEL_MEM(parmesh, typSol, int, "typSol");
+
+  if ( !ier ) {
+    H5Gclose(grp_sol_id);
+    return 0;
+  }
+
+  /* Read the fields */
+  sols = parmesh->listgrp[0].field;
+  for ( int i = 0 ; i < nsols ; i++ ) {
+    snprintf(solname, sizeof(solname), "SolAtVertices%d", i);
+    dset_id = H5Dopen(grp_sol_id, solname, H5P_DEFAULT);
+    dspace_file_id = H5Dget_space(dset_id);
+
+    if ( !PMMG_loadSolAtVertices_hdf5(mesh,&sols[i],dspace_file_id,dset_id,dxpl_id,
+                                      np,offset,parmesh->info.imprim) ) {
+      ier = 0;
+    }
+
+    H5Sclose(dspace_file_id);
+    H5Dclose(dset_id);
+  }
+
+  H5Gclose(grp_sol_id);
+
+  return ier;
 }
 #endif
 
@@ -4793,6 +4969,12 @@ int PMMG_loadMesh_hdf5_i(PMMG_pParMesh parmesh, int *load_entities, const char *
   /* Shut HDF5 error stack */
   H5Eset_auto(H5E_DEFAULT, NULL, NULL);
 
+  /* MPI-IO hints (collective buffering) */
+  if ( !PMMG_mpiio_hints(parmesh, &info) ) {
+    fprintf(stderr,"\n  ## Warning: %s: Rank %d could not set the MPI-IO hints.\n",
+            __func__, rank);
+  }
+
   /** Open the file a first time to read npartin */
 
   /* Create the property lists */
@@ -4835,6 +5017,7 @@ int PMMG_loadMesh_hdf5_i(PMMG_pParMesh parmesh, int *load_entities, const char *
       fprintf(stderr,"\n  ## Error: %s: Can't read %d partitions with %d procs yet.\n",
               __func__, npartitions, nprocs);
     }
+    if ( info != MPI_INFO_NULL ) MPI_Info_free(&info);
     return 0;
   }
 
@@ -4856,6 +5039,7 @@ int PMMG_loadMesh_hdf5_i(PMMG_pParMesh parmesh, int *load_entities, const char *
   fapl_id = H5Pcreate(H5P_FILE_ACCESS);
   H5Pset_fapl_mpio(fapl_id, read_comm, info);    /* Parallel access to the file */
   H5Pset_all_coll_metadata_ops(fapl_id, 1);      /* Collective metadata read */
+  if ( info != MPI_INFO_NULL ) MPI_Info_free(&info);
 
   /* Reopen the file with the new communicator */
   HDF_CHECK( file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id),
@@ -5074,6 +5258,7 @@ int PMMG_loadMesh_hdf5_i(PMMG_pParMesh parmesh, int *load_entities, const char *
   H5Fclose(file_id);
   H5Pclose(fapl_id);
   H5Pclose(dxpl_id);
+  if ( info != MPI_INFO_NULL ) MPI_Info_free(&info);
   PMMG_DEL_MEM(parmesh, nentities, hsize_t, "nentities");
   PMMG_DEL_MEM(parmesh, nentitiesg, hsize_t, "nentitiesg");
   PMMG_DEL_MEM(parmesh, nentitiesl, hsize_t, "nentitiesl");
@@ -5083,3 +5268,236 @@ int PMMG_loadMesh_hdf5_i(PMMG_pParMesh parmesh, int *load_entities, const char *
 #endif
 
 }
+
+#ifdef USE_HDF5
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param file_id identifier of the HDF5 file.
+ *
+ * \return 1, there is no reason for this function to fail.
+ *
+ * Save the state of the adaptation loop (number of performed iterations,
+ * maximal number of iterations and whether the metric is prescribed) as
+ * attributes of the /Mesh group of the opened HDF5 file \a file_id.
+ *
+ */
+static int PMMG_saveState_hdf5(PMMG_pParMesh parmesh, hid_t file_id) {
+  hid_t      grp_mesh_id, dspace_id, attr_id;
+  int        iter, inputMet, rank, root;
+
+  rank = parmesh->myrank;
+  root = parmesh->info.root;
+
+  /* Iterations [0,parmesh->iter] have been performed */
+  iter     = parmesh->iter + 1;
+  inputMet = parmesh->info.inputMet;
+
+  grp_mesh_id = H5Gopen(file_id, "Mesh", H5P_DEFAULT);
+  dspace_id   = H5Screate(H5S_SCALAR);
+
+  attr_id = H5Acreate(grp_mesh_id, "Iteration", H5T_NATIVE_INT, dspace_id, H5P_DEFAULT, H5P_DEFAULT);
+  if (rank == root)
+    H5Awrite(attr_id, H5T_NATIVE_INT, &iter);
+  H5Aclose(attr_id);
+
+  attr_id = H5Acreate(grp_mesh_id, "NumberOfIterations", H5T_NATIVE_INT, dspace_id, H5P_DEFAULT, H5P_DEFAULT);
+  if (rank == root)
+    H5Awrite(attr_id, H5T_NATIVE_INT, &parmesh->niter);
+  H5Aclose(attr_id);
+
+  attr_id = H5Acreate(grp_mesh_id, "InputMetric", H5T_NATIVE_INT, dspace_id, H5P_DEFAULT, H5P_DEFAULT);
+  if (rank == root)
+    H5Awrite(attr_id, H5T_NATIVE_INT, &inputMet);
+  H5Aclose(attr_id);
+
+  H5Sclose(dspace_id);
+  H5Gclose(grp_mesh_id);
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param file_id identifier of the HDF5 file.
+ * \param iter pointer toward the number of iterations performed before the checkpoint.
+ * \param inputMet pointer toward the flag telling if the metric is prescribed.
+ *
+ * \return 0 if the file is not a checkpoint, 1 otherwise.
+ *
+ * Load the state of the adaptation loop stored in the opened HDF5 file \a
+ * file_id, and the number of partitions of the mesh.
+ *
+ */
+static int PMMG_loadState_hdf5(PMMG_pParMesh parmesh, hid_t file_id,
+                               int *iter, int *inputMet) {
+  hid_t grp_mesh_id, attr_id;
+
+  attr_id = H5Aopen(file_id, "NumberOfPartitions", H5P_DEFAULT);
+  if ( attr_id < 0 ) return 0;
+  H5Aread(attr_id, H5T_NATIVE_INT, &parmesh->info.npartin);
+  H5Aclose(attr_id);
+
+  grp_mesh_id = H5Gopen(file_id, "Mesh", H5P_DEFAULT);
+  if ( grp_mesh_id < 0 ) return 0;
+
+  attr_id = H5Aopen(grp_mesh_id, "Iteration", H5P_DEFAULT);
+  if ( attr_id < 0 ) {
+    H5Gclose(grp_mesh_id);
+    return 0;
+  }
+  H5Aread(attr_id, H5T_NATIVE_INT, iter);
+  H5Aclose(attr_id);
+
+  attr_id = H5Aopen(grp_mesh_id, "InputMetric", H5P_DEFAULT);
+  if ( attr_id < 0 ) {
+    H5Gclose(grp_mesh_id);
+    return 0;
+  }
+  H5Aread(attr_id, H5T_NATIVE_INT, inputMet);
+  H5Aclose(attr_id);
+
+  H5Gclose(grp_mesh_id);
+
+  return 1;
+}
+#endif
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the checkpoint file (.h5 extension).
+ * \return 0 if failed, 1 otherwise, -1 if HDF5 is not available.
+ *
+ * Write a restart checkpoint of the adaptation loop at the end of the
+ * iteration \a parmesh->iter: the mesh, its communicators, the metric and
+ * the fields in their current (interpolated) state are saved in an HDF5 file,
+ * together with the number of performed iterations.
+ *
+ * \remark The groups of each process must have been merged. Collective call.
+ *
+ */
+int PMMG_saveCheckpoint_hdf5(PMMG_pParMesh parmesh, const char *filename) {
+
+#ifndef USE_HDF5
+
+  fprintf(stderr,"  ** HDF5 library not found. Unavailable file format.\n");
+  return -1;
+
+#else
+
+  int        save_entities[PMMG_IO_ENTITIES_size];
+  int        ier;
+  hid_t      file_id, fapl_id;
+
+  /* The whole mesh is needed to resume the adaptation, whatever the entities
+   * asked for the output */
+  PMMG_Set_defaultIOEntities_i(save_entities);
+
+  ier = PMMG_saveMesh_hdf5_i(parmesh,save_entities,filename);
+  if ( ier != 1 ) return 0;
+
+  /* Add the state of the adaptation loop */
+  fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(fapl_id, parmesh->comm, MPI_INFO_NULL);
+  H5Pset_coll_metadata_write(fapl_id, 1);
+
+  HDF_CHECK( file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id),
+             fprintf(stderr,"\n  ## Error: %s: Rank %d could not open the hdf5 file %s.\n",
+                     __func__, parmesh->myrank, filename);
+             H5Pclose(fapl_id);
+             return 0 );
+
+  ier = PMMG_saveState_hdf5(parmesh, file_id);
+
+  H5Fclose(file_id);
+  H5Pclose(fapl_id);
+
+  return ier;
+
+#endif
+}
+
+int PMMG_loadCheckpoint(PMMG_pParMesh parmesh, const char *filename) {
+
+#ifndef USE_HDF5
+
+  fprintf(stderr,"  ** HDF5 library not found. Unavailable file format.\n");
+  return -1;
+
+#else
+
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  int        ier, iter, inputMet;
+  hid_t      file_id, fapl_id;
+
+  if (!filename || !*filename) {
+    fprintf(stderr,"  ## Error: %s: no checkpoint file name provided.\n",
+            __func__);
+    return 0;
+  }
+
+  /* Shut HDF5 error stack */
+  H5Eset_auto(H5E_DEFAULT, NULL, NULL);
+
+  /** Read the state of the adaptation loop */
+  fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(fapl_id, parmesh->comm, MPI_INFO_NULL);
+  H5Pset_all_coll_metadata_ops(fapl_id, 1);
+
+  HDF_CHECK( file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id),
+             fprintf(stderr,"\n  ## Error: %s: Rank %d could not open the hdf5 file %s.\n",
+                     __func__, parmesh->myrank, filename);
+             H5Pclose(fapl_id);
+             return 0 );
+
+  iter = inputMet = 0;
+  ier  = PMMG_loadState_hdf5(parmesh, file_id, &iter, &inputMet);
+
+  H5Fclose(file_id);
+  H5Pclose(fapl_id);
+
+  if ( !ier ) {
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"\n  ## Error: %s: %s is not a ParMmg checkpoint.\n",
+              __func__, filename);
+    }
+    return 0;
+  }
+
+  /* The groups, the communicators and the load balancing of the checkpoint
+   * are only valid with the same number of processes */
+  if ( parmesh->info.npartin != parmesh->nprocs ) {
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"\n  ## Error: %s: checkpoint written by %d processes,"
+              " it can't be resumed with %d processes.\n",
+              __func__, parmesh->info.npartin, parmesh->nprocs);
+    }
+    return 0;
+  }
+
+  /** Load the mesh, its communicators, the metric and the fields */
+  ier = PMMG_loadMesh_hdf5_i(parmesh,NULL,filename);
+  if ( ier != 1 ) return ier;
+
+  /* The metric of a run without prescribed metric is the one computed by Mmg
+   * at each iteration: don't prescribe it now */
+  if ( !inputMet ) {
+    mesh = parmesh->listgrp[0].mesh;
+    met  = parmesh->listgrp[0].met;
+    if ( met && met->m ) {
+      MMG5_DEL_MEM(mesh,met->m);
+      met->np = 0;
+    }
+  }
+
+  parmesh->info.iterStart = iter;
+
+  if ( parmesh->myrank == parmesh->info.root &&
+       parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"  -- RESTART FROM ITERATION %d\n",iter+1);
+  }
+
+  return 1;
+
+#endif
+}
@@ -406,6 +406,11 @@ int PMMG_copyFields_point( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
   for ( j=0; j<mesh->nsols; ++j ) {
     psl    =    field + j;
     oldPsl = oldField + j;
+
+    /* Fields not handed off to the background group (remeshing failure): the
+     * current group still stores their values */
+    if ( !oldPsl->m ) continue;
+
     ier =  PMMG_copySol_point( mesh, oldMesh,psl,oldPsl,permNodGlob);
     if ( !ier ) {
       return 0;
@@ -451,12 +456,381 @@ int PMMG_copyMetricsAndFields_point( MMG5_pMesh mesh ,MMG5_pMesh oldMesh,
  * \param oldMesh pointer to the background mesh structure.
  * \param met pointer to the current metrics structure.
  * \param oldMet pointer to the background metrics structure.
+ * \param field pointer to the current fields.
+ * \param oldField pointer to the background fields.
+ * \param ismet 1 if the metrics has to be interpolated.
+ * \param ip index of the point to interpolate.
+ * \param iel index of the background tria (boundary point) or tetra (volume
+ * point) in which the point has been found.
+ * \param iedge local index of the tria edge on which the point has been found
+ * (PMMG_UNSET if none).
+ * \param ivertex local index of the tria vertex on which the point has been
+ * found (PMMG_UNSET if none).
+ * \param barycoord barycentric coordinates of the point in the element.
+ *
+ * \return 0 if fail, 1 if success
+ *
+ * Interpolate the metrics and the solution fields of a located point.
+ *
+ */
+static inline
+int PMMG_interpMetricsAndFields_point( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
+                                       MMG5_pSol met,MMG5_pSol oldMet,
+                                       MMG5_pSol field,MMG5_pSol oldField,
+                                       int ismet,int ip,int iel,int iedge,
+                                       int ivertex,PMMG_barycoord *barycoord ) {
+  MMG5_pSol psl,oldPsl;
+  int       j,ier;
+
+  ier = 1;
+
+  if ( mesh->point[ip].tag & MG_BDY ) {
+    /** Interpolate point metrics */
+    if( ismet ) {
+      if( ivertex != PMMG_UNSET ) {
+        ier = PMMG_copyMetrics( mesh,met,oldMesh,oldMet,ip,
+                                oldMesh->tria[iel].v[ivertex] );
+      } else if( iedge != PMMG_UNSET ) {
+        ier = PMMG_interp2bar( mesh,met,oldMet,&oldMesh->tria[iel],
+                               ip,iedge,barycoord );
+      } else {
+        ier = PMMG_interp3bar(mesh,met,oldMet,&oldMesh->tria[iel],ip,
+                              barycoord);
+      }
+    }
+
+#warning Luca: make this part consistent with metrics interpolation
+    /** Field interpolation */
+    if ( mesh->nsols ) {
+      for ( j=0; j<mesh->nsols; ++j ) {
+        psl    = field + j;
+        oldPsl = oldField + j;
+        if ( oldPsl->size == 6 ) {
+          /* Tensor field */
+          ier = PMMG_interp3bar_ani(mesh,psl,oldPsl,
+                                    &oldMesh->tria[iel],
+                                    ip,barycoord);
+        }
+        else {
+          /* Scalar or vector field */
+          ier = PMMG_interp3bar_iso(mesh,psl,oldPsl,
+                                    &oldMesh->tria[iel],
+                                    ip,barycoord);
+        }
+      }
+    }
+  }
+  else {
+    /** Interpolate volume point metrics */
+    if( ismet ) {
+      ier = PMMG_interp4bar(mesh,met,oldMet,&oldMesh->tetra[iel],ip,
+                            barycoord);
+    }
+
+    /** Field interpolation */
+    if ( mesh->nsols ) {
+      for ( j=0; j<mesh->nsols; ++j ) {
+        psl    = field + j;
+        oldPsl = oldField + j;
+        if ( oldPsl->size == 6 ) {
+          /* Tensor field */
+          ier = PMMG_interp4bar_ani(mesh,psl,oldPsl,
+                                    &oldMesh->tetra[iel],
+                                    ip,barycoord);
+        }
+        else {
+          /* Scalar or vector field */
+          ier = PMMG_interp4bar_iso(mesh,psl,oldPsl,
+                                    &oldMesh->tetra[iel],
+                                    ip,barycoord);
+        }
+      }
+    }
+  }
+
+  return ier;
+}
+
+/**
+ * \param sol pointer to the current solution (metrics or field).
+ * \param oldSol pointer to the background solution.
+ * \param ip index of the current point.
+ * \param v background vertices of the element containing the point.
+ * \param phi barycentric coordinates of the point (0 for unused vertices).
+ * \param nv number of vertices of the element.
+ * \param ani 1 to interpolate the inverse of the tensor (metrics), 0 to
+ * interpolate the components.
+ *
+ * \return 0 if fail, 1 if success
+ *
+ * Linear interpolation of a solution on a background element, written for
+ * all the solution sizes and element types at once.
+ *
+ */
+static inline
+int PMMG_interpSol_kernel( MMG5_pSol sol,MMG5_pSol oldSol,int ip,
+                           MMG5_int *v,double *phi,int nv,int ani ) {
+  double mi[6],mint[6],*m;
+  int    i,j,size;
+
+  size = sol->size;
+  m    = &sol->m[size*ip];
+
+  if ( !ani ) {
+    for ( j=0; j<size; ++j ) m[j] = 0.0;
+    for ( i=0; i<nv; i++ ) {
+      for ( j=0; j<size; ++j ) {
+        m[j] += phi[i]*oldSol->m[size*v[i]+j];
+      }
+    }
+    return 1;
+  }
+
+  assert ( size == 6 );
+  for ( j=0; j<6; ++j ) mint[j] = 0.0;
+  for ( i=0; i<nv; i++ ) {
+    if ( phi[i] == 0.0 ) continue;
+    if( !MMG5_invmat( &oldSol->m[6*v[i]], mi ) ) return 0;
+    for ( j=0; j<6; ++j ) mint[j] += phi[i]*mi[j];
+  }
+
+  if( !MMG5_invmat( mint, m ) ) return 0;
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the current mesh structure.
+ * \param oldMesh pointer to the background mesh structure.
+ * \param met pointer to the current metrics structure.
+ * \param oldMet pointer to the background metrics structure.
+ * \param field pointer to the current fields.
+ * \param oldField pointer to the background fields.
+ * \param ismet 1 if the metrics has to be interpolated.
+ * \param res pointer to the localization results.
+ * \param nthreads number of threads to use.
+ *
+ * \return the number of points whose interpolation failed.
+ *
+ * Interpolate the metrics and all the solution fields of the located points in
+ * one sweep. Points are independent, so the loop is shared among threads when
+ * OpenMP is enabled. The interpolation is the same as the one of the
+ * PMMG_interp*bar_* functions: metrics of boundary points located on an edge
+ * (resp. a vertex) only use the edge (resp. vertex) values, and the inverse
+ * of anisotropic tensors is interpolated.
+ *
+ */
+static
+int PMMG_interpMetricsAndFields_kernel( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
+                                        MMG5_pSol met,MMG5_pSol oldMet,
+                                        MMG5_pSol field,MMG5_pSol oldField,
+                                        int ismet,PMMG_locateResults *res,
+                                        int nthreads ) {
+  int k,nfail;
+
+  nfail = 0;
+
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static) reduction(+:nfail)
+#endif
+  for ( k=0; k<res->n; k++ ) {
+    MMG5_int *v;
+    double   *phi,phim[4];
+    int      ip,nv,iedge,ivertex,i,j,ier;
+
+    ip  = res->ip[k];
+    phi = &res->phi[4*k];
+    ier = 1;
+
+    if ( mesh->point[ip].tag & MG_BDY ) {
+      v  = oldMesh->tria[res->iel[k]].v;
+      nv = 3;
+    }
+    else {
+      v  = oldMesh->tetra[res->iel[k]].v;
+      nv = 4;
+    }
+
+    /** Metrics */
+    if ( ismet ) {
+      iedge   = res->iedge[k];
+      ivertex = res->ivertex[k];
+      if ( ivertex != PMMG_UNSET ) {
+        for ( j=0; j<met->size; ++j )
+          met->m[met->size*ip+j] = oldMet->m[met->size*v[ivertex]+j];
+      }
+      else {
+        /* Edge iedge is opposite to vertex iedge */
+        for ( i=0; i<nv; i++ ) phim[i] = phi[i];
+        if ( iedge != PMMG_UNSET ) phim[iedge] = 0.0;
+        ier = PMMG_interpSol_kernel( met,oldMet,ip,v,phim,nv,met->size==6 );
+      }
+    }
+
+    /** Fields */
+    for ( j=0; j<mesh->nsols; ++j ) {
+      if ( !PMMG_interpSol_kernel( field+j,oldField+j,ip,v,phi,nv,
+                                   oldField[j].size==6 ) ) ier = 0;
+    }
+
+    if ( !ier ) nfail++;
+  }
+
+  return nfail;
+}
+
+/**
+ * \param mesh pointer to the current mesh structure.
+ * \param oldMesh pointer to the background mesh structure.
+ * \param met pointer to the current metrics structure.
+ * \param oldMet pointer to the background metrics structure.
+ * \param field pointer to the current fields.
+ * \param oldField pointer to the background fields.
  * \param faceAreas pointer to the array of oriented face areas.
  * \param triaNormals pointer to the array of non-normalized triangle normals.
+ * \param nodeTrias pointer to the node triangles graph.
+ * \param ismet 1 if the metrics has to be interpolated.
+ * \param nthreads number of threads for the interpolation pass.
+ * \param myrank process rank.
+ * \param igrp current mesh group.
+ * \param tetraTree pointer to the localization tree on background tetra (or NULL).
+ * \param triaTree pointer to the localization tree on background tria (or NULL).
+ *
+ * \return 0 if fail, 1 if success
+ *
+ * Batched localization and interpolation: the points to interpolate are
+ * sorted along a Hilbert curve and each search starts from the element found
+ * for the previous point, so the walks are short and the visited background
+ * elements stay in cache. The localization results are stored in flat arrays,
+ * then the metrics and fields are interpolated in a second (threaded) pass.
+ *
+ */
+static
+int PMMG_interpMetricsAndFields_batch( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
+                                       MMG5_pSol met,MMG5_pSol oldMet,
+                                       MMG5_pSol field,MMG5_pSol oldField,
+                                       double *faceAreas,double *triaNormals,
+                                       int *nodeTrias,int ismet,int nthreads,
+                                       int myrank,int igrp,
+                                       PMMG_locateTree *tetraTree,
+                                       PMMG_locateTree *triaTree ) {
+  MMG5_pTetra        pt;
+  MMG5_pPoint        ppt;
+  PMMG_locateResults res;
+  PMMG_barycoord     barycoord[4];
+  int                ie,iloc,ip,k,n,ier,ifoundTetra,ifoundTria,nfail;
+
+  /** Step 1: list the points to interpolate */
+  memset(&res,0,sizeof(PMMG_locateResults));
+  PMMG_MALLOC(mesh,res.ip,mesh->np,int,"located points",return 0);
+
+  n = 0;
+  mesh->base++;
+  for( ie = 1; ie <= mesh->ne; ie++ ) {
+    pt = &mesh->tetra[ie];
+    if( !MG_EOK(pt) ) continue;
+    for( iloc = 0; iloc < 4; iloc++ ) {
+      ip = pt->v[iloc];
+      ppt = &mesh->point[ip];
+      if( !MG_VOK(ppt) ) continue;
+
+      /* Skip already listed points */
+      if( ppt->flag == mesh->base ) continue;
+      ppt->flag = mesh->base;
+
+      /* Required points are treated by copyMetric_points */
+      if( ppt->tag & MG_REQ ) continue;
+
+      res.ip[n++] = ip;
+    }
+  }
+  res.n = n;
+
+  /** Step 2: sort them along the space-filling curve */
+  ier = PMMG_locate_sfcSort( mesh,res.ip,n );
+
+  if ( ier ) {
+    PMMG_MALLOC(mesh,res.iel,n,int,"located elements",ier = 0);
+  }
+  if ( ier ) {
+    PMMG_MALLOC(mesh,res.iedge,n,int,"located edges",ier = 0);
+  }
+  if ( ier ) {
+    PMMG_MALLOC(mesh,res.ivertex,n,int,"located vertices",ier = 0);
+  }
+  if ( ier ) {
+    PMMG_CALLOC(mesh,res.phi,4*n,double,"barycentric coordinates",ier = 0);
+  }
+
+  if ( ier ) {
+    /** Step 3: locate the points, starting each walk from the previous result */
+    ifoundTetra = ifoundTria = 1;
+    for ( k=0; k<n; k++ ) {
+      ip  = res.ip[k];
+      ppt = &mesh->point[ip];
+
+      res.iedge[k]   = PMMG_UNSET;
+      res.ivertex[k] = PMMG_UNSET;
+
+      if ( ppt->tag & MG_BDY ) {
+        ier = PMMG_locatePointBdy( oldMesh, ppt,
+                                   triaNormals, nodeTrias, barycoord,
+                                   &ifoundTria,&res.iedge[k],&res.ivertex[k],
+                                   triaTree );
+        res.iel[k] = ifoundTria;
+        PMMG_barycoord_get( &res.phi[4*k], barycoord, 3 );
+      }
+      else {
+        ier = PMMG_locatePointVol( oldMesh, ppt,
+                                   faceAreas, barycoord, &ifoundTetra,
+                                   tetraTree );
+        res.iel[k] = ifoundTetra;
+        PMMG_barycoord_get( &res.phi[4*k], barycoord, 4 );
+      }
+
+      if( mesh->info.imprim > PMMG_VERB_ITWAVES )
+        PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
+    }
+
+    /** Step 4: interpolate metrics and fields */
+    nfail = PMMG_interpMetricsAndFields_kernel( mesh,oldMesh,met,oldMet,
+                                                field,oldField,ismet,&res,
+                                                nthreads );
+    if ( nfail && mesh->info.imprim > PMMG_VERB_ITWAVES ) {
+      fprintf(stderr,"\n  ## Warning: %s: unable to interpolate the metrics"
+              " or fields of %d points.\n",__func__,nfail);
+    }
+    ier = 1;
+  }
+
+  PMMG_DEL_MEM(mesh,res.phi,double,"barycentric coordinates");
+  PMMG_DEL_MEM(mesh,res.ivertex,int,"located vertices");
+  PMMG_DEL_MEM(mesh,res.iedge,int,"located edges");
+  PMMG_DEL_MEM(mesh,res.iel,int,"located elements");
+  PMMG_DEL_MEM(mesh,res.ip,int,"located points");
+
+  return ier;
+}
+
+/**
+ * \param mesh pointer to the current mesh structure.
+ * \param oldMesh pointer to the background mesh structure.
+ * \param met pointer to the current metrics structure.
+ * \param oldMet pointer to the background metrics structure.
+ * \param field pointer to the current fields.
+ * \param oldField pointer to the background fields.
+ * \param faceAreas pointer to the array of oriented face areas.
+ * \param triaNormals pointer to the array of non-normalized triangle normals.
+ * \param nodeTrias pointer to the node triangles graph.
  * \param permNodGlob permutation array of nodes.
  * \param inputMet 1 if user provided metric.
+ * \param batch 1 to use the batched localization.
+ * \param nthreads number of threads for the interpolation pass (batched
+ * localization only).
  * \param myrank process rank.
  * \param igrp current mesh group.
+ * \param tetraTree pointer to the localization tree on background tetra (or NULL).
+ * \param triaTree pointer to the localization tree on background tria (or NULL).
  * \param locStats pointer to the localization statistics structure.
  *
  * \return 0 if fail, 1 if success
@@ -471,8 +845,8 @@ int PMMG_copyMetricsAndFields_point( MMG5_pMesh mesh ,MMG5_pMesh oldMesh,
  * For the solution fields: Do nothing if no solution field is provided
  *   (mesh->nsols == 0), interpolate the non-constant field otherwise.
  *
- *  Oriented face areas are pre-computed in this function before proceeding
- *  with the localization.
+ *  Oriented face areas, triangle normals and node triangles must have been
+ *  pre-computed on the background mesh (see \ref PMMG_oldGrp_locateData).
  *
  */
 static
@@ -481,17 +855,17 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
                                       MMG5_pSol field,MMG5_pSol oldField,
                                       double *faceAreas,double *triaNormals,int *nodeTrias,
                                       int *permNodGlob,uint8_t inputMet,
-                                      int myrank,int igrp,PMMG_locateStats *locStats ) {
+                                      int batch,int nthreads,
+                                      int myrank,int igrp,
+                                      PMMG_locateTree *tetraTree,PMMG_locateTree *triaTree,
+                                      PMMG_locateStats *locStats ) {
   MMG5_pTetra pt;
   MMG5_pPoint ppt;
-  MMG5_pSol   psl,oldPsl;
   PMMG_barycoord barycoord[4];
-  double      *normal,dd;
   int         istartTetra,istartTria,ifoundTetra,ifoundTria;
   int         ifoundEdge,ifoundVertex;
-  int         ip,ie,ifac,k,ia,ib,ic,iloc,nsols;
-  int         ismet,ier,j;
-  static int  mmgWarn=0;
+  int         ip,ie,iloc,nsols;
+  int         ismet,ier;
 
   nsols = mesh->nsols;
 
@@ -512,12 +886,6 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
     return 1;
   }
 
-  /** Pre-compute oriented face areas */
-  ier = PMMG_precompute_faceAreas( oldMesh,faceAreas );
-
-  /** Pre-compute surface unit normals */
-  ier = PMMG_precompute_triaNormals( oldMesh,triaNormals );
-
   /** Interpolate metrics */
   oldMesh->base = 0;
   for ( ie = 1; ie < oldMesh->ne+1; ie++ ) {
@@ -526,6 +894,18 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
     pt->flag = oldMesh->base;
   }
 
+  if ( batch ) {
+    ier = PMMG_interpMetricsAndFields_batch( mesh,oldMesh,met,oldMet,
+                                             field,oldField,faceAreas,
+                                             triaNormals,nodeTrias,ismet,
+                                             nthreads,myrank,igrp,
+                                             tetraTree,triaTree );
+#ifndef NDEBUG
+    PMMG_locate_postprocessing( mesh,oldMesh,tetraTree,triaTree,locStats );
+#endif
+    return ier;
+  }
+
 #ifndef USE_POINTMAP
   ifoundTetra = ifoundTria = 1;
 #else
@@ -556,45 +936,17 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
         /** Locate point in the old mesh */
         ier = PMMG_locatePointBdy( oldMesh, ppt,
                                    triaNormals, nodeTrias, barycoord,
-                                   &ifoundTria,&ifoundEdge, &ifoundVertex );
+                                   &ifoundTria,&ifoundEdge, &ifoundVertex,
+                                   triaTree );
 
         if( mesh->info.imprim > PMMG_VERB_ITWAVES )
           PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
 
-        /** Interpolate point metrics */
-        if( ismet ) {
-          if( ifoundVertex != PMMG_UNSET ) {
-            ier = PMMG_copyMetrics( mesh,met,oldMesh,oldMet,ip,
-                                    oldMesh->tria[ifoundTria].v[ifoundVertex] );
-          } else if( ifoundEdge != PMMG_UNSET ) {
-            ier = PMMG_interp2bar( mesh,met,oldMet,&oldMesh->tria[ifoundTria],
-                                   ip,ifoundEdge,barycoord );
-          } else {
-            ier = PMMG_interp3bar(mesh,met,oldMet,&oldMesh->tria[ifoundTria],ip,
-                                  barycoord);
-          }
-        }
-
-#warning Luca: make this part consistent with metrics interpolation
-        /** Field interpolation */
-        if ( mesh->nsols ) {
-          for ( j=0; j<mesh->nsols; ++j ) {
-            psl    = field + j;
-            oldPsl = oldField + j;
-            if ( oldPsl->size == 6 ) {
-              /* Tensor field */
-              ier = PMMG_interp3bar_ani(mesh,psl,oldPsl,
-                                        &oldMesh->tria[ifoundTria],
-                                        ip,barycoord);
-            }
-            else {
-              /* Scalar or vector field */
-              ier = PMMG_interp3bar_iso(mesh,psl,oldPsl,
-                                        &oldMesh->tria[ifoundTria],
-                                        ip,barycoord);
-            }
-          }
-        }
+        /** Interpolate point metrics and fields */
+        ier = PMMG_interpMetricsAndFields_point( mesh,oldMesh,met,oldMet,
+                                                 field,oldField,ismet,ip,
+                                                 ifoundTria,ifoundEdge,
+                                                 ifoundVertex,barycoord );
 
         /* Flag point as interpolated */
         ppt->flag = mesh->base;
@@ -606,36 +958,17 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
 #endif
         /** Locate point in the old volume mesh */
         ier = PMMG_locatePointVol( oldMesh, ppt,
-                                   faceAreas, barycoord, &ifoundTetra );
+                                   faceAreas, barycoord, &ifoundTetra,
+                                   tetraTree );
 
         if( mesh->info.imprim > PMMG_VERB_ITWAVES )
           PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
 
-        /** Interpolate volume point metrics */
-        if( ismet ) {
-          ier = PMMG_interp4bar(mesh,met,oldMet,&oldMesh->tetra[ifoundTetra],ip,
-                                barycoord);
-        }
-
-        /** Field interpolation */
-        if ( mesh->nsols ) {
-          for ( j=0; j<mesh->nsols; ++j ) {
-            psl    = field + j;
-            oldPsl = oldField + j;
-            if ( oldPsl->size == 6 ) {
-              /* Tensor field */
-              ier = PMMG_interp4bar_ani(mesh,psl,oldPsl,
-                                        &oldMesh->tetra[ifoundTetra],
-                                        ip,barycoord);
-            }
-            else {
-              /* Scalar or vector field */
-              ier = PMMG_interp4bar_iso(mesh,psl,oldPsl,
-                                        &oldMesh->tetra[ifoundTetra],
-                                        ip,barycoord);
-            }
-          }
-        }
+        /** Interpolate volume point metrics and fields */
+        ier = PMMG_interpMetricsAndFields_point( mesh,oldMesh,met,oldMet,
+                                                 field,oldField,ismet,ip,
+                                                 ifoundTetra,PMMG_UNSET,
+                                                 PMMG_UNSET,barycoord );
 
         /* Flag point as interpolated */
         ppt->flag = mesh->base;
@@ -644,12 +977,58 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
     }
   }
 #ifndef NDEBUG
-  PMMG_locate_postprocessing( mesh,oldMesh,locStats );
+  PMMG_locate_postprocessing( mesh,oldMesh,tetraTree,triaTree,locStats );
 #endif
 
   return 1;
 }
 
+/**
+ * \param parmesh pointer to the parmesh structure.
+ * \param oldGrp pointer to the background group.
+ *
+ * \return 0 if fail, 1 if success
+ *
+ * Compute the oriented face areas, the triangle normals and the node triangles
+ * graph of the background mesh of \a oldGrp, unless they are already stored in
+ * the group. They only depend on the background mesh, so they are kept until
+ * the background group is freed (at the end of the interpolation step).
+ *
+ * \remark the computation also stores the tetra (resp. tria) volumes in the qual
+ * field of the background tetra (resp. tria) and the offsets of the node
+ * triangles graph in the tmp field of the background points.
+ *
+ */
+static
+int PMMG_oldGrp_locateData( PMMG_pParMesh parmesh,PMMG_pGrp oldGrp ) {
+  MMG5_pMesh oldMesh = oldGrp->mesh;
+
+  if ( oldGrp->faceAreas ) {
+    assert ( oldGrp->triaNormals && oldGrp->nodeTrias );
+    return 1;
+  }
+
+  /** Pre-compute oriented face areas */
+  PMMG_MALLOC( parmesh,oldGrp->faceAreas,12*(oldMesh->ne+1),double,"faceAreas",
+               return 0 );
+  PMMG_precompute_faceAreas( oldMesh,oldGrp->faceAreas );
+
+  /** Pre-compute surface unit normals */
+  PMMG_MALLOC( parmesh,oldGrp->triaNormals,3*(oldMesh->nt+1),double,"triaNormals",
+               PMMG_DEL_MEM(parmesh,oldGrp->faceAreas,double,"faceAreas");
+               return 0 );
+  PMMG_precompute_triaNormals( oldMesh,oldGrp->triaNormals );
+
+  /** Pre-compute node triangles graph */
+  if ( !PMMG_precompute_nodeTrias( parmesh,oldMesh,&oldGrp->nodeTrias ) ) {
+    PMMG_DEL_MEM(parmesh,oldGrp->faceAreas,double,"faceAreas");
+    PMMG_DEL_MEM(parmesh,oldGrp->triaNormals,double,"triaNormals");
+    return 0;
+  }
+
+  return 1;
+}
+
 /**
  * \param parmesh pointer to the parmesh structure.
  * \param permNodGlob permutation array of nodes.
@@ -668,10 +1047,9 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
   MMG5_pSol        met,oldMet,field,oldField;
   MMG5_Hash        hash;
   PMMG_locateStats *locStats,*mylocStats;
-  double           *faceAreas,*triaNormals;
-  int              *nodeTrias;
+  PMMG_locateTree  tetraTree,triaTree;
+  PMMG_locateTree  *mytetraTree,*mytriaTree;
   int              igrp,ier;
-  int8_t           allocated;
 
   locStats = NULL;
 #ifndef NDEBUG
@@ -683,7 +1061,7 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
            parmesh->ngrp*sizeof(PMMG_locateStats) + sizeof(size_t),PTRDIFF_MAX);
   }
   else {
-    PMMG_MALLOC( parmesh,locStats,parmesh->ngrp,PMMG_locateStats,"locStats", );
+    PMMG_CALLOC( parmesh,locStats,parmesh->ngrp,PMMG_locateStats,"locStats", );
   }
 #endif
 
@@ -696,18 +1074,27 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
     met  = grp->met;
     field = grp->field;
 
+    /* The group has not been remeshed: nothing to interpolate */
+    if ( grp->frozen ) continue;
+
     oldGrp  = &parmesh->old_listgrp[igrp];
     oldMesh = oldGrp->mesh;
     oldMet  = oldGrp->met;
     oldField = oldGrp->field;
 
-    /** Pre-allocate oriented face areas and surface unit normals */
-    allocated = 0;
+    /** Get oriented face areas, surface unit normals and node triangles of
+     * the background mesh (computed only once per background group) */
+    mytetraTree = mytriaTree = NULL;
     if ( mesh->nsols || (( parmesh->info.inputMet == 1 ) && ( mesh->info.hsiz <= 0.0 )) ) {
-      PMMG_MALLOC( parmesh,faceAreas,12*(oldMesh->ne+1),double,"faceAreas",return 0 );
-      PMMG_MALLOC( parmesh,triaNormals,3*(oldMesh->nt+1),double,"triaNormals",return 0 );
-      PMMG_precompute_nodeTrias( parmesh,oldMesh,&nodeTrias );
-      allocated = 1;
+      if ( !PMMG_oldGrp_locateData( parmesh,oldGrp ) ) return 0;
+
+      /** Localization trees are built only if a localization walk fails */
+      if ( parmesh->info.locateTree ) {
+        PMMG_locateTree_init( parmesh,&tetraTree,3 );
+        PMMG_locateTree_init( parmesh,&triaTree,2 );
+        mytetraTree = &tetraTree;
+        mytriaTree  = &triaTree;
+      }
     }
 
     mylocStats = NULL;
@@ -716,18 +1103,19 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
     }
     if( !PMMG_interpMetricsAndFields_mesh( mesh,oldMesh,met,oldMet,
                                            field,oldField,
-                                           faceAreas,triaNormals,nodeTrias,
+                                           oldGrp->faceAreas,oldGrp->triaNormals,
+                                           oldGrp->nodeTrias,
                                            permNodGlob,parmesh->info.inputMet,
-                                           parmesh->myrank,igrp,mylocStats ) ) {
+                                           parmesh->info.locateBatch,
+                                           parmesh->info.nthreads,
+                                           parmesh->myrank,igrp,
+                                           mytetraTree,mytriaTree,mylocStats ) ) {
       ier = 0;
     }
 
-    /** Deallocate oriented face areas and surface unit normals */
-    if( allocated ) {
-      PMMG_DEL_MEM(parmesh,faceAreas,double,"faceAreas");
-      PMMG_DEL_MEM(parmesh,triaNormals,double,"triaNormals");
-      PMMG_DEL_MEM(parmesh,nodeTrias,int,"nodeTrias");
-    }
+    /** Deallocate the localization trees */
+    if ( mytetraTree ) PMMG_locateTree_free( mytetraTree );
+    if ( mytriaTree  ) PMMG_locateTree_free( mytriaTree );
 
   }
 
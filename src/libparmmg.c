@@ -1623,13 +1623,18 @@ int PMMG_parmmglib_post(PMMG_pParMesh parmesh) {
     parmesh->iter = 0;
   }
 
+  /* Centralized Medit output that can be written in parallel: don't merge */
+  if ( PMMG_mpiio_isUsed(parmesh) ) {
+    parmesh->info.fmtout = PMMG_FMT_MeditMPIIO;
+  }
+
   switch ( parmesh->info.fmtout ) {
   case ( PMMG_UNSET ):
     /* No output */
     break;
   case ( MMG5_FMT_VtkPvtu ): case ( PMMG_FMT_Distributed ):
   case ( PMMG_FMT_DistributedMeditASCII ): case ( PMMG_FMT_DistributedMeditBinary ):
-  case ( PMMG_FMT_HDF5 ):
+  case ( PMMG_FMT_HDF5 ): case ( PMMG_FMT_MeditMPIIO ):
 
     /* Distributed Output */
     tim = 1;
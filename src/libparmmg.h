@@ -89,6 +89,30 @@ enum PMMG_Param {
   PMMG_DPARAM_hgrad,             /*!< [val], Control gradation */
   PMMG_DPARAM_hgradreq,          /*!< [val], Control gradation from required entities */
   PMMG_DPARAM_ls,                /*!< [val], Value of level-set */
+  PMMG_IPARAM_nthreads,          /*!< [n], Number of threads used to remesh the groups of a process and to interpolate batched points (needs OpenMP) */
+  PMMG_IPARAM_locateTree,        /*!< [1/0], Use bounding box trees instead of exhaustive searches when the point localization fails */
+  PMMG_IPARAM_costWeights,       /*!< [1/0], Balance the predicted remeshing work (from the metric) instead of the number of elements */
+  PMMG_IPARAM_locateBatch,       /*!< [1/0], Locate the points sorted along a Hilbert curve, then interpolate them in a separate pass */
+  PMMG_IPARAM_trace,             /*!< [0/1/2], Write no performance trace, a JSON lines trace or a Chrome trace (PMMG_TRACE_none/jsonl/chrome) */
+  PMMG_IPARAM_convergence,       /*!< [1/0], Stop the iterations as soon as the convergence targets are met (niter becomes a maximum) */
+  PMMG_DPARAM_convergenceLength, /*!< [val], Convergence target: maximal fraction of edges whose length is outside [1/sqrt(2),sqrt(2)] */
+  PMMG_DPARAM_convergenceQuality,/*!< [val], Convergence target: minimal quality of the elements touching the parallel interfaces */
+  PMMG_IPARAM_freezeGroups,      /*!< [1/0], Skip the remeshing and the interpolation of the groups that already conform to the metric */
+  PMMG_IPARAM_tuneMeshSize,      /*!< [1/0], Tune the target mesh size of Mmg (and the metis ratio) from the measured remeshing throughput */
+  PMMG_IPARAM_partitioner,       /*!< [1/2/3/4], Partitioner (PMMG_LOADBALANCING_metis/parmetis/ptscotch/sfc) */
+  PMMG_DPARAM_repartItr,         /*!< [val], Cost of the edge cut relative to the groups migration (0: repartition from scratch) */
+  PMMG_IPARAM_hierarchical,      /*!< [0/1/n], Keep the most connected parts on the same compute node (1: shared memory nodes, n: blocks of n processes) */
+  PMMG_IPARAM_compressSize,      /*!< [-1/n], Compress the groups migration and gather messages larger than n kB (-1: no compression, needs zlib) */
+  PMMG_IPARAM_mpiioOutput,       /*!< [1/0], Write the centralized Medit output in parallel with MPI-IO instead of merging the mesh on the root process */
+  PMMG_IPARAM_mpiioInput,        /*!< [1/0], Read the centralized binary Medit input in parallel with MPI-IO instead of loading it on the root process */
+  PMMG_IPARAM_checkpoint,        /*!< [n], Write an HDF5 restart checkpoint every n remeshing iterations (0: no checkpoint) */
+  PMMG_IPARAM_restart,           /*!< [1/0], Resume the adaptation from the checkpoint given as input mesh */
+  PMMG_IPARAM_h5Chunk,           /*!< [n], Chunk size (in number of entities) of the HDF5 datasets (0: contiguous datasets) */
+  PMMG_IPARAM_h5Deflate,         /*!< [0-9], Shuffle+deflate compression level of the HDF5 metric and fields (0: no compression) */
+  PMMG_IPARAM_mpiioCbNodes,      /*!< [n], MPI-IO hint cb_nodes: number of collective buffering aggregators (0: MPI default) */
+  PMMG_IPARAM_mpiioCbWrite,      /*!< [-1/0/1], MPI-IO hint romio_cb_write: collective buffering of the writes (-1: MPI default) */
+  PMMG_IPARAM_mpiioStripeCount,  /*!< [n], MPI-IO hint striping_factor: number of file stripes (0: filesystem default) */
+  PMMG_IPARAM_mpiioStripeSize,   /*!< [n], MPI-IO hint striping_unit: stripe size in kB (0: filesystem default) */
   PMMG_PARAM_size,               /*!< [n], Number of parameters */
 };
 
@@ -2294,6 +2318,130 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog);
  */
   int PMMG_loadMesh_hdf5(PMMG_pParMesh parmesh,const char *filename);
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the checkpoint file (.h5 extension).
+ * \return 0 if failed, 1 otherwise, -1 if HDF5 is not available.
+ *
+ * Load a restart checkpoint written by the adaptation loop (see \ref
+ * PMMG_IPARAM_checkpoint): the distributed mesh, its communicators, the metric
+ * and the fields are loaded as with \ref PMMG_loadMesh_hdf5, and the next call
+ * to \ref PMMG_parmmglib_distributed resumes the adaptation at the iteration
+ * following the checkpoint (the initial distribution of the mesh is skipped).
+ *
+ * \warning The checkpoint has to be loaded with the number of processes that
+ * has written it.
+ *
+ * \remark Collective call.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADCHECKPOINT(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadCheckpoint(PMMG_pParMesh parmesh,const char *filename);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file (.meshb extension).
+ * \return 0 if failed, 1 otherwise, -1 if the file has to be read by
+ * \ref PMMG_loadMesh_centralized.
+ *
+ * Read a centralized binary Medit mesh in parallel, without loading it on the
+ * root process: each process reads a block of the tetrahedra with collective
+ * MPI-IO reads and receives their vertices from the processes that read them.
+ * The node communicators are built from the file numbering of the vertices
+ * and the API mode is set to \ref PMMG_APIDISTRIB_nodes, thus the mesh has to
+ * be remeshed with \ref PMMG_parmmglib_distributed. The metric file (binary
+ * Medit file, scalar or tensor metric) is read the same way if it exists.
+ *
+ * Corners and required vertices are read. The files that contain other
+ * entities (edges, normals...), the ASCII metric files and the level-set,
+ * displacement or fields inputs return -1.
+ *
+ * \remark Collective call.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADMESH_MPIIO(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T , INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)    :: filename\n
+ * >     INTEGER, INTENT(IN)             :: strlen\n
+ * >     INTEGER, INTENT(OUT)            :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadMesh_mpiio(PMMG_pParMesh parmesh,const char *filename);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file (.mesh or .meshb extension).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Write the distributed mesh in a single Medit file: each process writes the
+ * vertices it owns, its tetrahedra and the boundary triangles it owns with
+ * collective MPI-IO writes, using the global numbering of the vertices. The
+ * mesh is not merged on the root process. Corners and required vertices are
+ * saved, edges are not. Binary files are limited to 2 GB.
+ *
+ * \remark Collective call, the boundary entities must have been built.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVEMESH_MPIIO(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T , INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)    :: filename\n
+ * >     INTEGER, INTENT(IN)             :: strlen\n
+ * >     INTEGER, INTENT(OUT)            :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveMesh_mpiio(PMMG_pParMesh parmesh,const char *filename);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file (.sol or .solb extension).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Write the metric of the distributed mesh in a single Medit file (see
+ * \ref PMMG_saveMesh_mpiio).
+ *
+ * \remark Collective call.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVEMET_MPIIO(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T , INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)    :: filename\n
+ * >     INTEGER, INTENT(IN)             :: strlen\n
+ * >     INTEGER, INTENT(OUT)            :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveMet_mpiio(PMMG_pParMesh parmesh,const char *filename);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file (.sol or .solb extension).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Write the level-set of the distributed mesh in a single Medit file (see
+ * \ref PMMG_saveMesh_mpiio).
+ *
+ * \remark Collective call.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVELS_MPIIO(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T , INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)    :: filename\n
+ * >     INTEGER, INTENT(IN)             :: strlen\n
+ * >     INTEGER, INTENT(OUT)            :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveLs_mpiio(PMMG_pParMesh parmesh,const char *filename);
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param filename name of file.
@@ -36,6 +36,10 @@
 #include "parmmg.h"
 #include "mmgexterns_private.h"
 
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif
+
 /**
  * \param grp pointer toward the group in which we want to update the list of
  * nodes that are in the internal communicator.
@@ -288,6 +292,7 @@ int PMMG_packParMesh( PMMG_pParMesh parmesh )
 
 /**
  * \param parmesh pointer toward a parmesh structure
+ * \param memc memory counter used to allocate the \a facesData array
  * \param igrp index of the group that we want to treat
  * \param facesData pointer toward the allocatable list of the node indices of
  * the interface faces present in the list of interface triangles of the group.
@@ -300,8 +305,8 @@ int PMMG_packParMesh( PMMG_pParMesh parmesh )
  *
  */
 static inline
-int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
-                                      int **facesData) {
+int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, PMMG_pMemCount memc,
+                                      int igrp, int **facesData) {
   PMMG_pGrp   grp;
   MMG5_pMesh  mesh;
   MMG5_pTetra pt;
@@ -314,7 +319,7 @@ int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
   grp                 = &parmesh->listgrp[igrp];
   nitem_int_face_comm = grp->nitem_int_face_comm;
 
-  PMMG_MALLOC(parmesh,*facesData,3*nitem_int_face_comm,int,"facesData",return 0);
+  PMMG_MALLOC(memc,*facesData,3*nitem_int_face_comm,int,"facesData",return 0);
 
   face2int_face_comm_index1 = grp->face2int_face_comm_index1;
   mesh                      = parmesh->listgrp[igrp].mesh;
@@ -345,6 +350,7 @@ int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
 
 /**
  * \param parmesh pointer toward a parmesh structure.
+ * \param memc memory counter used to allocate the \a facesData array
  * \param igrp index of the group that we want to treat
  * \param facesData list the node vertices of the interface faces
  * present in the list of interface triangles of the group.
@@ -360,8 +366,9 @@ int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
  *
  */
 static inline
-int  PMMG_update_face2intInterfaceTetra( PMMG_pParMesh parmesh, int igrp,
-                                         int *facesData, int *permNodGlob ) {
+int  PMMG_update_face2intInterfaceTetra( PMMG_pParMesh parmesh, PMMG_pMemCount memc,
+                                         int igrp, int *facesData,
+                                         int *permNodGlob ) {
   PMMG_pGrp    grp;
   MMG5_pMesh   mesh;
   MMG5_pTetra  pt;
@@ -443,7 +450,7 @@ hash:
   MMG5_DEL_MEM(mesh,hash.item);
 
 facesData:
-  PMMG_DEL_MEM(parmesh,facesData,int,"facesData");
+  PMMG_DEL_MEM(memc,facesData,int,"facesData");
 
   return ier;
 }
@@ -468,11 +475,12 @@ static inline void PMMG_scotch_message( int8_t *warnScotch ) {
  *
  */
 int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
-  MMG5_pMesh mesh;
-  MMG5_pSol  met,field;
-  int        *facesData;
-  int        k,imprim;
-  int8_t     warnScotch;
+  MMG5_pMesh    mesh;
+  MMG5_pSol     met,field;
+  PMMG_MemCount memc;
+  int           *facesData;
+  int           k,imprim;
+  int8_t        warnScotch;
 
   mesh  = parmesh->listgrp[igrp].mesh;
   met   = parmesh->listgrp[igrp].met;
@@ -487,7 +495,9 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
     }
   }
 
-  if( !PMMG_store_faceVerticesInIntComm(parmesh,igrp,&facesData) ){
+  memc.memMax = parmesh->memMax - parmesh->memCur;
+  memc.memCur = 0;
+  if( !PMMG_store_faceVerticesInIntComm(parmesh,&memc,igrp,&facesData) ){
     fprintf(stderr,"\n  ## Interface faces storage problem."
             " Exit program.\n");
     return 0;
@@ -517,7 +527,7 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
   }
 
   /** Update interface tetra indices in the face communicator */
-  if ( ! PMMG_update_face2intInterfaceTetra(parmesh,igrp,facesData,permNodGlob) ) {
+  if ( ! PMMG_update_face2intInterfaceTetra(parmesh,&memc,igrp,facesData,permNodGlob) ) {
     fprintf(stderr,"\n  ## Interface tetra updating problem. Exit program.\n");
     return 0;
   }
@@ -536,6 +546,513 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
   return 1;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * Mark the groups that already conform to the metric as frozen: they are not
+ * remeshed nor interpolated at this iteration (but they are still moved by the
+ * load balancing). Only groups with an input metric can be frozen as, without
+ * input metric, the metric is computed by the remesher.
+ *
+ */
+static
+void PMMG_freeze_grps( PMMG_pParMesh parmesh ) {
+  PMMG_pGrp grp;
+  int       igrp,nfrozen,nfrozen_result,ngrp_result;
+
+  nfrozen = 0;
+  for ( igrp=0; igrp<parmesh->ngrp; ++igrp ) {
+    grp = &parmesh->listgrp[igrp];
+    grp->frozen = 0;
+
+    if ( !parmesh->info.freezeGrps || parmesh->info.inputMet != 1 ) continue;
+    if ( !grp->mesh || grp->mesh->info.hsiz > 0.0 ) continue;
+
+    grp->frozen = PMMG_isConform( grp->mesh,grp->met,1,PMMG_FREEZE_QUALITY );
+    nfrozen += grp->frozen;
+  }
+
+  if ( parmesh->info.freezeGrps && parmesh->info.imprim0 > PMMG_VERB_ITWAVES ) {
+    MPI_Reduce( &nfrozen,&nfrozen_result,1,MPI_INT,MPI_SUM,parmesh->info.root,
+                parmesh->comm );
+    MPI_Reduce( &parmesh->ngrp,&ngrp_result,1,MPI_INT,MPI_SUM,parmesh->info.root,
+                parmesh->comm );
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stdout,"\n       %d/%d groups already conform to the metric\n",
+              nfrozen_result,ngrp_result);
+    }
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param igrp index of the group to remesh
+ * \param memc memory counter of the calling thread
+ *
+ * \return 1 if success, 0 if the remesher fails but the mesh remains conform,
+ * -1 if the mesh is non-conform.
+ *
+ * Remesh the group \a igrp: store the interface faces, scale the mesh, call
+ * Mmg, pack the tetra, update the face communicator and copy the metric and
+ * fields on the untouched vertices.
+ *
+ * \remark Only the group \a igrp, its background group and the memory counter
+ * \a memc are modified (temporary arrays are counted in \a memc and not in
+ * \a parmesh) so different groups can be remeshed concurrently.
+ *
+ */
+static
+int PMMG_remesh_grp( PMMG_pParMesh parmesh,int igrp,PMMG_pMemCount memc ) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met,field,psl;
+  int        ier,k,is,*facesData,*permNodGlob;
+  int8_t     warnScotch;
+
+  mesh         = parmesh->listgrp[igrp].mesh;
+  met          = parmesh->listgrp[igrp].met;
+  field        = parmesh->listgrp[igrp].field;
+
+#ifndef NDEBUG
+  if ( !MMG5_chkmsh(mesh,1,1) ) {
+    fprintf(stderr,"  ##  Problem. Invalid mesh.\n");
+    return -1;
+  }
+#endif
+
+#warning Luca: until analysis is not ready
+#ifdef USE_POINTMAP
+  for( k = 1; k <= mesh->np; k++ ) {
+    mesh->point[k].src = k;
+  }
+#endif
+
+  /* Reset the value of the fem mode */
+  mesh->info.fem = parmesh->info.setfem;
+
+  if ( (!mesh->np) && (!mesh->ne) ) {
+    /* Empty mesh */
+    return 1;
+  }
+
+  if ( parmesh->listgrp[igrp].frozen ) {
+    /* The group already conforms to the metric: leave it as after a
+     * remeshing */
+    if ( mesh->adja )
+      PMMG_DEL_MEM(mesh,mesh->adja,int,"adja table");
+    return 1;
+  }
+
+  /** Store the vertices of interface faces in the internal communicator */
+  if ( !PMMG_store_faceVerticesInIntComm(parmesh,memc,igrp,&facesData) ) {
+    /* We are not able to remesh */
+    fprintf(stderr,"\n  ## Interface faces storage problem."
+            " Exit program.\n");
+    return 0;
+  }
+
+  /* We can remesh */
+  permNodGlob = NULL;
+  warnScotch  = 0;
+
+#ifdef USE_SCOTCH
+  /* Allocation of the array that will store the node permutation */
+  // npi stores the number of points when we enter Mmg, np stores the
+  // number of points after adatptation.
+  // In theorie, here np == npi
+
+  assert ( mesh->np == mesh->npi );
+
+  PMMG_MALLOC(memc,permNodGlob,mesh->npi+1,int,"node permutation",
+              PMMG_scotch_message(&warnScotch) );
+  if ( permNodGlob ) {
+    for ( k=1; k<=mesh->np; ++k ) {
+      permNodGlob[k] = k;
+    }
+    for ( k=1; k<=mesh->npi; ++k ) {
+      assert  ( permNodGlob[k] >0 );
+    }
+
+  }
+
+  /* renumerotation if available: no need to renum the field here (they
+   * will be interpolated) */
+  if ( permNodGlob ) {
+    if ( !MMG5_scotchCall(mesh,met,NULL,permNodGlob) )
+    {
+      PMMG_scotch_message(&warnScotch);
+    }
+  }
+#endif
+
+  /* Mark reinitialisation in order to be able to remesh all the mesh */
+  mesh->mark = 0;
+  mesh->base = 0;
+  for ( k=1 ; k<=mesh->nemax ; k++ ) {
+    mesh->tetra[k].mark = mesh->mark;
+    mesh->tetra[k].flag = mesh->base;
+  }
+  /* Reinitialisation of point flags because mesh->base has been reseted
+   * and scalem expects point flag to be lower or equal to mesh->base */
+  for ( k=1 ; k<=mesh->npmax ; k++ ) {
+    mesh->point[k].flag = mesh->base;
+  }
+
+  /** Call the remesher */
+  /* Here we need to scale the mesh */
+  if ( !MMG5_scaleMesh(mesh,met,NULL) ) { return -1; }
+
+  if ( !mesh->adja ) {
+    if ( !MMG3D_hashTetra(mesh,0) ) {
+      fprintf(stderr,"\n  ## Hashing problem. Exit program.\n");
+      return -1;
+    }
+  }
+
+#ifdef PATTERN
+  ier = MMG5_mmg3d1_pattern( mesh, met, permNodGlob );
+#else
+  ier = MMG5_mmg3d1_delone( mesh, met, permNodGlob );
+#endif
+  mesh->npi = mesh->np;
+  mesh->nei = mesh->ne;
+
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## MMG remeshing problem. Exit program.\n");
+  }
+  else {
+    /* The solution fields are rebuilt by the interpolation: hand their values
+     * off to the background group instead of keeping two copies. If the
+     * remesher fails, there is no interpolation and the group keeps its
+     * fields for the fallback save. */
+    PMMG_oldGrp_handOffFields( &parmesh->listgrp[igrp],&parmesh->old_listgrp[igrp] );
+  }
+
+  /* Realloc the solution fields at the same size than other structures (if
+   * the values have been handed off to the background group, they are rebuilt
+   * by the interpolation) */
+  if ( mesh->nsols ) {
+    for ( is=0; is<mesh->nsols; ++is ) {
+      psl    = field + is;
+      assert ( psl );
+      if ( !psl->m ) {
+        PMMG_MALLOC(mesh,psl->m,psl->size*(mesh->npmax+1),double,
+                    "field array",return -1);
+      }
+      else {
+        PMMG_REALLOC(mesh,psl->m,psl->size*(mesh->npmax+1),
+                     psl->size*(psl->npmax+1),double,
+                     "field array",return -1);
+      }
+      psl->npmax = mesh->npmax;
+    }
+  }
+
+  if ( parmesh->iter < parmesh->niter-1 && (!parmesh->info.inputMet) ) {
+    /* Delete the metric computed by Mmg except at last iter */
+    PMMG_DEL_MEM(mesh,met->m,double,"internal metric");
+  }
+
+  /** Pack the tetra */
+  if ( mesh->adja )
+    PMMG_DEL_MEM(mesh,mesh->adja,int,"adja table");
+
+  if ( !MMG5_paktet(mesh) ) {
+    fprintf(stderr,"\n  ## Tetra packing problem. Exit program.\n");
+    return -1;
+  }
+
+  /** Update interface tetra indices in the face communicator */
+  if ( ! PMMG_update_face2intInterfaceTetra(parmesh,memc,igrp,facesData,permNodGlob) ) {
+    fprintf(stderr,"\n  ## Interface tetra updating problem. Exit program.\n");
+    return -1;
+  }
+
+
+#ifdef USE_SCOTCH
+  /** Update nodal communicators if node renumbering is enabled */
+  if ( mesh->info.renum &&
+       !PMMG_update_node2intRnbg(&parmesh->listgrp[igrp],permNodGlob) ) {
+    fprintf(stderr,"\n  ## Nodal communicator updating problem. Exit program.\n");
+    return -1;
+  }
+#endif
+
+  if ( !MMG5_unscaleMesh(mesh,met,NULL) ) { return -1; }
+
+  if ( !PMMG_copyMetricsAndFields_point( parmesh->listgrp[igrp].mesh,
+                                         parmesh->old_listgrp[igrp].mesh,
+                                         parmesh->listgrp[igrp].met,
+                                         parmesh->old_listgrp[igrp].met,
+                                         parmesh->listgrp[igrp].field,
+                                         parmesh->old_listgrp[igrp].field,
+                                         permNodGlob,parmesh->info.inputMet) ) {
+    return -1;
+  }
+
+#ifdef USE_SCOTCH
+  PMMG_DEL_MEM(memc,permNodGlob,int,"node permutation");
+#endif
+
+  /* Reset the mesh->gap field in case Mmg have modified it */
+  mesh->gap = MMG5_GAP;
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param igrp index of the group to remesh
+ * \param memc memory counter of the calling thread
+ * \param grpStats if not NULL, store the initial number of elements, the
+ * amount of work (number of elements before and after the remeshing) and the
+ * remeshing time of the group at the index 3*igrp
+ *
+ * \return the value returned by \ref PMMG_remesh_grp.
+ *
+ * Remesh the group \a igrp and measure its remeshing throughput.
+ *
+ */
+static
+int PMMG_remesh_grpTimed( PMMG_pParMesh parmesh,int igrp,PMMG_pMemCount memc,
+                          double *grpStats ) {
+  MMG5_pMesh mesh;
+  mytime     ctim;
+  int        ier,ne;
+
+  if ( !grpStats ) return PMMG_remesh_grp( parmesh,igrp,memc );
+
+  mesh = parmesh->listgrp[igrp].mesh;
+  ne   = mesh->ne;
+
+  chrono(RESET,&ctim);
+  chrono(ON,&ctim);
+  ier = PMMG_remesh_grp( parmesh,igrp,memc );
+  chrono(OFF,&ctim);
+
+  grpStats[3*igrp]   = parmesh->listgrp[igrp].frozen ? 0 : ne;
+  grpStats[3*igrp+1] = ne + mesh->ne;
+  grpStats[3*igrp+2] = ctim.gdif;
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param grpStats initial size, amount of work and remeshing time of each
+ * group (see \ref PMMG_remesh_grpTimed), may be NULL
+ * \param binWork work accumulated on each group size bin since the first
+ * iteration
+ * \param binTime remeshing time accumulated on each group size bin since the
+ * first iteration
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Update the target mesh size of Mmg from the measured remeshing throughput
+ * (elements per second). The remeshed groups are binned by size (half octaves)
+ * and the measures are accumulated over the iterations. The new target is the
+ * size of the bin with the best throughput, or half (resp. twice) this size if
+ * this bin is the smallest (resp. largest) measured one, so the next iteration
+ * explores a new size. The target is bounded by the memory available per
+ * thread. The metis ratio is scaled so the size of the metis super nodes
+ * doesn't change.
+ *
+ * \remark collective on the parmesh communicator.
+ *
+ */
+static
+int PMMG_tune_grpSize( PMMG_pParMesh parmesh,double *grpStats,
+                       double *binWork,double *binTime ) {
+  MMG5_pMesh mesh;
+  double     stats[2*PMMG_TUNE_NBINS+2],stats_result[2*PMMG_TUNE_NBINS+2];
+  double     memElt,memElt_result,meanSize,size,maxSize,rate,bestRate;
+  int        igrp,b,best,bmin,bmax,target,ratio;
+
+  memset(stats,0,(2*PMMG_TUNE_NBINS+2)*sizeof(double));
+  memElt = 0.;
+
+  /* grpStats may be NULL if its allocation has failed: no local measure */
+  for ( igrp=0; grpStats && igrp<parmesh->ngrp; ++igrp ) {
+    mesh = parmesh->listgrp[igrp].mesh;
+    if ( !mesh || !mesh->ne ) continue;
+
+    /* Memory used per element by the groups */
+    memElt = MG_MAX ( memElt,(double)mesh->memCur/(double)mesh->ne );
+
+    /* Frozen and empty groups are not measured */
+    if ( grpStats[3*igrp] < 1. ) continue;
+
+    b = (int)(2.*log2(grpStats[3*igrp]));
+    b = MG_MAX ( 0,MG_MIN ( b,PMMG_TUNE_NBINS-1 ) );
+
+    stats[2*b]   += grpStats[3*igrp+1];
+    stats[2*b+1] += grpStats[3*igrp+2];
+    stats[2*PMMG_TUNE_NBINS]   += grpStats[3*igrp];
+    stats[2*PMMG_TUNE_NBINS+1] += 1.;
+  }
+
+  MPI_CHECK( MPI_Allreduce( stats,stats_result,2*PMMG_TUNE_NBINS+2,MPI_DOUBLE,
+                            MPI_SUM,parmesh->comm ),return 0 );
+  MPI_CHECK( MPI_Allreduce( &memElt,&memElt_result,1,MPI_DOUBLE,MPI_MAX,
+                            parmesh->comm ),return 0 );
+
+  /* Nothing has been remeshed */
+  if ( stats_result[2*PMMG_TUNE_NBINS+1] < 1. ) return 1;
+
+  meanSize = stats_result[2*PMMG_TUNE_NBINS]/stats_result[2*PMMG_TUNE_NBINS+1];
+
+  /** Find the size bin with the best throughput */
+  best = bmin = bmax = -1;
+  bestRate = 0.;
+  for ( b=0; b<PMMG_TUNE_NBINS; ++b ) {
+    binWork[b] += stats_result[2*b];
+    binTime[b] += stats_result[2*b+1];
+
+    if ( binTime[b] <= 0. ) continue;
+
+    if ( bmin < 0 ) bmin = b;
+    bmax = b;
+
+    rate = binWork[b]/binTime[b];
+    if ( rate > bestRate ) {
+      bestRate = rate;
+      best     = b;
+    }
+  }
+  if ( best < 0 ) return 1;
+
+  size = pow(2.,(best+0.5)/2.);
+  if ( best == bmin ) {
+    /* Explore smaller groups (first choice when only one size is known) */
+    size /= 2.;
+  }
+  else if ( best == bmax ) {
+    /* Explore larger groups */
+    size *= 2.;
+  }
+
+  /** Bound the target by the memory available per thread (keep room for the
+   * growth of the groups during the remeshing) */
+  if ( memElt_result > 0. ) {
+    maxSize = (double)parmesh->memGloMax/parmesh->info.nthreads/memElt_result/2.;
+    size = MG_MIN ( size,maxSize );
+  }
+  size   = MG_MAX ( size,(double)PMMG_TUNE_MESH_SIZE_MIN );
+  target = (int)MG_MIN ( size,(double)INT_MAX );
+
+  /** Keep the size of the metis super nodes */
+  ratio = (int)(abs(parmesh->info.metis_ratio)*size/meanSize + 0.5);
+  ratio = MG_MAX ( 1,ratio );
+
+  /* Negative values keep the default limitations of the number of groups */
+  parmesh->info.target_mesh_size = parmesh->info.target_mesh_size < 0 ?
+    -target : target;
+  parmesh->info.metis_ratio = parmesh->info.metis_ratio < 0 ?
+    -ratio : ratio;
+
+  if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
+    fprintf(stdout,"\n       mesh size tuning: mean group size %.0f elts,"
+            " best throughput %.3g elts/s (around %.0f elts)\n"
+            "                         new mesh size %d, metis ratio %d\n",
+            meanSize,bestRate,pow(2.,(best+0.5)/2.),target,ratio);
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * \return name of the checkpoint file of the current iteration (to be freed by
+ * the caller), NULL if fail.
+ *
+ * Build the checkpoint file name from the output mesh name (or the input one):
+ * <base>.chk<n>.h5 where n is the number of performed iterations.
+ *
+ */
+static
+char* PMMG_checkpoint_name( PMMG_pParMesh parmesh ) {
+  char       *name,*ptr;
+  const char *base;
+
+  base = parmesh->meshout ? parmesh->meshout :
+    ( parmesh->meshin ? parmesh->meshin : "parmmg" );
+
+  PMMG_MALLOC(parmesh,name,strlen(base)+32,char,"checkpoint name",
+              return NULL);
+  strcpy(name,base);
+
+  ptr = MMG5_Get_filenameExt(name);
+  if ( ptr ) *ptr = '\0';
+  sprintf(name+strlen(name),".chk%d.h5",parmesh->iter+1);
+
+  return name;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * \return -1 if the groups can't be rebuilt (the adaptation can't continue), 0
+ * if the checkpoint can't be written, 1 otherwise.
+ *
+ * Write a restart checkpoint at the end of the current iteration: the groups
+ * are merged (as for the output) to save the mesh of each process with its
+ * communicators, metric and fields at HDF5 format, then they are split again
+ * as before the first iteration (\ref PMMG_loadCheckpoint followed by \ref
+ * PMMG_parmmglib_distributed resumes the adaptation from the same state).
+ *
+ * \remark collective on the parmesh communicator.
+ *
+ */
+static
+int PMMG_checkpoint( PMMG_pParMesh parmesh ) {
+  MMG5_pMesh mesh;
+  int        ier,ieresult,ierSave;
+  char       *name;
+
+  /** Only one group per process can be saved */
+  ier = PMMG_packParMesh(parmesh);
+  if ( ier ) {
+    ier = PMMG_merge_grps(parmesh,0);
+  }
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) return -1;
+
+  /** Boundary triangles (only stored in the xtetra during the adaptation) */
+  mesh = parmesh->listgrp[0].mesh;
+  ier  = MMG3D_hashTetra( mesh,0 ) && ( -1 != MMG3D_bdryBuild( mesh ) );
+  MPI_Allreduce( &ier, &ierSave, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  if ( ierSave ) {
+    name = PMMG_checkpoint_name(parmesh);
+    ier  = name ? 1 : 0;
+    MPI_Allreduce( &ier, &ierSave, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+    if ( ierSave ) {
+      /* Collective: same returned value on all the procs */
+      ierSave = ( 1 == PMMG_saveCheckpoint_hdf5(parmesh,name) );
+      if ( ierSave && parmesh->info.imprim > PMMG_VERB_STEPS ) {
+        fprintf(stdout,"\n       checkpoint written in %s\n",name);
+      }
+    }
+    PMMG_DEL_MEM(parmesh,name,char,"checkpoint name");
+  }
+
+  /* The triangles are rebuilt from the xtetra when needed */
+  MMG5_DEL_MEM(mesh,mesh->tria);
+  mesh->nt = 0;
+  MMG5_DEL_MEM(mesh,mesh->adjt);
+  MMG5_DEL_MEM(mesh,mesh->edge);
+  mesh->na = 0;
+
+  /** Groups creation (as before the first iteration) */
+  ier = PMMG_splitPart_grps( parmesh,PMMG_GRPSPL_MMG_TARGET,0,
+                             PMMG_REDISTRIBUTION_graph_balancing );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( ieresult <= 0 ) return -1;
+
+  return ierSave;
+}
+
 /**
  * \param parmesh pointer toward a parmesh structure where the boundary entities
  * are stored into xtetra and xpoint strucutres
@@ -551,13 +1068,17 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
  */
 int PMMG_parmmglib1( PMMG_pParMesh parmesh )
 {
-  MMG5_pMesh mesh;
-  MMG5_pSol  met,field,psl;
-  mytime     ctim[TIMEMAX];
-  int        ier,ier_end,ieresult,i,k,is,*facesData,*permNodGlob;
-  int8_t     tim,warnScotch;
-  char       stim[32];
-  uint8_t    inputMet;
+  MMG5_pMesh     mesh;
+  MMG5_pSol      met;
+  PMMG_pMemCount memc;
+  mytime         ctim[TIMEMAX];
+  double         lenOut,qualIfc,*grpStats;
+  double         binWork[PMMG_TUNE_NBINS],binTime[PMMG_TUNE_NBINS];
+  int            ier,ier_end,ieresult,i,k,nthreads,*grpIer,*permNodGlob;
+  int            niter,convergence,ierConv,iterStart;
+  int8_t         tim;
+  char           stim[32];
+  uint8_t        inputMet;
 
   tminit(ctim,TIMEMAX);
 
@@ -599,16 +1120,23 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
   }
 #endif
 
+  /** Performance trace */
+  if ( !PMMG_trace_init( parmesh ) ) {
+    PMMG_CLEAN_AND_RETURN(parmesh,PMMG_LOWFAILURE);
+  }
+
   /** Groups creation */
   if ( parmesh->info.imprim > PMMG_VERB_QUAL ) {
     tim = 0;
     chrono(ON,&(ctim[tim]));
   }
 
+  PMMG_trace_start(parmesh,PMMG_TRACE_grpsplit);
   if ( ier ) {
     ier = PMMG_splitPart_grps( parmesh,PMMG_GRPSPL_MMG_TARGET,0,
                                PMMG_REDISTRIBUTION_graph_balancing );
   }
+  PMMG_trace_end(parmesh,PMMG_TRACE_grpsplit);
 
   MPI_CHECK ( MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm ),
               PMMG_CLEAN_AND_RETURN(parmesh,PMMG_LOWFAILURE) );
@@ -654,8 +1182,17 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
   }
 
   /** Mesh adaptation */
-  warnScotch = 0;
-  for ( parmesh->iter = 0; parmesh->iter < parmesh->niter; parmesh->iter++ ) {
+  memset(binWork,0,PMMG_TUNE_NBINS*sizeof(double));
+  memset(binTime,0,PMMG_TUNE_NBINS*sizeof(double));
+  niter       = parmesh->niter;
+  convergence = parmesh->info.convergence;
+
+  /* Number of iterations already performed if the adaptation is resumed from a
+   * checkpoint (only for this call) */
+  iterStart = parmesh->info.iterStart;
+  parmesh->info.iterStart = 0;
+
+  for ( parmesh->iter = iterStart; parmesh->iter < parmesh->niter; parmesh->iter++ ) {
     if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
       tim = 1;
       if ( parmesh->iter > 0 ) {
@@ -671,6 +1208,9 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     }
 
 
+    /** Find the groups that don't need to be remeshed */
+    PMMG_freeze_grps( parmesh );
+
     /** Update old groups for metrics and solution interpolation */
     PMMG_update_oldGrps( parmesh );
 
@@ -681,175 +1221,70 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       chrono(ON,&(ctim[tim]));
     }
 
+    /** Remesh the groups (concurrently if the hybrid mode is enabled) */
+    PMMG_trace_start(parmesh,PMMG_TRACE_remesh);
+    nthreads = parmesh->info.nthreads;
+    PMMG_MALLOC(parmesh,memc,nthreads,PMMG_MemCount,"threads memory counters",
+                ier = 0; goto strong_failed);
+    for ( k=0; k<nthreads; ++k ) {
+      memc[k].memMax = (parmesh->memMax - parmesh->memCur)/nthreads;
+      memc[k].memCur = 0;
+    }
+    PMMG_MALLOC(parmesh,grpIer,parmesh->ngrp,int,"groups remeshing status",
+                PMMG_DEL_MEM(parmesh,memc,PMMG_MemCount,"threads memory counters");
+                ier = 0; goto strong_failed);
     for ( i=0; i<parmesh->ngrp; ++i ) {
-      mesh         = parmesh->listgrp[i].mesh;
-      met          = parmesh->listgrp[i].met;
-      field        = parmesh->listgrp[i].field;
+      grpIer[i] = 1;
+    }
 
-#ifndef NDEBUG
-      if ( !MMG5_chkmsh(mesh,1,1) ) {
-        fprintf(stderr,"  ##  Problem. Invalid mesh.\n");
-        return 0;
-      }
-#endif
+    /* Remeshing throughput of the groups (mesh size tuning) */
+    grpStats = NULL;
+    if ( parmesh->info.tuneGrpSize && parmesh->iter < parmesh->niter-1 ) {
+      PMMG_CALLOC(parmesh,grpStats,3*parmesh->ngrp,double,"groups remeshing stats",
+                  grpStats = NULL);
+    }
 
-#warning Luca: until analysis is not ready
-#ifdef USE_POINTMAP
-      for( k = 1; k <= mesh->np; k++ ) {
-        mesh->point[k].src = k;
+#ifdef USE_OPENMP
+    if ( nthreads > 1 ) {
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+      for ( i=0; i<parmesh->ngrp; ++i ) {
+        grpIer[i] = PMMG_remesh_grpTimed( parmesh,i,&memc[omp_get_thread_num()],
+                                          grpStats );
       }
+    }
+    else
 #endif
-
-      /* Reset the value of the fem mode */
-      mesh->info.fem = parmesh->info.setfem;
-
-      if ( (!mesh->np) && (!mesh->ne) ) {
-        /* Empty mesh */
-        continue;
+    {
+      for ( i=0; i<parmesh->ngrp; ++i ) {
+        grpIer[i] = PMMG_remesh_grpTimed( parmesh,i,&memc[0],grpStats );
+        if ( grpIer[i] < 1 ) break;
       }
+    }
 
-      /** Store the vertices of interface faces in the internal communicator */
-      if ( !(ier = PMMG_store_faceVerticesInIntComm(parmesh,i,&facesData) ) ) {
-        /* We are not able to remesh */
-        fprintf(stderr,"\n  ## Interface faces storage problem."
-                " Exit program.\n");
+    /* Gather the memory that the threads may have not released (on failure) */
+    for ( k=0; k<nthreads; ++k ) {
+      parmesh->memCur += memc[k].memCur;
+    }
+    PMMG_DEL_MEM(parmesh,memc,PMMG_MemCount,"threads memory counters");
+
+    /* Reduction of the groups status in the group order so the result doesn't
+     * depend on the threads scheduling */
+    ier = 1;
+    for ( i=0; i<parmesh->ngrp; ++i ) {
+      if ( grpIer[i] < 0 ) {
+        ier = -1;
         break;
       }
-      else {
-        /* We can remesh */
-
-        permNodGlob = NULL;
-
-#ifdef USE_SCOTCH
-        /* Allocation of the array that will store the node permutation */
-        // npi stores the number of points when we enter Mmg, np stores the
-        // number of points after adatptation.
-        // In theorie, here np == npi
-
-        assert ( mesh->np == mesh->npi );
-
-        PMMG_MALLOC(parmesh,permNodGlob,mesh->npi+1,int,"node permutation",
-                    PMMG_scotch_message(&warnScotch) );
-        if ( permNodGlob ) {
-          for ( k=1; k<=mesh->np; ++k ) {
-            permNodGlob[k] = k;
-          }
-          for ( k=1; k<=mesh->npi; ++k ) {
-            assert  ( permNodGlob[k] >0 );
-          }
-
-        }
-
-        /* renumerotation if available: no need to renum the field here (they
-         * will be interpolated) */
-        if ( permNodGlob ) {
-          if ( !MMG5_scotchCall(mesh,met,NULL,permNodGlob) )
-          {
-            PMMG_scotch_message(&warnScotch);
-          }
-        }
-#endif
-
-        /* Mark reinitialisation in order to be able to remesh all the mesh */
-        mesh->mark = 0;
-        mesh->base = 0;
-        for ( k=1 ; k<=mesh->nemax ; k++ ) {
-          mesh->tetra[k].mark = mesh->mark;
-          mesh->tetra[k].flag = mesh->base;
-        }
-        /* Reinitialisation of point flags because mesh->base has been reseted
-         * and scalem expects point flag to be lower or equal to mesh->base */
-        for ( k=1 ; k<=mesh->npmax ; k++ ) {
-          mesh->point[k].flag = mesh->base;
-        }
-
-        /** Call the remesher */
-        /* Here we need to scale the mesh */
-        if ( !MMG5_scaleMesh(mesh,met,NULL) ) { goto strong_failed; }
-
-        if ( !mesh->adja ) {
-          if ( !MMG3D_hashTetra(mesh,0) ) {
-            fprintf(stderr,"\n  ## Hashing problem. Exit program.\n");
-            goto strong_failed;
-          }
-        }
-
-
-#ifdef PATTERN
-        ier = MMG5_mmg3d1_pattern( mesh, met, permNodGlob );
-#else
-        ier = MMG5_mmg3d1_delone( mesh, met, permNodGlob );
-#endif
-        mesh->npi = mesh->np;
-        mesh->nei = mesh->ne;
-
-        if ( !ier ) {
-          fprintf(stderr,"\n  ## MMG remeshing problem. Exit program.\n");
-        }
-
-        /* Realloc the solution fields at the same size than other structures */
-        if ( mesh->nsols ) {
-          for ( is=0; is<mesh->nsols; ++is ) {
-            psl    = field + is;
-            assert ( psl && psl->m );
-            PMMG_REALLOC(mesh,psl->m,psl->size*(mesh->npmax+1),
-                         psl->size*(psl->npmax+1),double,
-                         "field array",goto strong_failed);
-            psl->npmax = mesh->npmax;
-          }
-        }
-
-        if ( parmesh->iter < parmesh->niter-1 && (!parmesh->info.inputMet) ) {
-          /* Delete the metric computed by Mmg except at last iter */
-          PMMG_DEL_MEM(mesh,met->m,double,"internal metric");
-        }
-
-        /** Pack the tetra */
-        if ( mesh->adja )
-          PMMG_DEL_MEM(mesh,mesh->adja,int,"adja table");
-
-        if ( !MMG5_paktet(mesh) ) {
-          fprintf(stderr,"\n  ## Tetra packing problem. Exit program.\n");
-          goto strong_failed;
-        }
-
-        /** Update interface tetra indices in the face communicator */
-        if ( ! PMMG_update_face2intInterfaceTetra(parmesh,i,facesData,permNodGlob) ) {
-          fprintf(stderr,"\n  ## Interface tetra updating problem. Exit program.\n");
-          goto strong_failed;
-        }
-
-
-#ifdef USE_SCOTCH
-        /** Update nodal communicators if node renumbering is enabled */
-        if ( mesh->info.renum &&
-             !PMMG_update_node2intRnbg(&parmesh->listgrp[i],permNodGlob) ) {
-          fprintf(stderr,"\n  ## Nodal communicator updating problem. Exit program.\n");
-          goto strong_failed;
-        }
-#endif
-
-        if ( !MMG5_unscaleMesh(mesh,met,NULL) ) { goto strong_failed; }
-
-        if ( !PMMG_copyMetricsAndFields_point( parmesh->listgrp[i].mesh,
-                                               parmesh->old_listgrp[i].mesh,
-                                               parmesh->listgrp[i].met,
-                                               parmesh->old_listgrp[i].met,
-                                               parmesh->listgrp[i].field,
-                                               parmesh->old_listgrp[i].field,
-                                               permNodGlob,parmesh->info.inputMet) ) {
-          goto strong_failed;
-        }
-
-#ifdef USE_SCOTCH
-        PMMG_DEL_MEM(parmesh,permNodGlob,int,"node permutation");
-#endif
-
-        if ( !ier ) { break; }
+      ier = MG_MIN ( ier,grpIer[i] );
+    }
+    PMMG_DEL_MEM(parmesh,grpIer,int,"groups remeshing status");
+    PMMG_trace_end(parmesh,PMMG_TRACE_remesh);
+    PMMG_trace_grps(parmesh,PMMG_TRACE_remesh);
 
-      }
-      /* Reset the mesh->gap field in case Mmg have modified it */
-      mesh->gap = MMG5_GAP;
+    if ( ier < 0 ) {
+      PMMG_DEL_MEM(parmesh,grpStats,double,"groups remeshing stats");
+      ier = 0;
+      goto strong_failed;
     }
 
     MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
@@ -859,8 +1294,19 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       fprintf(stdout,"\n       mmg                               %s\n",stim);
     }
 
-    if ( !ieresult )
+    if ( !ieresult ) {
+      PMMG_DEL_MEM(parmesh,grpStats,double,"groups remeshing stats");
       goto failed_handling;
+    }
+
+    /** Tune the mesh size of the groups built by the load balancing */
+    if ( parmesh->info.tuneGrpSize && parmesh->iter < parmesh->niter-1 ) {
+      if ( !PMMG_tune_grpSize( parmesh,grpStats,binWork,binTime ) ) {
+        fprintf(stderr,"\n  ## Warning: %s: unable to tune the mesh size.\n",
+                __func__);
+      }
+      PMMG_DEL_MEM(parmesh,grpStats,double,"groups remeshing stats");
+    }
 
     /** Interpolate metrics and solution fields */
     if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
@@ -869,7 +1315,13 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       chrono(ON,&(ctim[tim]));
     }
 
+    PMMG_trace_start(parmesh,PMMG_TRACE_interp);
     ier = PMMG_interpMetricsAndFields( parmesh, permNodGlob );
+    PMMG_trace_end(parmesh,PMMG_TRACE_interp);
+
+    /* The background groups are not used anymore: release them before the load
+     * balancing (only their number is needed) */
+    PMMG_listgrp_free(parmesh, &parmesh->old_listgrp, parmesh->nold_grp);
 
     MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
     if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
@@ -887,6 +1339,39 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     /* Compute quality in the interpolated metrics */
     ier = PMMG_tetraQual( parmesh,1 );
 
+    /** Convergence check: the current iteration becomes the last one if the
+     * targets are met (niter is then only a maximal number of iterations) */
+    if ( convergence && parmesh->iter < parmesh->niter-1 ) {
+      ierConv = PMMG_convergenceStats( parmesh,1,&lenOut,&qualIfc );
+      if ( ierConv == 1 ) {
+        if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+          fprintf(stdout,"       convergence: %.2f%% of edges out of [0.71,1.41],"
+                  " worst interface quality %.4f\n",100.*lenOut,qualIfc);
+        }
+        if ( lenOut <= parmesh->info.conv_length &&
+             qualIfc >= parmesh->info.conv_quality ) {
+          if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
+            fprintf(stdout,"\n       adaptation converged after %d iterations"
+                    " (maximum %d)\n",parmesh->iter+1,niter);
+          }
+          parmesh->niter = parmesh->iter+1;
+        }
+      }
+      else {
+        /* Statistics not available (no metric between two remeshings): keep
+         * the fixed number of iterations */
+        if ( !ierConv && !parmesh->myrank ) {
+          fprintf(stderr,"\n  ## Warning: %s: unable to compute the convergence"
+                  " statistics.\n",__func__);
+        }
+        else if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+          fprintf(stdout,"\n  ## Warning: %s: convergence mode needs a metric"
+                  " between two remeshings. Perform %d iterations.\n",__func__,niter);
+        }
+        convergence = 0;
+      }
+    }
+
     /** load Balancing at group scale and communicators reconstruction */
     tim = 3;
     if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
@@ -894,6 +1379,7 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       chrono(ON,&(ctim[tim]));
     }
 
+    PMMG_trace_start(parmesh,PMMG_TRACE_loadbalancing);
     if ( parmesh->iter == parmesh->niter-1 ) {
 
       if ( !parmesh->info.nobalancing ) {
@@ -905,6 +1391,8 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       /** Standard parallel mesh repartitioning */
       ier = PMMG_loadBalancing(parmesh,parmesh->info.repartitioning);
     }
+    PMMG_trace_end(parmesh,PMMG_TRACE_loadbalancing);
+    PMMG_trace_grps(parmesh,PMMG_TRACE_loadbalancing);
 
 
     MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
@@ -925,10 +1413,46 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     }
 
     /** update geometric analysis */
+    PMMG_trace_start(parmesh,PMMG_TRACE_analys);
     if( !PMMG_update_analys(parmesh) )
       PMMG_CLEAN_AND_RETURN(parmesh,PMMG_LOWFAILURE);
+    PMMG_trace_end(parmesh,PMMG_TRACE_analys);
+
+    /** Restart checkpoint (useless after the last iteration: the output is
+     * written) */
+    if ( parmesh->info.checkpoint > 0 && parmesh->iter < parmesh->niter-1 &&
+         !((parmesh->iter+1) % parmesh->info.checkpoint) ) {
+      tim = 5;
+      if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+        chrono(RESET,&(ctim[tim]));
+        chrono(ON,&(ctim[tim]));
+      }
+
+      PMMG_trace_start(parmesh,PMMG_TRACE_checkpoint);
+      ier = PMMG_checkpoint(parmesh);
+      PMMG_trace_end(parmesh,PMMG_TRACE_checkpoint);
+
+      if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+        chrono(OFF,&(ctim[tim]));
+        printim(ctim[tim].gdif,stim);
+        fprintf(stdout,"       checkpoint                        %s\n",stim);
+      }
+
+      if ( ier < 0 ) {
+        if ( !parmesh->myrank )
+          fprintf(stderr,"\n  ## Groups rebuilding problem after the checkpoint. Exit program.\n");
+        PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
+      }
+      else if ( !ier && !parmesh->myrank ) {
+        fprintf(stderr,"\n  ## Warning: %s: unable to write the checkpoint of"
+                " iteration %d.\n",__func__,parmesh->iter+1);
+      }
+    }
   }
 
+  /* Restore the maximal number of iterations (modified by a convergence) */
+  parmesh->niter = niter;
+
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
     printf("\n");
   }
@@ -953,7 +1477,9 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     chrono(ON,&(ctim[tim]));
     }
 
+  PMMG_trace_start(parmesh,PMMG_TRACE_packing);
   ier = PMMG_packParMesh(parmesh);
+  PMMG_trace_end(parmesh,PMMG_TRACE_packing);
   MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
     chrono(OFF,&(ctim[tim]));
@@ -973,7 +1499,9 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     chrono(ON,&(ctim[tim]));
   }
 
+  PMMG_trace_start(parmesh,PMMG_TRACE_merging);
   ier = PMMG_merge_grps(parmesh,0);
+  PMMG_trace_end(parmesh,PMMG_TRACE_merging);
   MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
 
 #ifndef NDEBUG
@@ -1007,6 +1535,11 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     PMMG_prilen(parmesh,1,0,parmesh->comm);
   }
 
+  if ( !PMMG_trace_write(parmesh) ) {
+    fprintf(stderr,"\n  ## Warning: %s: unable to write the performance trace.\n",
+            __func__);
+  }
+
   PMMG_CLEAN_AND_RETURN(parmesh,ier_end);
 
   /** mmg3d1_delone failure */
@@ -1015,13 +1548,17 @@ strong_failed:
   PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
 
 failed_handling:
+  parmesh->niter = niter;
+
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
     tim = 4;
     chrono(ON,&(ctim[tim]));
   }
-  if ( !PMMG_packParMesh(parmesh) ) {
+  PMMG_trace_start(parmesh,PMMG_TRACE_packing);
+  ier = PMMG_packParMesh(parmesh);
+  PMMG_trace_end(parmesh,PMMG_TRACE_packing);
+  if ( !ier ) {
     fprintf(stderr,"\n  ## Parmesh packing problem. Exit program.\n");
-    PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
   }
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
     chrono(OFF,&(ctim[tim]));
@@ -1029,18 +1566,29 @@ failed_handling:
     fprintf(stdout,"\n       mesh packing                      %s\n",stim);
   }
 
-  if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
-    chrono(ON,&(ctim[5]));
+  if ( ier ) {
+    if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
+      chrono(ON,&(ctim[5]));
+    }
+    PMMG_trace_start(parmesh,PMMG_TRACE_merging);
+    ier = PMMG_merge_grps(parmesh,0);
+    PMMG_trace_end(parmesh,PMMG_TRACE_merging);
+    if ( !ier ) {
+      fprintf(stderr,"\n  ## Groups merging problem. Exit program.\n");
+    }
+    if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
+      chrono(OFF,&(ctim[5]));
+      printim(ctim[5].gdif,stim);
+      fprintf(stdout,"       group merging                     %s\n",stim);
+    }
   }
-  if ( !PMMG_merge_grps(parmesh,0) ) {
-    fprintf(stderr,"\n  ## Groups merging problem. Exit program.\n");
+
+  /* The trace writing is collective: leave on all the processes if one of them
+   * has failed */
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
     PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
   }
-  if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
-    chrono(OFF,&(ctim[5]));
-    printim(ctim[5].gdif,stim);
-    fprintf(stdout,"       group merging                     %s\n",stim);
-  }
 
   /* Reset hmin/hmax values of the mesh if needed */
   if ( !parmesh->info.sethmin ) {
@@ -1050,6 +1598,10 @@ failed_handling:
     if ( parmesh->listgrp[0].mesh ) parmesh->listgrp[0].mesh->info.sethmax = 0;
   }
 
+  if ( !PMMG_trace_write(parmesh) ) {
+    fprintf(stderr,"\n  ## Warning: %s: unable to write the performance trace.\n",
+            __func__);
+  }
 
   PMMG_CLEAN_AND_RETURN(parmesh,PMMG_LOWFAILURE);
 }
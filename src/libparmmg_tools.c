@@ -61,6 +61,59 @@ int PMMG_defaultValues( PMMG_pParMesh parmesh )
             parmesh->memGloMax/MMG5_MILLION);
     fprintf(stdout,"\n** Parameters\n");
     fprintf( stdout,"# of remeshing iterations (-niter)        : %d\n",parmesh->niter);
+    fprintf( stdout,"# of threads per process (-nthreads)      : %d\n",parmesh->info.nthreads);
+    fprintf( stdout,"localization trees (-loctree)             : %s\n",
+             parmesh->info.locateTree ? "enabled" : "disabled");
+    fprintf( stdout,"batched localization (-locbatch)          : %s\n",
+             parmesh->info.locateBatch ? "enabled" : "disabled");
+    fprintf( stdout,"remeshing cost weights (-cost-weights)    : %s\n",
+             parmesh->info.costWeights ? "enabled" : "disabled");
+    fprintf( stdout,"performance trace (-trace)                : %s\n",
+             parmesh->info.trace == PMMG_TRACE_chrome ? "chrome" :
+             ( parmesh->info.trace == PMMG_TRACE_jsonl ? "jsonl" : "disabled" ) );
+    fprintf( stdout,"partitioner (-partitioner)                : %s\n",
+             parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_sfc ? "sfc" :
+             parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_ptscotch ? "ptscotch" :
+             ( parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_parmetis ?
+               "parmetis" : "metis" ));
+    fprintf( stdout,"node-aware mapping (-hierarchical)        : %s\n",
+             parmesh->info.hierarchical ? "enabled" : "disabled");
+    fprintf( stdout,"edge cut / migration cost (-repart-itr)   : %g\n",
+             parmesh->info.repartItr);
+    if ( parmesh->info.compressSize < 0 ) {
+      fprintf( stdout,"messages compression (-compress)          : disabled\n");
+    }
+    else {
+      fprintf( stdout,"messages compression (-compress)          : above %d kB\n",
+               parmesh->info.compressSize);
+    }
+    fprintf( stdout,"parallel Medit output (-mpiio-output)     : %s\n",
+             parmesh->info.mpiioOutput ? "enabled" : "disabled");
+    fprintf( stdout,"parallel Medit input (-mpiio-input)       : %s\n",
+             parmesh->info.mpiioInput ? "enabled" : "disabled");
+    fprintf( stdout,"mesh size tuning (-tune-mesh-size)        : %s\n",
+             parmesh->info.tuneGrpSize ? "enabled" : "disabled");
+    fprintf( stdout,"skip conforming groups (-freeze-groups)   : %s\n",
+             parmesh->info.freezeGrps ? "enabled" : "disabled");
+    fprintf( stdout,"convergence mode (-converge)              : %s\n",
+             parmesh->info.convergence ? "enabled" : "disabled");
+    fprintf( stdout,"convergence targets (-converge-length/-quality) : %.2f / %.2f\n",
+             parmesh->info.conv_length,parmesh->info.conv_quality);
+    if ( parmesh->info.checkpoint ) {
+      fprintf( stdout,"restart checkpoints (-checkpoint)         : every %d iterations\n",
+               parmesh->info.checkpoint);
+    }
+    else {
+      fprintf( stdout,"restart checkpoints (-checkpoint)         : disabled\n");
+    }
+    fprintf( stdout,"HDF5 chunk size (-h5-chunk)               : %d\n",
+             parmesh->info.h5Chunk);
+    fprintf( stdout,"HDF5 deflate level (-h5-deflate)          : %d\n",
+             parmesh->info.h5Deflate);
+    fprintf( stdout,"MPI-IO hints (-mpiio-cb-nodes/-cb-write/-stripe-count/-stripe-size) :"
+             " %d / %d / %d / %d kB\n",
+             parmesh->info.mpiioCbNodes,parmesh->info.mpiioCbWrite,
+             parmesh->info.mpiioStripeCount,parmesh->info.mpiioStripeSize);
     fprintf( stdout,"repartitioning mode                       : PMMG_REDISTRIBUTION_ifc_displacement\n");
 //    fprintf( stdout,"loadbalancing_mode (not yet customizable) : PMMG_LOADBALANCING_metis\n");
 //    fprintf( stdout,"target mesh size for Mmg (-mesh-size) : %d\n",abs(PMMG_REMESHER_TARGET_MESH_SIZE));
@@ -108,22 +161,59 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog )
     fprintf(stdout,"-sol   file  load level-set, displacement or metric file\n");
     fprintf(stdout,"-met   file  load metric file\n");
     fprintf(stdout,"-field file  load sol field to interpolate from init onto final mesh\n");
+    fprintf(stdout,"-mpiio-input read the binary Medit mesh and metric in parallel\n");
+    fprintf(stdout,"-restart     input file is an HDF5 checkpoint: resume the adaptation loop\n");
     fprintf(stdout,"-f     file  load parameter file\n");
 
     fprintf(stdout,"-noout       do not write output triangulation\n");
     fprintf(stdout,"-centralized-output centralized output (Medit format only)\n");
     fprintf(stdout,"-distributed-output distributed output (Medit format only)\n");
+    fprintf(stdout,"-mpiio-output centralized Medit output written in parallel without merging the mesh\n");
+#ifdef USE_HDF5
+    fprintf(stdout,"-h5-chunk   val  chunk size (in number of entities) of the HDF5 datasets\n");
+    fprintf(stdout,"-h5-deflate [n]  shuffle+deflate compression of the HDF5 metric and fields\n"
+            "                 (level %d by default)\n",PMMG_H5_DEFLATE);
+#endif
+    fprintf(stdout,"-mpiio-cb-nodes     val  number of MPI-IO collective buffering aggregators\n");
+    fprintf(stdout,"-mpiio-cb-write   [0/1]  enable (1, default) or disable (0) the MPI-IO collective buffering\n");
+    fprintf(stdout,"-mpiio-stripe-count val  number of file stripes of the MPI-IO outputs\n");
+    fprintf(stdout,"-mpiio-stripe-size  val  stripe size (in kB) of the MPI-IO outputs\n");
 
     fprintf(stdout,"\n**  Mode specifications (mesh adaptation by default)\n");
     fprintf(stdout,"-ls     val create mesh of isovalue val (0 if no argument provided)\n");
 
     fprintf(stdout,"\n**  Parameters\n");
     fprintf(stdout,"-niter        val  number of remeshing iterations\n");
+#ifdef USE_OPENMP
+    fprintf(stdout,"-nthreads     val  number of threads used to remesh the groups of each process\n"
+            "                   (and to interpolate the located points with -locbatch)\n");
+#endif
     fprintf(stdout,"-mesh-size    val  target mesh size for the remesher\n");
     fprintf(stdout,"-metis-ratio  val  number of metis super nodes per mesh\n");
     fprintf(stdout,"-nlayers      val  number of layers for interface displacement\n");
     fprintf(stdout,"-groups-ratio val  allowed imbalance between current and desired groups size\n");
     fprintf(stdout,"-nobalance         switch off load balancing of the output mesh\n");
+    fprintf(stdout,"-loctree           use bounding box trees when the point localization fails\n");
+    fprintf(stdout,"-locbatch          locate the points along a Hilbert curve before interpolating them\n");
+    fprintf(stdout,"-cost-weights      balance the predicted remeshing work instead of the number of elements\n");
+    fprintf(stdout,"-partitioner name  partitioner (metis, parmetis, ptscotch or sfc)\n");
+    fprintf(stdout,"-hierarchical [n]  keep the most connected parts on the same compute node\n"
+            "                   (n: number of processes per node, detected by default)\n");
+    fprintf(stdout,"-repart-itr   val  cost of the edge cut relative to the groups migration\n"
+            "                   (keep the groups on their process when possible, 0 to disable)\n");
+#ifdef USE_ZLIB
+    fprintf(stdout,"-compress [n]      compress the groups migration and gather messages larger than n kB\n"
+            "                   (%d kB by default)\n",PMMG_COMPRESS_SIZE);
+#endif
+    fprintf(stdout,"-tune-mesh-size    tune the mesh size (and the metis ratio) from the measured remeshing speed\n");
+    fprintf(stdout,"-freeze-groups     don't remesh the groups that already conform to the metric\n");
+    fprintf(stdout,"-converge          stop the iterations as soon as the convergence targets are met\n"
+            "                   (-niter becomes the maximal number of iterations)\n");
+    fprintf(stdout,"-converge-length  val  maximal fraction of edges whose length is outside [1/sqrt(2),sqrt(2)]\n");
+    fprintf(stdout,"-converge-quality val  minimal quality of the elements touching the parallel interfaces\n");
+    fprintf(stdout,"-checkpoint   val  write an HDF5 restart checkpoint every val iterations\n"
+            "                   (<out>.chk<iter>.h5, to be resumed with -restart)\n");
+    fprintf(stdout,"-trace [fmt]       write a per-phase performance trace of each process (fmt: jsonl (default) or chrome)\n");
     fprintf(stdout,"-pure-partitioning perform only mesh partitioning (no level-set insertion or remeshing");
 
     //fprintf(stdout,"-ar     val  angle detection\n");
@@ -304,6 +394,66 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
             goto clean;
           }
         }
+        else if ( !strcmp(pmmgArgv[i],"-cost-weights") ) {
+          /* Partition weights from the predicted remeshing cost */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_costWeights,1) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-compress") ) {
+          /* Compression of the large messages (optional size threshold in
+           * kB) */
+          val = PMMG_COMPRESS_SIZE;
+          if ( ++i < pmmgArgc && isdigit(pmmgArgv[i][0]) ) {
+            val = atoi(pmmgArgv[i]);
+          }
+          else {
+            i--;
+          }
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_compressSize,val) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-converge") ) {
+          /* Stop the iterations when the convergence targets are met */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_convergence,1) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-checkpoint") ) {
+          /* Period (in iterations) of the restart checkpoints */
+          if ( ++i < pmmgArgc && isdigit(pmmgArgv[i][0]) ) {
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_checkpoint,
+                                      atoi(pmmgArgv[i])) ) {
+              ret_val = 0;
+              goto clean;
+            }
+          }
+          else {
+            PMMG_ERROR_ARG("\nMissing argument option %s\n",pmmgArgv,i-1);
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-converge-length") ||
+                  !strcmp(pmmgArgv[i],"-converge-quality") ) {
+          /* Convergence targets (turn on the convergence mode) */
+          if ( ++i < pmmgArgc && ( isdigit(pmmgArgv[i][0]) || pmmgArgv[i][0]=='.' ) ) {
+            if ( !PMMG_Set_dparameter(parmesh,
+                                      strcmp(pmmgArgv[i-1],"-converge-length") ?
+                                      PMMG_DPARAM_convergenceQuality :
+                                      PMMG_DPARAM_convergenceLength,
+                                      atof(pmmgArgv[i])) ||
+                 !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_convergence,1) ) {
+              ret_val = 0;
+              goto clean;
+            }
+          }
+          else {
+            PMMG_ERROR_ARG("\nMissing argument option %s\n",pmmgArgv,i-1);
+          }
+        }
         else {
           PMMG_UNRECOGNIZED_ARG;
         }
@@ -321,6 +471,13 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
             PMMG_ERROR_ARG("\nMissing filename for %s\n",pmmgArgv,i-1);
           }
         }
+        else if ( !strcmp(pmmgArgv[i],"-freeze-groups") ) {
+          /* Skip the groups that already conform to the metric */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_freezeGroups,1) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
         else {
           PMMG_UNRECOGNIZED_ARG;
         }
@@ -349,6 +506,75 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
         }
         break;
 
+      case 'h':
+        if ( !strcmp(pmmgArgv[i],"-hierarchical") ) {
+          /* Node-aware mapping of the parts (optional number of processes per
+           * node) */
+          val = 1;
+          if ( ++i < pmmgArgc && isdigit(pmmgArgv[i][0]) ) {
+            val = atoi(pmmgArgv[i]);
+          }
+          else {
+            i--;
+          }
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_hierarchical,val) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-h5-chunk") ) {
+          /* Chunk size (in number of entities) of the HDF5 datasets */
+          if ( ++i < pmmgArgc && isdigit(pmmgArgv[i][0]) ) {
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_h5Chunk,
+                                      atoi(pmmgArgv[i])) ) {
+              ret_val = 0;
+              goto clean;
+            }
+          }
+          else {
+            PMMG_ERROR_ARG("\nMissing argument option %s\n",pmmgArgv,i-1);
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-h5-deflate") ) {
+          /* Compression of the HDF5 metric and fields (optional deflate
+           * level) */
+          val = PMMG_H5_DEFLATE;
+          if ( ++i < pmmgArgc && isdigit(pmmgArgv[i][0]) ) {
+            val = atoi(pmmgArgv[i]);
+          }
+          else {
+            i--;
+          }
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_h5Deflate,val) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else {
+          PMMG_UNRECOGNIZED_ARG;
+        }
+        break;
+
+      case 'l':
+        if ( !strcmp(pmmgArgv[i],"-loctree") ) {
+          /* Localization trees as fallback of the localization walk */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_locateTree,1) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-locbatch") ) {
+          /* Batched localization of the points along a Hilbert curve */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_locateBatch,1) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else {
+          PMMG_UNRECOGNIZED_ARG;
+        }
+        break;
+
       case 'm':
         if ( !strcmp(pmmgArgv[i],"-mmg-v") ) {
           /* Mmg verbosity */
@@ -405,13 +631,77 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
             goto clean;
           }
         }
+        else if ( !strcmp(pmmgArgv[i],"-mpiio-input") ) {
+          /* Centralized binary Medit input read in parallel */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_mpiioInput,1) ) {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-mpiio-output") ) {
+          /* Centralized Medit output written in parallel */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_mpiioOutput,1) ) {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-mpiio-cb-write") ) {
+          /* Collective buffering of the MPI-IO writes (optional 0 to disable
+           * it) */
+          val = 1;
+          if ( ++i < pmmgArgc && isdigit(pmmgArgv[i][0]) ) {
+            val = atoi(pmmgArgv[i]);
+          }
+          else {
+            i--;
+          }
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_mpiioCbWrite,val) ) {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-mpiio-cb-nodes") ||
+                  !strcmp(pmmgArgv[i],"-mpiio-stripe-count") ||
+                  !strcmp(pmmgArgv[i],"-mpiio-stripe-size") ) {
+          /* MPI-IO hints for the parallel file system */
+          if ( !strcmp(pmmgArgv[i],"-mpiio-cb-nodes") ) {
+            val = PMMG_IPARAM_mpiioCbNodes;
+          }
+          else if ( !strcmp(pmmgArgv[i],"-mpiio-stripe-count") ) {
+            val = PMMG_IPARAM_mpiioStripeCount;
+          }
+          else {
+            val = PMMG_IPARAM_mpiioStripeSize;
+          }
+          if ( ++i < pmmgArgc && isdigit(pmmgArgv[i][0]) ) {
+            if ( !PMMG_Set_iparameter(parmesh,val,atoi(pmmgArgv[i])) ) {
+              ret_val = 0;
+              goto clean;
+            }
+          }
+          else {
+            PMMG_ERROR_ARG("\nMissing argument option %s\n",pmmgArgv,i-1);
+          }
+        }
         else {
           PMMG_UNRECOGNIZED_ARG;
         }
         break;
 
       case 'n':  /* number of adaptation iterations */
-        if ( ( 0 == strncmp( pmmgArgv[i], "-niter", 5 ) ) && ( ( i + 1 ) < pmmgArgc ) ) {
+        if ( !strcmp(pmmgArgv[i],"-nthreads") ) {
+          /* Number of threads for the remeshing of groups */
+          if ( ++i < pmmgArgc && isdigit(pmmgArgv[i][0]) ) {
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_nthreads,atoi(pmmgArgv[i])) ) {
+              ret_val = 0;
+              goto clean;
+            }
+          }
+          else {
+            PMMG_ERROR_ARG("\nMissing argument option %s\n",pmmgArgv,i-1);
+          }
+        }
+        else if ( ( 0 == strncmp( pmmgArgv[i], "-niter", 5 ) ) && ( ( i + 1 ) < pmmgArgc ) ) {
           ++i;
           if ( isdigit( pmmgArgv[i][0] ) && ( atoi( pmmgArgv[i] ) >= 0 ) ) {
             parmesh->niter = atoi( pmmgArgv[i] );
@@ -467,6 +757,91 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
             goto clean;
           }
         }
+        else if ( !strcmp(pmmgArgv[i],"-partitioner") ) {
+          /* Graph partitioner */
+          if ( ++i < pmmgArgc ) {
+            if ( !strcmp(pmmgArgv[i],"metis") ) {
+              val = PMMG_LOADBALANCING_metis;
+            }
+            else if ( !strcmp(pmmgArgv[i],"parmetis") ) {
+              val = PMMG_LOADBALANCING_parmetis;
+            }
+            else if ( !strcmp(pmmgArgv[i],"ptscotch") ) {
+              val = PMMG_LOADBALANCING_ptscotch;
+            }
+            else if ( !strcmp(pmmgArgv[i],"sfc") ) {
+              val = PMMG_LOADBALANCING_sfc;
+            }
+            else {
+              PMMG_ERROR_ARG("\nUnknown partitioner %s\n",pmmgArgv,i);
+            }
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_partitioner,val) )  {
+              ret_val = 0;
+              goto clean;
+            }
+          }
+          else {
+            PMMG_ERROR_ARG("\nMissing argument option %s\n",pmmgArgv,i-1);
+          }
+        }
+        else {
+          PMMG_UNRECOGNIZED_ARG;
+        }
+        break;
+
+      case 'r':
+        if ( !strcmp(pmmgArgv[i],"-restart") ) {
+          /* The input mesh is a checkpoint: resume the adaptation */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_restart,1) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-repart-itr") ) {
+          /* Edge cut to migration cost ratio of the repartitioning */
+          if ( ++i < pmmgArgc && ( isdigit(pmmgArgv[i][0]) || pmmgArgv[i][0]=='.' ) ) {
+            if ( !PMMG_Set_dparameter(parmesh,PMMG_DPARAM_repartItr,
+                                      atof(pmmgArgv[i])) ) {
+              ret_val = 0;
+              goto clean;
+            }
+          }
+          else {
+            PMMG_ERROR_ARG("\nMissing argument option %s\n",pmmgArgv,i-1);
+          }
+        }
+        else {
+          PMMG_UNRECOGNIZED_ARG;
+        }
+        break;
+
+      case 't':
+        if ( !strcmp(pmmgArgv[i],"-trace") ) {
+          /* Per-phase performance trace */
+          val = PMMG_TRACE_jsonl;
+          if ( ++i < pmmgArgc ) {
+            if ( !strcmp(pmmgArgv[i],"chrome") ) {
+              val = PMMG_TRACE_chrome;
+            }
+            else if ( strcmp(pmmgArgv[i],"jsonl") ) {
+              i--;
+            }
+          }
+          else {
+            i--;
+          }
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_trace,val) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
+        else if ( !strcmp(pmmgArgv[i],"-tune-mesh-size") ) {
+          /* Tune the target group size from the measured remeshing speed */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_tuneMeshSize,1) )  {
+            ret_val = 0;
+            goto clean;
+          }
+        }
         else {
           PMMG_UNRECOGNIZED_ARG;
         }
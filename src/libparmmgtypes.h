@@ -216,6 +216,48 @@
  */
 #define PMMG_LOADBALANCING_parmetis 2
 
+/**
+ * \def PMMG_LOADBALANCING_ptscotch
+ *
+ * Use PT-Scotch to compute and balance the graph during the loadbalancing step
+ * (Scotch for the sequential partitionings)
+ *
+ */
+#define PMMG_LOADBALANCING_ptscotch 3
+
+/**
+ * \def PMMG_LOADBALANCING_sfc
+ *
+ * Order the elements (or the groups) along a Hilbert space-filling curve and
+ * cut the curve into parts of equal weight (no graph is built)
+ *
+ */
+#define PMMG_LOADBALANCING_sfc 4
+
+/**
+ * \def PMMG_TRACE_none
+ *
+ * Don't record the performance trace of the run
+ *
+ */
+#define PMMG_TRACE_none 0
+
+/**
+ * \def PMMG_TRACE_jsonl
+ *
+ * Write the performance trace as JSON lines (one record per line)
+ *
+ */
+#define PMMG_TRACE_jsonl 1
+
+/**
+ * \def PMMG_TRACE_chrome
+ *
+ * Write the performance trace in the Chrome trace event format
+ *
+ */
+#define PMMG_TRACE_chrome 2
+
 /**
  * \def PMMG_APIDISTRIB_faces
  *
@@ -290,6 +332,25 @@ enum PMMG_IO_entities {
   PMMG_IO_Parallel // To enable/disable saving of all type of parallel entites
 };
 
+/**
+ * \enum PMMG_TRACE_phases
+ * \brief Steps of the remeshing process recorded in the performance trace.
+ */
+enum PMMG_TRACE_phases {
+  PMMG_TRACE_grpsplit,    // Initial groups creation
+  PMMG_TRACE_remesh,      // Remeshing of the groups
+  PMMG_TRACE_interp,      // Metrics and fields interpolation
+  PMMG_TRACE_loadbalancing, // Load balancing (whole step)
+  PMMG_TRACE_splitMetis,  // Split into metis groups (load balancing sub-step)
+  PMMG_TRACE_distribute,  // Groups migration (load balancing sub-step)
+  PMMG_TRACE_splitMmg,    // Split into mmg groups (load balancing sub-step)
+  PMMG_TRACE_analys,      // Update of the geometric analysis
+  PMMG_TRACE_packing,     // Parallel mesh packing
+  PMMG_TRACE_merging,     // Groups merging
+  PMMG_TRACE_checkpoint,  // Writing of a restart checkpoint
+  PMMG_TRACE_PHASES_size  // Number of traced phases
+};
+
 /**
  * Types
  */
@@ -349,7 +410,13 @@ typedef struct {
   int          nitem_int_face_comm;/*!< Nb faces of this grp in internal communicator*/
   int*         face2int_face_comm_index1; /*!< List of interface faces (local index)*/
   int*         face2int_face_comm_index2; /*!< List of index in internal communicator (where put the interface faces)*/
+
+  /* point localization data (background groups only) */
+  double*      faceAreas;   /*!< Oriented face areas of the tetra (size 12*(ne+1)) */
+  double*      triaNormals; /*!< Unit normals of the triangles (size 3*(nt+1)) */
+  int*         nodeTrias;   /*!< Node triangles graph on the surface */
   int          flag;
+  int8_t       frozen; /*!< 1 if the group already conforms to the metric (not remeshed nor interpolated at this iteration) */
 } PMMG_Grp;
 typedef PMMG_Grp  * PMMG_pGrp;
 
@@ -373,10 +440,34 @@ typedef struct {
   int ifc_layers;  /*!< nb of layers for interface displacement */
   double grps_ratio;  /*!< allowed imbalance ratio between current and demanded groups size */
   int nobalancing; /*!< switch off final load balancing */
-  int loadbalancing_mode; /*!< way to perform the loadbalanding (see LOADBALANCING) */
+  int loadbalancing_mode; /*!< graph partitioner used by the loadbalancing (see LOADBALANCING) */
   int contiguous_mode; /*!< force/don't force partitions contiguity */
   int metis_ratio; /*!< wanted ratio between the number of meshes and the number of metis super nodes */
   int target_mesh_size; /*!< target mesh size for Mmg */
+  int tuneGrpSize; /*!< tune the target mesh size from the measured Mmg throughput */
+  int nthreads; /*!< nb of threads used to remesh the groups of a process */
+  int locateTree; /*!< use bounding box trees when the localization walk fails */
+  int locateBatch; /*!< locate the points along a space-filling curve before interpolating */
+  int costWeights; /*!< weight the partitions with the predicted remeshing cost */
+  int trace; /*!< performance trace output (PMMG_TRACE_none/jsonl/chrome) */
+  int convergence; /*!< stop the iterations when the convergence targets are met */
+  double conv_length; /*!< convergence target: max fraction of edges outside [1/sqrt(2),sqrt(2)] */
+  double conv_quality; /*!< convergence target: min quality of the elts touching the interfaces */
+  int freezeGrps; /*!< don't remesh the groups that already conform to the metric */
+  int hierarchical; /*!< node-aware mapping of the parts (0: off, 1: shared memory nodes, n: blocks of n processes) */
+  double repartItr; /*!< edge cut cost relative to the migration cost (0: no migration minimization) */
+  int compressSize; /*!< compress the messages larger than compressSize kB (-1: no compression) */
+  int mpiioOutput; /*!< write the centralized Medit output in parallel (MPI-IO) */
+  int mpiioInput; /*!< read the centralized binary Medit input in parallel (MPI-IO) */
+  int checkpoint; /*!< write a restart checkpoint every checkpoint iterations (0: never) */
+  int restart; /*!< the input mesh is a checkpoint from which the adaptation is resumed */
+  int iterStart; /*!< first iteration of the adaptation loop (set when loading a checkpoint) */
+  int h5Chunk; /*!< chunk size (in entities) of the HDF5 datasets (0: contiguous datasets) */
+  int h5Deflate; /*!< shuffle+deflate level of the HDF5 metric and fields (0: no compression) */
+  int mpiioCbNodes; /*!< MPI-IO hint cb_nodes: number of aggregators (0: MPI default) */
+  int mpiioCbWrite; /*!< MPI-IO hint romio_cb_write (-1: MPI default, 0: disable, 1: enable) */
+  int mpiioStripeCount; /*!< MPI-IO hint striping_factor (0: filesystem default) */
+  int mpiioStripeSize; /*!< MPI-IO hint striping_unit in kB (0: filesystem default) */
   int API_mode; /*!< use faces or nodes information to build communicators */
   int globalNum; /*!< compute nodes and triangles global numbering in output */
   int globalVNumGot; /*!< have global nodes actually been calculated */
@@ -407,6 +498,45 @@ typedef struct {
 } PMMG_Overlap;
 typedef PMMG_Overlap * PMMG_pOverlap;
 
+/**
+ * \struct PMMG_Trace_event
+ * \brief Performance record of one phase on one process (or of one group at
+ * the end of a phase).
+ */
+typedef struct {
+  double tstart;  /*!< Start of the phase (s, since the trace initialization) */
+  double tend;    /*!< End of the phase (s, since the trace initialization) */
+  size_t memCur;  /*!< Memory used by the parmesh and its groups at the end of the phase */
+  size_t memSampled; /*!< Highest memory use sampled at the phase boundaries (its own and those of the nested phases), not a true high-water mark */
+  size_t nbytes;  /*!< Bytes sent to other processes during the phase */
+  int    phase;   /*!< Traced phase (see \ref PMMG_TRACE_phases) */
+  int    iter;    /*!< Adaptation iteration (-1 outside of the adaptation loop) */
+  int    igrp;    /*!< Group index (-1 for a process record) */
+  int    ngrp;    /*!< Number of groups at the end of the phase */
+  int    np;      /*!< Number of points (of the group or of the process) */
+  int    ne;      /*!< Number of tetra (of the group or of the process) */
+} PMMG_Trace_event;
+typedef PMMG_Trace_event * PMMG_pTrace_event;
+
+/**
+ * \struct PMMG_Trace
+ * \brief Performance trace of the run on the current process.
+ */
+typedef struct {
+  PMMG_pTrace_event event; /*!< Array of recorded events */
+  int     nevent;          /*!< Number of recorded events */
+  int     nevent_max;      /*!< Size of the event array */
+  double  t0;              /*!< Time origin (synchronized between processes) */
+  size_t  nbytes;          /*!< Bytes sent since the trace initialization */
+  size_t  nbytesGrps;      /*!< Bytes of migrated groups sent since the beginning of the run */
+  size_t  zbytesIn;        /*!< Uncompressed size of the compressed messages sent since the beginning of the run */
+  size_t  zbytesOut;       /*!< Size of the compressed messages sent since the beginning of the run */
+  int8_t  open[PMMG_TRACE_PHASES_size];    /*!< 1 if the phase is running */
+  double  tstart[PMMG_TRACE_PHASES_size];  /*!< Start time of the running phases */
+  size_t  nbytes0[PMMG_TRACE_PHASES_size]; /*!< Value of nbytes at the phases start */
+  size_t  memSampled[PMMG_TRACE_PHASES_size]; /*!< Highest memory use sampled at the boundaries of the running phases */
+} PMMG_Trace;
+
 /**
  * \struct PMMG_ParMesh
  * \brief ParMmg mesh structure.
@@ -464,6 +594,9 @@ typedef struct {
   /* parameters of the run */
   PMMG_Info      info; /*!< \ref PMMG_Info structure */
 
+  /* performance trace */
+  PMMG_Trace     trace; /*!< \ref PMMG_Trace structure */
+
 } PMMG_ParMesh;
 typedef PMMG_ParMesh  * PMMG_pParMesh;
 
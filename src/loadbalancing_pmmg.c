@@ -46,6 +46,8 @@
  */
 int PMMG_loadBalancing(PMMG_pParMesh parmesh,int partitioning_mode) {
   MMG5_pMesh mesh;
+  size_t     nbytes,zbytesIn,zbytesOut;
+  double     migrated[3],migrated_glob[3];
   int        ier,ier_glob,igrp,ne;
   mytime     ctim[5];
   int8_t     tim;
@@ -54,6 +56,10 @@ int PMMG_loadBalancing(PMMG_pParMesh parmesh,int partitioning_mode) {
 
   tminit(ctim,5);
 
+  if ( parmesh->info.imprim > PMMG_VERB_ITWAVES && PMMG_costWeights_isUsed(parmesh) ) {
+    fprintf(stdout,"               partition weights         predicted remeshing cost\n");
+  }
+
   /** Count the number of interface faces per tetra and store it in mark,
    * retag old parallel faces*/
   if ( parmesh->info.imprim > PMMG_VERB_DETQUAL ) {
@@ -96,10 +102,12 @@ int PMMG_loadBalancing(PMMG_pParMesh parmesh,int partitioning_mode) {
   }
 #endif
 
+  PMMG_trace_start(parmesh,PMMG_TRACE_splitMetis);
   if ( ier ) {
     /** Split the ngrp groups of listgrp into a higher number of groups */
     ier = PMMG_split_n2mGrps(parmesh,PMMG_GRPSPL_DISTR_TARGET,1,partitioning_mode);
   }
+  PMMG_trace_end(parmesh,PMMG_TRACE_splitMetis);
 
 #ifndef NDEBUG
   for ( k=0; k<parmesh->ngrp; ++k ) {
@@ -140,7 +148,12 @@ int PMMG_loadBalancing(PMMG_pParMesh parmesh,int partitioning_mode) {
   }
 #endif
 
+  nbytes    = parmesh->trace.nbytesGrps;
+  zbytesIn  = parmesh->trace.zbytesIn;
+  zbytesOut = parmesh->trace.zbytesOut;
+  PMMG_trace_start(parmesh,PMMG_TRACE_distribute);
   ier = PMMG_distribute_grps(parmesh,partitioning_mode);
+  PMMG_trace_end(parmesh,PMMG_TRACE_distribute);
 
   if ( ier <= 0 ) {
     fprintf(stderr,"\n  ## Group distribution problem.\n");
@@ -157,6 +170,24 @@ int PMMG_loadBalancing(PMMG_pParMesh parmesh,int partitioning_mode) {
     fprintf(stdout,"               group distribution        %s\n",stim);
   }
 
+  /* Volume of the groups migration (bytes sent by the groups transfers, summed
+   * over the processes) and of its compressed messages */
+  if ( parmesh->info.imprim0 > PMMG_VERB_ITWAVES ) {
+    migrated[0] = (double)(parmesh->trace.nbytesGrps - nbytes);
+    migrated[1] = (double)(parmesh->trace.zbytesIn - zbytesIn);
+    migrated[2] = (double)(parmesh->trace.zbytesOut - zbytesOut);
+    MPI_Reduce( migrated,migrated_glob,3,MPI_DOUBLE,MPI_SUM,parmesh->info.root,
+                parmesh->comm );
+    if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+      fprintf(stdout,"               groups migration          %.3g MB\n",
+              migrated_glob[0]/1.e6);
+      if ( migrated_glob[1] > 0. ) {
+        fprintf(stdout,"               compressed messages       %.3g MB -> %.3g MB\n",
+                migrated_glob[1]/1.e6,migrated_glob[2]/1.e6);
+      }
+    }
+  }
+
 
   if ( parmesh->info.imprim > PMMG_VERB_DETQUAL ) {
     tim = 3;
@@ -172,12 +203,14 @@ int PMMG_loadBalancing(PMMG_pParMesh parmesh,int partitioning_mode) {
   }
 #endif
 
+  PMMG_trace_start(parmesh,PMMG_TRACE_splitMmg);
   if ( ier ) {
     /** Redistribute the ngrp groups of listgrp into a lower number of groups */
     ier = PMMG_split_n2mGrps(parmesh,PMMG_GRPSPL_MMG_TARGET,0,partitioning_mode);
     if ( ier<=0 )
       fprintf(stderr,"\n  ## Problem when splitting into a lower number of groups.\n");
   }
+  PMMG_trace_end(parmesh,PMMG_TRACE_splitMmg);
 
   // Algiane: Optim: is this reduce needed?
   MPI_Allreduce( &ier, &ier_glob, 1, MPI_INT, MPI_MIN, parmesh->comm);
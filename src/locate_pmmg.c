@@ -460,6 +460,415 @@ int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint pp
   return found;
 }
 
+/**
+ * \param parmesh pointer to the parmesh structure (used for memory counting)
+ * \param tree pointer to the localization tree
+ * \param dim 3 to build the tree on tetrahedra, 2 to build it on triangles
+ *
+ *  Initialize an empty localization tree. The tree is built only if the
+ *  localization walk fails.
+ *
+ */
+void PMMG_locateTree_init( PMMG_pParMesh parmesh,PMMG_locateTree *tree,int dim ) {
+
+  memset(tree,0,sizeof(PMMG_locateTree));
+  tree->parmesh = parmesh;
+  tree->dim     = dim;
+}
+
+/**
+ * \param tree pointer to the localization tree
+ *
+ *  Free the localization tree.
+ *
+ */
+void PMMG_locateTree_free( PMMG_locateTree *tree ) {
+  PMMG_pParMesh parmesh = tree->parmesh;
+
+  PMMG_DEL_MEM(parmesh,tree->node,PMMG_locateTreeNode,"locTree nodes");
+  PMMG_DEL_MEM(parmesh,tree->elt,int,"locTree elts");
+  PMMG_DEL_MEM(parmesh,tree->stack,int,"locTree stack");
+  tree->nnode = tree->nnodemax = tree->nelt = 0;
+}
+
+/**
+ * \param mesh pointer to the background mesh structure
+ * \param tree pointer to the localization tree
+ * \param k index of the element
+ *
+ * \return pointer to the vertices of the element
+ *
+ *  Get the vertices of a tree element (tetrahedron or triangle).
+ *
+ */
+static inline
+MMG5_int* PMMG_locateTree_vertices( MMG5_pMesh mesh,PMMG_locateTree *tree,int k ) {
+
+  if ( tree->dim == 3 ) {
+    return mesh->tetra[k].v;
+  }
+  return mesh->tria[k].v;
+}
+
+/**
+ * \param mesh pointer to the background mesh structure
+ * \param tree pointer to the localization tree
+ * \param inode index of the node to build
+ * \param depth depth of the node
+ * \param cent centers of mass of the elements
+ *
+ * \return 1 if success, 0 if fail
+ *
+ *  Compute the bounding box of a tree node and recursively split it along the
+ *  largest extent of the element centers until leaves contain less than
+ *  PMMG_LOCTREE_NELT elements.
+ *
+ */
+static
+int PMMG_locateTree_buildNode( MMG5_pMesh mesh,PMMG_locateTree *tree,int inode,
+                               int depth,double *cent ) {
+  PMMG_pParMesh       parmesh = tree->parmesh;
+  PMMG_locateTreeNode *node;
+  double              cmin[3],cmax[3],c,mid,tol;
+  MMG5_int            *v;
+  int                 start,nelt,nl,ichild,nnodemax,axis,i,j,d,tmp;
+
+  if ( depth > tree->depth ) tree->depth = depth;
+
+  node  = &tree->node[inode];
+  start = node->start;
+  nelt  = node->nelt;
+  node->child = 0;
+
+  /** Bounding box of the node elements and of their centers */
+  for ( d=0; d<3; ++d ) {
+    node->min[d] = cmin[d] =  DBL_MAX;
+    node->max[d] = cmax[d] = -DBL_MAX;
+  }
+  for ( i=start; i<start+nelt; ++i ) {
+    v = PMMG_locateTree_vertices(mesh,tree,tree->elt[i]);
+    for ( j=0; j<tree->dim+1; ++j ) {
+      for ( d=0; d<3; ++d ) {
+        c = mesh->point[v[j]].c[d];
+        if ( c < node->min[d] ) node->min[d] = c;
+        if ( c > node->max[d] ) node->max[d] = c;
+      }
+    }
+    for ( d=0; d<3; ++d ) {
+      c = cent[3*tree->elt[i]+d];
+      if ( c < cmin[d] ) cmin[d] = c;
+      if ( c > cmax[d] ) cmax[d] = c;
+    }
+  }
+
+  /** Enlarge the box to take into account the barycentric coordinates
+   * tolerance (and the distance allowed from the surface for triangles) */
+  tol = 0.;
+  for ( d=0; d<3; ++d ) {
+    tol = MG_MAX(tol,node->max[d]-node->min[d]);
+  }
+  tol *= MMG5_EPS;
+  if ( tree->dim == 2 ) {
+    tol += mesh->info.hausd;
+  }
+  for ( d=0; d<3; ++d ) {
+    node->min[d] -= tol;
+    node->max[d] += tol;
+  }
+
+  if ( nelt <= PMMG_LOCTREE_NELT ) return 1;
+
+  /** Split along the largest extent of the element centers */
+  axis = 0;
+  for ( d=1; d<3; ++d ) {
+    if ( cmax[d]-cmin[d] > cmax[axis]-cmin[axis] ) axis = d;
+  }
+  /* Coincident centers: keep a leaf */
+  if ( cmax[axis] <= cmin[axis] ) return 1;
+
+  mid = 0.5*(cmin[axis]+cmax[axis]);
+  nl  = 0;
+  for ( i=start; i<start+nelt; ++i ) {
+    if ( cent[3*tree->elt[i]+axis] < mid ) {
+      tmp                 = tree->elt[i];
+      tree->elt[i]        = tree->elt[start+nl];
+      tree->elt[start+nl] = tmp;
+      ++nl;
+    }
+  }
+  if ( !nl || nl == nelt ) nl = nelt/2;
+
+  /** Create children */
+  if ( tree->nnode+2 > tree->nnodemax ) {
+    nnodemax = (int)(1.5*tree->nnodemax)+2;
+    PMMG_REALLOC(parmesh,tree->node,nnodemax,tree->nnodemax,PMMG_locateTreeNode,
+                 "locTree nodes",return 0);
+    tree->nnodemax = nnodemax;
+  }
+  ichild       = tree->nnode;
+  tree->nnode += 2;
+
+  tree->node[inode].child    = ichild;
+  tree->node[ichild].start   = start;
+  tree->node[ichild].nelt    = nl;
+  tree->node[ichild+1].start = start+nl;
+  tree->node[ichild+1].nelt  = nelt-nl;
+
+  if ( !PMMG_locateTree_buildNode(mesh,tree,ichild,depth+1,cent) ) return 0;
+  if ( !PMMG_locateTree_buildNode(mesh,tree,ichild+1,depth+1,cent) ) return 0;
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the background mesh structure
+ * \param tree pointer to the localization tree
+ *
+ * \return 1 if success, 0 if fail (the tree is left empty)
+ *
+ *  Build the bounding box tree on the valid tetrahedra (or triangles) of the
+ *  background mesh. Element flags are not modified, so the tree can be built
+ *  in the middle of a localization.
+ *
+ */
+static
+int PMMG_locateTree_build( MMG5_pMesh mesh,PMMG_locateTree *tree ) {
+  PMMG_pParMesh parmesh = tree->parmesh;
+  double        *cent;
+  MMG5_int      *v;
+  int           nel,k,j,d,ier;
+
+  tree->built = 1;
+
+  nel = ( tree->dim == 3 ) ? mesh->ne : mesh->nt;
+
+  tree->nelt = 0;
+  for ( k=1; k<=nel; ++k ) {
+    if ( tree->dim == 3 && !MG_EOK(&mesh->tetra[k]) ) continue;
+    if ( tree->dim == 2 && !MG_EOK(&mesh->tria[k]) ) continue;
+    ++tree->nelt;
+  }
+  if ( !tree->nelt ) return 1;
+
+  PMMG_MALLOC(parmesh,tree->elt,tree->nelt,int,"locTree elts",return 0);
+  PMMG_MALLOC(parmesh,cent,3*(nel+1),double,"locTree centers",
+              PMMG_locateTree_free(tree);return 0);
+
+  tree->nelt = 0;
+  for ( k=1; k<=nel; ++k ) {
+    if ( tree->dim == 3 && !MG_EOK(&mesh->tetra[k]) ) continue;
+    if ( tree->dim == 2 && !MG_EOK(&mesh->tria[k]) ) continue;
+    tree->elt[tree->nelt++] = k;
+
+    v = PMMG_locateTree_vertices(mesh,tree,k);
+    for ( d=0; d<3; ++d ) {
+      cent[3*k+d] = 0.;
+      for ( j=0; j<tree->dim+1; ++j ) {
+        cent[3*k+d] += mesh->point[v[j]].c[d];
+      }
+      cent[3*k+d] /= (tree->dim+1);
+    }
+  }
+
+  tree->nnodemax = 2*(tree->nelt/PMMG_LOCTREE_NELT)+1;
+  PMMG_MALLOC(parmesh,tree->node,tree->nnodemax,PMMG_locateTreeNode,"locTree nodes",
+              PMMG_DEL_MEM(parmesh,cent,double,"locTree centers");
+              PMMG_locateTree_free(tree);return 0);
+
+  tree->nnode         = 1;
+  tree->depth         = 0;
+  tree->node[0].start = 0;
+  tree->node[0].nelt  = tree->nelt;
+  ier = PMMG_locateTree_buildNode(mesh,tree,0,0,cent);
+
+  PMMG_DEL_MEM(parmesh,cent,double,"locTree centers");
+
+  /* The depth-first search never stores more than one node per level plus
+   * the two children of the current node */
+  if ( ier ) {
+    PMMG_MALLOC(parmesh,tree->stack,tree->depth+2,int,"locTree stack",ier = 0);
+  }
+
+  if ( !ier ) {
+    PMMG_locateTree_free(tree);
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * \param node pointer to the tree node
+ * \param c coordinates of the point to locate
+ *
+ * \return 1 if the point is in the node bounding box, 0 otherwise
+ *
+ */
+static inline
+int PMMG_locateTree_inBox( PMMG_locateTreeNode *node,double *c ) {
+  int d;
+
+  for ( d=0; d<3; ++d ) {
+    if ( c[d] < node->min[d] || c[d] > node->max[d] ) return 0;
+  }
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the background mesh structure
+ * \param tree pointer to the localization tree
+ * \param ppt pointer to the point to locate
+ * \param nstack pointer to the number of nodes in the tree stack
+ * \param pos pointer to the current position in the elements list
+ * \param end pointer to the end of the current leaf in the elements list
+ *
+ * \return index of the next candidate element, 0 if the search is over
+ *
+ *  Depth-first traversal of the tree leaves containing the point: return the
+ *  next candidate element not yet analyzed (elements analyzed by the walk are
+ *  flagged with mesh->base).
+ *
+ */
+static
+int PMMG_locateTree_next( MMG5_pMesh mesh,PMMG_locateTree *tree,MMG5_pPoint ppt,
+                          int *nstack,int *pos,int *end ) {
+  PMMG_locateTreeNode *node;
+  int                 k;
+
+  while ( 1 ) {
+    /* Unvisited elements of the current leaf */
+    while ( *pos < *end ) {
+      k = tree->elt[(*pos)++];
+      if ( tree->dim == 3 && mesh->tetra[k].flag == mesh->base ) continue;
+      if ( tree->dim == 2 && mesh->tria[k].flag  == mesh->base ) continue;
+      return k;
+    }
+
+    /* Next leaf containing the point */
+    if ( !(*nstack) ) return 0;
+
+    node = &tree->node[tree->stack[--(*nstack)]];
+    if ( !PMMG_locateTree_inBox(node,ppt->c) ) continue;
+
+    if ( node->child ) {
+      tree->stack[(*nstack)++] = node->child+1;
+      tree->stack[(*nstack)++] = node->child;
+    }
+    else {
+      *pos = node->start;
+      *end = node->start+node->nelt;
+    }
+  }
+}
+
+/**
+ * \param mesh pointer to the background mesh structure
+ * \param ppt pointer to the point to locate
+ * \param faceAreas oriented face areas of the all tetrahedra in the mesh
+ * \param barycoord barycentric coordinates of the point to be located
+ * \param idxTet pointer to the index of the found tetrahedron
+ * \param closestTet pointer to the index of the closest tetrahedron
+ * \param closestDist pointer to the distance from the closest tetrahedron
+ * \param tree pointer to the localization tree on tetrahedra
+ *
+ * \return 1 if found, 0 otherwise.
+ *
+ *  Point search on the tetrahedra whose bounding box contains the point. The
+ *  tree is built at the first call.
+ *
+ */
+static
+int PMMG_locatePoint_treeTetra( MMG5_pMesh mesh,MMG5_pPoint ppt,
+                                double *faceAreas,PMMG_barycoord *barycoord,
+                                int *idxTet,int *closestTet,double *closestDist,
+                                PMMG_locateTree *tree ) {
+  int k,nstack,pos,end;
+
+  if ( !tree->built ) {
+    if ( !PMMG_locateTree_build( mesh,tree ) ) {
+      fprintf(stderr,"\n  ## Warning %s: unable to build the localization"
+              " tree, exhaustive researches will be performed.\n",__func__);
+    }
+  }
+  if ( !tree->nnode ) return 0;
+
+  nstack = 1;
+  tree->stack[0] = 0;
+  pos = end = 0;
+
+  while ( (k = PMMG_locateTree_next( mesh,tree,ppt,&nstack,&pos,&end )) ) {
+
+    /* Increase step counter */
+    ppt->s--;
+
+    /** Exit the loop if you find the element */
+    if( PMMG_locatePointInTetra( mesh, &mesh->tetra[k], k, ppt,&faceAreas[12*k],
+                                 barycoord, closestDist, closestTet ) ) {
+      *idxTet = k;
+      tree->nhit++;
+      return 1;
+    }
+  }
+
+  tree->nmiss++;
+  return 0;
+}
+
+/**
+ * \param mesh pointer to the background mesh structure
+ * \param ppt pointer to the point to locate
+ * \param triaNormals non-normalized triangle normals of all mesh triangles
+ * \param barycoord barycentric coordinates of the point to be located
+ * \param iTria pointer to the index of the found triangle
+ * \param closestTria pointer to the index of the closest triangle
+ * \param closestDist pointer to the closest distance
+ * \param tree pointer to the localization tree on triangles
+ *
+ * \return 1 if found, 0 otherwise.
+ *
+ *  Point search on the triangles whose bounding box contains the point. The
+ *  tree is built at the first call.
+ *
+ */
+static
+int PMMG_locatePoint_treeTria( MMG5_pMesh mesh,MMG5_pPoint ppt,
+                               double *triaNormals,PMMG_barycoord *barycoord,
+                               int *iTria,int *closestTria,double *closestDist,
+                               PMMG_locateTree *tree ) {
+  double h;
+  int    k,nstack,pos,end;
+
+  if ( !tree->built ) {
+    if ( !PMMG_locateTree_build( mesh,tree ) ) {
+      fprintf(stderr,"\n  ## Warning %s: unable to build the localization"
+              " tree, exhaustive researches will be performed.\n",__func__);
+    }
+  }
+  if ( !tree->nnode ) return 0;
+
+  nstack = 1;
+  tree->stack[0] = 0;
+  pos = end = 0;
+
+  while ( (k = PMMG_locateTree_next( mesh,tree,ppt,&nstack,&pos,&end )) ) {
+
+    /* Increase step counter */
+    ppt->s--;
+
+    /** Exit the loop if you find the element */
+    if( PMMG_locatePointInTria( mesh, &mesh->tria[k], k, ppt,
+                                &triaNormals[3*k], barycoord,
+                                &h, closestDist, closestTria ) ) {
+      *iTria = k;
+      tree->nhit++;
+      return 1;
+    }
+  }
+
+  tree->nmiss++;
+  return 0;
+}
+
 /**
  * \param mesh pointer to the background mesh structure
  * \param ppt pointer to the point to locate
@@ -577,17 +986,21 @@ int PMMG_locatePoint_foundConvex( MMG5_pMesh mesh,MMG5_pPoint ppt,int *kfound,
  * \param iTria pointer to the index of the triangle
  * \param ifoundEdge pointer to the index of the local edge
  * \param ifoundVertex pointer to the index of the local vertex
+ * \param tree pointer to the localization tree on triangles (NULL to perform
+ * exhaustive searches only)
  *
- * \return 0 if not found (closest), 1 if found, -1 if found through exhaustive
- * search.
+ * \return 0 if not found (closest), 1 if found, -1 if found through the
+ * localization tree or an exhaustive search.
  *
  *  Locate a point in a background mesh surface by traveling the triangles
- *  adjacency.
+ *  adjacency. If the path gets stuck, search the point in the triangles of the
+ *  localization tree, then perform an exhaustive search.
  *
  */
 int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
                          double *triaNormals,int *nodeTrias,PMMG_barycoord *barycoord,
-                         int *iTria,int *ifoundEdge,int *ifoundVertex ) {
+                         int *iTria,int *ifoundEdge,int *ifoundVertex,
+                         PMMG_locateTree *tree ) {
   MMG5_pTria     ptr,ptr1;
   int            *adjt,j,i,k,k1,kprev,step,closestTria,stuck,backward;
   int            iloc;
@@ -692,18 +1105,27 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
   /* Return the index of the tria */
   *iTria = k;
 
-  /** Boundary hit or cyclic path: Perform exhaustive research */
+  /** Boundary hit or cyclic path: Search in the localization tree, then
+   * perform exhaustive research */
   if( stuck ) {
-    if ( !mmgWarn0 ) {
-      mmgWarn0 = 1;
-      if ( mesh->info.imprim > PMMG_VERB_DETQUAL ) {
-        fprintf(stderr,"\n  ## Warning %s: Cannot locate point,"
-                " performing exhaustive research.\n",__func__);
-      }
+    ier = 0;
+    if ( tree ) {
+      ier = PMMG_locatePoint_treeTria( mesh,ppt,triaNormals,barycoord,
+                                       iTria,&closestTria,&closestDist,tree );
     }
 
-    ier = PMMG_locatePoint_exhaustTria( mesh, ppt,triaNormals,barycoord,
-                                           iTria,&closestTria,&closestDist );
+    if ( !ier ) {
+      if ( !mmgWarn0 ) {
+        mmgWarn0 = 1;
+        if ( mesh->info.imprim > PMMG_VERB_DETQUAL ) {
+          fprintf(stderr,"\n  ## Warning %s: Cannot locate point,"
+                  " performing exhaustive research.\n",__func__);
+        }
+      }
+
+      ier = PMMG_locatePoint_exhaustTria( mesh, ppt,triaNormals,barycoord,
+                                          iTria,&closestTria,&closestDist );
+    }
     if( ier ) {
       return -1;
     } else {
@@ -778,16 +1200,20 @@ int PMMG_locatePoint_exhaustTetra( MMG5_pMesh mesh,MMG5_pPoint ppt,
  * \param faceAreas oriented face areas of the all tetrahedra in the mesh
  * \param barycoord barycentric coordinates of the point to be located
  * \param idxTet pointer to the index of the found tetrahedron.
+ * \param tree pointer to the localization tree on tetrahedra (NULL to perform
+ * exhaustive searches only)
  *
- * \return 0 if not found (closest), 1 if found, -1 if found through exhaustive
- * search.
+ * \return 0 if not found (closest), 1 if found, -1 if found through the
+ * localization tree or an exhaustive search.
  *
- *  Locate a point in a background mesh by traveling the elements adjacency.
+ *  Locate a point in a background mesh by traveling the elements adjacency. If
+ *  the path gets stuck, search the point in the tetrahedra of the localization
+ *  tree, then perform an exhaustive search.
  *
  */
 int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
                          double *faceAreas,PMMG_barycoord *barycoord,
-                         int *idxTet ) {
+                         int *idxTet,PMMG_locateTree *tree ) {
   MMG5_pTetra    pt,pt1;
   int            *adja,iel,i,step,closestTet,stuck;
   double         vol,eps,closestDist;
@@ -853,18 +1279,27 @@ int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
   }
 
 
-  /** Boundary hit or cyclic path: Perform exhaustive research */
+  /** Boundary hit or cyclic path: Search in the localization tree, then
+   * perform exhaustive research */
   if( stuck ) {
-    if ( !mmgWarn0 ) {
-      mmgWarn0 = 1;
-      if ( mesh->info.imprim > PMMG_VERB_DETQUAL ) {
-        fprintf(stderr,"\n  ## Warning %s: Cannot locate point,"
-                " performing exhaustive research.\n",__func__);
-      }
+    ier = 0;
+    if ( tree ) {
+      ier = PMMG_locatePoint_treeTetra( mesh,ppt,faceAreas,barycoord,
+                                        idxTet,&closestTet,&closestDist,tree );
     }
 
-    ier = PMMG_locatePoint_exhaustTetra( mesh,ppt,faceAreas,barycoord,
-                                         idxTet,&closestTet,&closestDist );
+    if ( !ier ) {
+      if ( !mmgWarn0 ) {
+        mmgWarn0 = 1;
+        if ( mesh->info.imprim > PMMG_VERB_DETQUAL ) {
+          fprintf(stderr,"\n  ## Warning %s: Cannot locate point,"
+                  " performing exhaustive research.\n",__func__);
+        }
+      }
+
+      ier = PMMG_locatePoint_exhaustTetra( mesh,ppt,faceAreas,barycoord,
+                                           idxTet,&closestTet,&closestDist );
+    }
 
     if( ier ) {
       return -1;
@@ -990,12 +1425,16 @@ void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld ) {
 /**
  * \param mesh pointer to the current mesh structure
  * \param meshOld pointer to the background mesh structure
+ * \param tetraTree pointer to the localization tree on tetrahedra (or NULL)
+ * \param triaTree pointer to the localization tree on triangles (or NULL)
  * \param locStats localization statistics structure
  *
  *  Compute localization statistics.
  *
  */
-void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,PMMG_locateStats *locStats ) {
+void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,
+                                 PMMG_locateTree *tetraTree,PMMG_locateTree *triaTree,
+                                 PMMG_locateStats *locStats ) {
   MMG5_pPoint ppt;
   int         ip,np;
 
@@ -1007,8 +1446,19 @@ void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,PMMG_locateS
   locStats->stepmax  = 0;
   locStats->stepav   = 0;
   locStats->nexhaust = 0;
+  locStats->ntreehit  = 0;
+  locStats->ntreemiss = 0;
   np = 0;
 
+  if ( tetraTree ) {
+    locStats->ntreehit  += tetraTree->nhit;
+    locStats->ntreemiss += tetraTree->nmiss;
+  }
+  if ( triaTree ) {
+    locStats->ntreehit  += triaTree->nhit;
+    locStats->ntreemiss += triaTree->nmiss;
+  }
+
   /* Get the number of steps from the ppt->s field */
   for( ip = 1; ip <= mesh->np; ip++ ) {
     ppt = &mesh->point[ip];
@@ -1047,5 +1497,141 @@ void PMMG_locate_print( PMMG_locateStats *locStats,int ngrp,int myrank ) {
   }
 
   for( igrp = 0; igrp < ngrp; igrp++ )
-    printf("         Localization report (rank %d grp %d): nexhaust %d max step %d, min step %d, av %f\n",myrank,igrp,locStats[igrp].nexhaust,locStats[igrp].stepmax,locStats[igrp].stepmin,locStats[igrp].stepav);
+    printf("         Localization report (rank %d grp %d): nexhaust %d (tree hit %d, miss %d) max step %d, min step %d, av %f\n",myrank,igrp,locStats[igrp].nexhaust,locStats[igrp].ntreehit,locStats[igrp].ntreemiss,locStats[igrp].stepmax,locStats[igrp].stepmin,locStats[igrp].stepav);
+}
+
+/**
+ * \param X integer coordinates of the point (on \ref PMMG_SFC_NBITS bits,
+ * overwritten)
+ *
+ * \return the index of the point along the 3D Hilbert curve.
+ *
+ * Compute the Hilbert index of a point (J. Skilling, "Programming the Hilbert
+ * curve", AIP Conf. Proc. 707, 2004): transform the coordinates into the
+ * transposed Hilbert index, then interleave its bits.
+ *
+ */
+uint64_t PMMG_locate_hilbertKey( uint32_t X[3] ) {
+  uint64_t key;
+  uint32_t M,P,Q,t;
+  int      i,b;
+
+  M = 1u << (PMMG_SFC_NBITS-1);
+
+  /* Inverse undo */
+  for ( Q = M; Q > 1; Q >>= 1 ) {
+    P = Q - 1;
+    for ( i=0; i<3; i++ ) {
+      if ( X[i] & Q ) {
+        X[0] ^= P;
+      }
+      else {
+        t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  /* Gray encode */
+  for ( i=1; i<3; i++ ) X[i] ^= X[i-1];
+  t = 0;
+  for ( Q = M; Q > 1; Q >>= 1 )
+    if ( X[2] & Q ) t ^= Q - 1;
+  for ( i=0; i<3; i++ ) X[i] ^= t;
+
+  /* Interleave the bits of the transposed index */
+  key = 0;
+  for ( b = PMMG_SFC_NBITS-1; b >= 0; b-- )
+    for ( i=0; i<3; i++ )
+      key = (key << 1) | ((X[i] >> b) & 1u);
+
+  return key;
+}
+
+/**
+ * \param a pointer toward a (key,point) pair
+ * \param b pointer toward a (key,point) pair
+ *
+ * \return -1, 0 or 1 depending on the order of the keys of \a a and \a b.
+ *
+ * Comparison function for the sorting of points along the Hilbert curve.
+ *
+ */
+static
+int PMMG_locate_compareKeys( const void *a,const void *b ) {
+  const uint64_t ka = ((const uint64_t*)a)[0];
+  const uint64_t kb = ((const uint64_t*)b)[0];
+
+  if ( ka < kb ) return -1;
+  if ( ka > kb ) return  1;
+
+  /* Keep the storage order for equal keys */
+  if ( ((const uint64_t*)a)[1] < ((const uint64_t*)b)[1] ) return -1;
+  return ((const uint64_t*)a)[1] > ((const uint64_t*)b)[1];
+}
+
+/**
+ * \param mesh pointer to the current mesh structure
+ * \param list list of point indices
+ * \param n number of points in the list
+ *
+ * \return 0 if fail, 1 if success
+ *
+ * Sort a list of points of the mesh along the Hilbert space-filling curve of
+ * the bounding box of the points, so that consecutive points of the list are
+ * close in space.
+ *
+ */
+int PMMG_locate_sfcSort( MMG5_pMesh mesh,int *list,int n ) {
+  MMG5_pPoint ppt;
+  uint64_t    *keys;
+  uint32_t    X[3],nmax;
+  double      min[3],max[3],scale,len;
+  int         k,d;
+
+  if ( n < 2 ) return 1;
+
+  /* Bounding box of the points */
+  for ( d=0; d<3; d++ ) {
+    min[d] =  DBL_MAX;
+    max[d] = -DBL_MAX;
+  }
+  for ( k=0; k<n; k++ ) {
+    ppt = &mesh->point[list[k]];
+    for ( d=0; d<3; d++ ) {
+      min[d] = MG_MIN(min[d],ppt->c[d]);
+      max[d] = MG_MAX(max[d],ppt->c[d]);
+    }
+  }
+
+  len = 0.0;
+  for ( d=0; d<3; d++ )
+    len = MG_MAX(len,max[d]-min[d]);
+  if ( len <= 0.0 ) return 1;
+
+  nmax  = (1u << PMMG_SFC_NBITS) - 1;
+  scale = (double)nmax / len;
+
+  /* Compute the (key,point) pairs */
+  PMMG_MALLOC(mesh,keys,2*n,uint64_t,"sfc keys",return 0);
+
+  for ( k=0; k<n; k++ ) {
+    ppt = &mesh->point[list[k]];
+    for ( d=0; d<3; d++ ) {
+      X[d] = (uint32_t)((ppt->c[d]-min[d])*scale);
+      X[d] = MG_MIN(X[d],nmax);
+    }
+    keys[2*k]   = PMMG_locate_hilbertKey( X );
+    keys[2*k+1] = (uint64_t)list[k];
+  }
+
+  qsort( keys,n,2*sizeof(uint64_t),PMMG_locate_compareKeys );
+
+  for ( k=0; k<n; k++ )
+    list[k] = (int)keys[2*k+1];
+
+  PMMG_DEL_MEM(mesh,keys,uint64_t,"sfc keys");
+
+  return 1;
 }
@@ -47,8 +47,75 @@ typedef struct {
   int    nexhaust; /*!< number of exhaustive searches */
   int    stepmax;  /*!< maximum number of steps on the search paths */
   int    stepmin;  /*!< minimum number of steps on the search paths */
+  int    ntreehit; /*!< number of failed walks solved by the bounding box trees */
+  int    ntreemiss;/*!< number of failed walks not solved by the bounding box trees */
 } PMMG_locateStats;
 
+/**
+ * \def PMMG_LOCTREE_NELT
+ *
+ * Maximal number of elements stored in a leaf of a localization tree
+ *
+ */
+#define PMMG_LOCTREE_NELT 8
+
+/** \struct PMMG_locateTreeNode
+ *
+ * \brief Node of a bounding box tree
+ *
+ */
+typedef struct {
+  double min[3]; /*!< lower bounds of the node bounding box */
+  double max[3]; /*!< upper bounds of the node bounding box */
+  int    child;  /*!< index of the first child (the second one follows), 0 for leaves */
+  int    start;  /*!< position of the first node element in the elements list */
+  int    nelt;   /*!< number of elements in the node */
+} PMMG_locateTreeNode;
+
+/** \struct PMMG_locateTree
+ *
+ * \brief Bounding box tree on the tetrahedra or the triangles of a background
+ * mesh, used as fallback when the localization walk gets stuck.
+ *
+ */
+typedef struct {
+  PMMG_pParMesh       parmesh; /*!< parmesh used for memory accounting */
+  PMMG_locateTreeNode *node;   /*!< tree nodes (the root is node 0) */
+  int                 *elt;    /*!< element indices sorted by leaves */
+  int                 *stack;  /*!< stack of nodes to visit during a search */
+  int                 nnode;   /*!< number of used nodes */
+  int                 nnodemax;/*!< number of allocated nodes */
+  int                 nelt;    /*!< number of elements stored in the tree */
+  int                 depth;   /*!< tree depth */
+  int                 dim;     /*!< 3 for a tree on tetra, 2 for a tree on tria */
+  int8_t              built;   /*!< 1 if the tree construction has been tried */
+  int                 nhit;    /*!< number of points found through the tree */
+  int                 nmiss;   /*!< number of points not found through the tree */
+} PMMG_locateTree;
+
+/**
+ * \def PMMG_SFC_NBITS
+ *
+ * Number of bits per direction of the space-filling curve keys
+ *
+ */
+#define PMMG_SFC_NBITS 21
+
+/** \struct PMMG_locateResults
+ *
+ * \brief Results of the batched localization of points, stored as a structure
+ * of arrays: the points are interpolated from these data in a second pass
+ *
+ */
+typedef struct {
+  int    n;       /*!< number of located points */
+  int    *ip;     /*!< indices of the points in the current mesh */
+  int    *iel;    /*!< found tetra (or tria for boundary points) */
+  int    *iedge;  /*!< found edge of the tria (PMMG_UNSET if none) */
+  int    *ivertex;/*!< found vertex of the tria (PMMG_UNSET if none) */
+  double *phi;    /*!< barycentric coordinates ordered by element vertex (4 per point) */
+} PMMG_locateResults;
+
 int PMMG_precompute_triaNormals( MMG5_pMesh mesh,double *triaNormals );
 int PMMG_precompute_faceAreas( MMG5_pMesh mesh,double *faceAreas );
 int PMMG_precompute_nodeTrias( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int **nodeTrias );
@@ -58,15 +125,22 @@ int PMMG_locatePointInTria( MMG5_pMesh mesh,MMG5_pTria ptr,int k,MMG5_pPoint ppt
 int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint ppt,
                              double *faceAreas,PMMG_barycoord *barycoord,
                              double *closestDist,int *closestTet);
+void PMMG_locateTree_init( PMMG_pParMesh parmesh,PMMG_locateTree *tree,int dim );
+void PMMG_locateTree_free( PMMG_locateTree *tree );
 int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
                          double *triaNormals,int *nodeTrias,PMMG_barycoord *barycoord,
-                         int *iTria,int *foundWedge,int *foundCone );
+                         int *iTria,int *foundWedge,int *foundCone,
+                         PMMG_locateTree *tree );
 int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
                          double *faceAreas,PMMG_barycoord *barycoord,
-                         int *idxTet );
+                         int *idxTet,PMMG_locateTree *tree );
 void PMMG_locatePoint_errorCheck( MMG5_pMesh mesh,int ip,int ier,int myrank,int igrp );
 void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld );
-void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,PMMG_locateStats *locStats );
+uint64_t PMMG_locate_hilbertKey( uint32_t X[3] );
+int PMMG_locate_sfcSort( MMG5_pMesh mesh,int *list,int n );
+void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,
+                                 PMMG_locateTree *tetraTree,PMMG_locateTree *triaTree,
+                                 PMMG_locateStats *locStats );
 void PMMG_locate_print( PMMG_locateStats *locStats,int ngrp,int myrank );
 
 #endif
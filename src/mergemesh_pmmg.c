@@ -1074,535 +1074,699 @@ fail_ncomm:
 
 /**
  * \param parmesh pointer toward the parmesh structure.
- * \param rcv_grps array of groups to allocate and fill.
- * \param rcv_int_node_comm array of internal communicators to allocate and fill.
- * \param rcv_next_node_comm array of number external comm to alloc and fill.
- * \param rcv_ext_node_comm array of external comms to allocate and fill.
+ * \param sizes array of size 5 to fill with the number of points and xpoints
+ * owned by the proc, the number of tetra and xtetra of the proc and the size
+ * of its packed parmesh.
  *
- * \return 0 if fail, 1 otherwise (no allreduce over procs)
+ * Compute the size of the contribution of the proc to the merged mesh. A point
+ * is owned by the proc if it is not shared with a proc of lower rank.
  *
- * Gather the parmeshes on the proc 0.
+ * \warning the intvalues array of the internal node communicator must be filled.
  *
- * The data received from processor \a k
- * are strored in the \a k index of the arrays \a rcv_grps, \a
- * rcv_int_node_comm, \a rcv_next_node_comm and \a rcv_ext_node_comm.
+ */
+static inline
+void PMMG_mergeParmesh_sizes( PMMG_pParMesh parmesh,int *sizes ) {
+  PMMG_pExt_comm ext_node_comm;
+  MMG5_pMesh     mesh;
+  MMG5_pPoint    ppt;
+  int            *intvalues,k,i;
+
+  sizes[0] = sizes[1] = sizes[2] = sizes[3] = 0;
+  sizes[4] = PMMG_mpisizeof_parmesh ( parmesh );
+
+  if ( (!parmesh->ngrp) || (!parmesh->listgrp[0].mesh) ) return;
+
+  mesh      = parmesh->listgrp[0].mesh;
+  intvalues = parmesh->int_node_comm->intvalues;
+
+  for ( i=1; i<=mesh->np; ++i ) mesh->point[i].tmp = 0;
+
+  /* Mark the points shared with a lower proc */
+  for ( k=0; k<parmesh->next_node_comm; ++k ) {
+    ext_node_comm = &parmesh->ext_node_comm[k];
+    if ( ext_node_comm->color_out > parmesh->myrank ) continue;
+
+    for ( i=0; i<ext_node_comm->nitem; ++i ) {
+      mesh->point[intvalues[ext_node_comm->int_comm_index[i]]].tmp = 1;
+    }
+  }
+
+  for ( i=1; i<=mesh->np; ++i ) {
+    ppt = &mesh->point[i];
+    if ( ppt->tmp ) {
+      ppt->tmp = 0;
+      continue;
+    }
+    ++sizes[0];
+    if ( ppt->xp ) ++sizes[1];
+  }
+
+  sizes[2] = mesh->ne;
+  for ( k=1; k<=mesh->ne; ++k ) {
+    if ( mesh->tetra[k].xt ) ++sizes[3];
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param grp pointer toward the merged group to allocate.
+ * \param np number of points of the merged mesh.
+ * \param xp number of xpoints of the merged mesh.
+ * \param ne number of tetra of the merged mesh.
+ * \param xt number of xtetra of the merged mesh.
  *
+ * \return 0 if fail, 1 otherwise.
  *
- * \warning We must have at most 1 group per parmesh
+ * Allocate the merged group and its mesh arrays at their final size. The
+ * solution arrays are allocated when the first non-empty mesh is appended.
  *
  */
 static inline
-int PMMG_gather_parmesh( PMMG_pParMesh parmesh,
-                         PMMG_pGrp *rcv_grps,
-                         PMMG_pInt_comm *rcv_int_node_comm,
-                         int **rcv_next_node_comm,
-                         PMMG_pExt_comm **rcv_ext_node_comm ) {
-  size_t     pack_size_tot,next_disp,*displs,buf_idx;
-  int        *rcv_pack_size,ier,ier_glob,k,ier_pack;
-  int        nprocs,root,pack_size;
-  char       *rcv_buffer,*ptr_to_free,*buffer;
-
-  nprocs        = parmesh->nprocs;
-  root          = parmesh->info.root;
-
-  ier           = ier_glob = 1;
-
-  (*rcv_grps)           = NULL;
-  (*rcv_int_node_comm)  = NULL;
-  (*rcv_next_node_comm) = NULL;
-  (*rcv_ext_node_comm)  = NULL;
-  rcv_pack_size         = NULL;
-  displs                = NULL;
-  rcv_buffer            = NULL;
-  buffer                = NULL;
-
-  /** 1: Memory alloc */
-  if ( parmesh->myrank == root ) {
-    PMMG_MALLOC( parmesh, rcv_pack_size        ,nprocs,int,"rcv_pack_size",ier=0);
-    PMMG_MALLOC( parmesh, displs               ,nprocs,size_t,"displs for gatherv",ier=0);
-    PMMG_CALLOC( parmesh, (*rcv_grps)          ,nprocs,PMMG_Grp,"rcv_grps",ier=0);
-    PMMG_MALLOC( parmesh, (*rcv_int_node_comm) ,nprocs,PMMG_Int_comm,"rcv_int_comm" ,ier=0);
-    PMMG_MALLOC( parmesh, (*rcv_next_node_comm),nprocs,int,"rcv_next_comm" ,ier=0);
-    PMMG_MALLOC( parmesh, (*rcv_ext_node_comm) ,nprocs,PMMG_pExt_comm,"rcv_ext_comm" ,ier=0);
-  }
+int PMMG_mergeParmesh_allocGrp( PMMG_pParMesh parmesh,PMMG_pGrp *grp,
+                                int np,int xp,int ne,int xt ) {
+  MMG5_pMesh mesh;
+  int        k;
 
-  /** 2: Gather pack size of parmeshes on proc 0 */
-  pack_size = PMMG_mpisizeof_parmesh ( parmesh );
+  PMMG_CALLOC(parmesh,*grp,1,PMMG_Grp,"listgrp", return 0);
 
-#ifndef NDEBUG
-  MPI_Allreduce( &ier, &ier_glob, 1, MPI_INT, MPI_MIN, parmesh->comm);
-  if ( !ier_glob ) {
-    return ier_glob;
-  }
-#endif
+  MMG3D_Init_mesh( MMG5_ARG_start, MMG5_ARG_ppMesh, &(*grp)->mesh,
+                   MMG5_ARG_ppMet, &(*grp)->met, MMG5_ARG_end );
 
-  MPI_CHECK(MPI_Gather(&pack_size,1,MPI_INT,rcv_pack_size,1,MPI_INT,root,parmesh->comm),ier = 0);
+  mesh = (*grp)->mesh;
 
-  /** 3: Gather compressed parmeshes */
-  /* Compute data for gatherv: displacement array and receiver buffer size */
-  if ( parmesh->myrank == root ) {
-    displs[0] = 0;
-    for ( k=1; k<nprocs; ++k ) {
-      next_disp = displs[k-1] + rcv_pack_size[k-1];
-      displs[k] = next_disp;
-    }
+  /* Set maximum memory */
+  mesh->memMax = parmesh->memGloMax;
 
-    /* On root, we will gather all the meshes in rcv_buffer so we have to
-     * compute the total pack size */
-    pack_size_tot        = (size_t)(displs[nprocs-1])+(size_t)(rcv_pack_size[nprocs-1]);
-    assert ( pack_size_tot < SIZE_MAX && "SIZE_MAX overflow" );
+  mesh->np    = mesh->npmax = np;
+  mesh->npnil = 0;
+  mesh->xp    = mesh->xpmax = xp;
+  mesh->ne    = mesh->nemax = ne;
+  mesh->nenil = 0;
+  mesh->xt    = mesh->xtmax = xt;
 
-    /* root will write directly in the suitable position of rcv_buffer */
-    buf_idx = displs[root];
-  }
-  else {
-    /* on ranks other than root we just need to store the local mesh so buffer
-     * will be of size pack_size */
-    pack_size_tot = pack_size;
-    /* we will write the mesh at the starting position */
-    buf_idx = 0;
-  }
+  MMG5_ADD_MEM(mesh,(mesh->npmax+1)*sizeof(MMG5_Point),"merge point",
+               fprintf(stderr,"  Exit program.\n");
+               return 0);
+  MMG5_SAFE_CALLOC(mesh->point,mesh->npmax+1,MMG5_Point,return 0);
 
-  PMMG_MALLOC( parmesh,rcv_buffer,pack_size_tot,char,"rcv_buffer",ier=0);
+  MMG5_ADD_MEM(mesh,(mesh->xpmax+1)*sizeof(MMG5_xPoint),"merge xPoint",
+               fprintf(stderr,"  Exit program.\n");
+               return 0);
+  MMG5_SAFE_CALLOC(mesh->xpoint,mesh->xpmax+1,MMG5_xPoint,return 0);
 
-  /* Parmesh compression */
-  buffer = &rcv_buffer[buf_idx];
+  MMG5_ADD_MEM(mesh,(mesh->nemax+1)*sizeof(MMG5_Tetra),"tetra",
+               fprintf(stderr,"  Exit program.\n");
+               return 0);
+  MMG5_SAFE_CALLOC(mesh->tetra,mesh->nemax+1,MMG5_Tetra,return 0);
 
-  /* Save input allocated address to avoid arrors at unalloc */
-  ptr_to_free = rcv_buffer;
+  MMG5_ADD_MEM(mesh,(mesh->xtmax+1)*sizeof(MMG5_xTetra),"xtetra",
+               fprintf(stderr,"  Exit program.\n");
+               return 0);
+  MMG5_SAFE_CALLOC(mesh->xtetra,mesh->xtmax+1,MMG5_xTetra,return 0);
 
-#ifndef NDEBUG
-  /* Remark: in release mode, a non allocated buffer used in gatherv creates a
-     segfault over all procs */
-  MPI_Allreduce( &ier, &ier_glob, 1, MPI_INT, MPI_MIN, parmesh->comm);
-  if ( !ier_glob ) {
-    return ier_glob;
-  }
-#endif
+  for ( k=1; k<=mesh->np; ++k ) mesh->point[k].tag = MG_NUL;
 
-  /* /!\ mpipack_parmesh and mpiunpack_parmesh are modifying the buffer pointer
-   * making it not valid for realloc / unalloc */
+  return 1;
+}
 
-  /* Save adress of buffer because it will be set the the end of the char array
-  by the \a PMMG_mpipack_parmesh function */
-  char *buffer_to_send = buffer;
-  ier_pack = PMMG_mpipack_parmesh ( parmesh ,&buffer );
+/**
+ * \param mesh pointer toward the merged mesh.
+ * \param grp pointer toward the merged group.
+ * \param grp_1 pointer toward the first non-empty group appended.
+ *
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Allocate the solution structures of the merged group with the types of the
+ * solutions of \a grp_1.
+ *
+ */
+static inline
+int PMMG_mergeParmesh_allocSols( MMG5_pMesh mesh,PMMG_pGrp grp,PMMG_pGrp grp_1 ) {
+  int i,type[MMG5_NSOLS_MAX];
 
-  /* Do not use \a buffer pointer after this call: it points toward the end of
-   * the packed array which is useless */
-  buffer = NULL;
+  mesh->nsols = grp_1->mesh->nsols;
 
-  assert ( ier_pack );
-
-  /* Gather the packed parmeshes */
-  ier = MG_MIN ( ier, ier_pack );
-
-  /* Here the gatherv call has been replaced by a send/recv to avoid errors when
-   * displacements overflow the INT_MAX value */
-  if (parmesh->myrank == root) {
-    int i;
-    for ( i = 0; i < nprocs; ++i ) {
-      if ( i != root ) {
-        MPI_CHECK(
-          MPI_Recv(rcv_buffer + displs[i], rcv_pack_size[i], MPI_CHAR, i,
-                   MPI_MERGEMESH_TAG, parmesh->comm, MPI_STATUS_IGNORE),
-          ier = 0);
-      }
-    }
-  } else {
-    MPI_CHECK(
-      MPI_Send(buffer_to_send, pack_size, MPI_CHAR, root, MPI_MERGEMESH_TAG,parmesh->comm),
-      ier = 0);
+  if ( grp_1->met && grp_1->met->m ) {
+    if ( 1 != MMG3D_Set_solSize(mesh,grp->met,MMG5_Vertex,mesh->np,
+                                grp_1->met->type) ) return 0;
   }
-
-  /** 4: Unpack parmeshes */
-#ifndef NDEBUG
-  MPI_Allreduce( &ier, &ier_glob, 1, MPI_INT, MPI_MIN, parmesh->comm);
-  if ( !ier_glob ) {
-    return ier_glob;
+  if ( grp_1->ls && grp_1->ls->m ) {
+    PMMG_CALLOC(mesh,grp->ls,1,MMG5_Sol,"ls",return 0);
+    if ( 1 != MMG3D_Set_solSize(mesh,grp->ls,MMG5_Vertex,mesh->np,
+                                grp_1->ls->type) ) return 0;
+  }
+  if ( grp_1->disp && grp_1->disp->m ) {
+    PMMG_CALLOC(mesh,grp->disp,1,MMG5_Sol,"disp",return 0);
+    if ( 1 != MMG3D_Set_solSize(mesh,grp->disp,MMG5_Vertex,mesh->np,
+                                grp_1->disp->type) ) return 0;
   }
-#endif
 
-  if ( parmesh->myrank == root ) {
-    for ( k=0; k<nprocs; ++k ) {
-      ier_pack = PMMG_mpiunpack_parmesh ( parmesh,(*rcv_grps),k,(*rcv_int_node_comm)+k,
-                                          (*rcv_next_node_comm)+k,(*rcv_ext_node_comm)+k,
-                                          &rcv_buffer );
-      ier = MG_MIN(ier_pack,ier);
+  if ( mesh->nsols ) {
+    assert ( !grp->field );
+    for ( i=0; i<mesh->nsols; ++i ) {
+      type[i] = grp_1->field[i].type;
     }
+    if ( 1 != MMG3D_Set_solsAtVerticesSize( mesh,&grp->field,mesh->nsols,
+                                            mesh->np,type) ) return 0;
   }
 
-  /** Free the memory */
-  /* Free temporary arrays */
-  PMMG_DEL_MEM(parmesh,rcv_pack_size,int,"rcv_pack_size");
-  PMMG_DEL_MEM(parmesh,displs,int,"displs");
-  /* the address of rcv_buffer is modified by packing/unpacking so it is needed
-   * to send the initially allocated address stored in to the unalloc macro */
-  PMMG_DEL_MEM(parmesh,ptr_to_free,char,"rcv_buffer");
-
-  return ier;
+  return 1;
 }
 
-
 /**
  * \param parmesh pointer toward the parmesh structure.
- * \param rcv_grps array containing groups data.
- * \param rcv_int_node_comm array containing internal communicators.
- * \param rcv_next_node_comm array of number external comm.
- * \param rcv_ext_node_comm array containing external comms.
+ * \param grp pointer toward the merged group.
+ * \param k rank of the proc that owns \a grp_1.
+ * \param grp_1 group of proc \a k (may be NULL).
+ * \param intvalues_1 intvalues array of the internal node comm of proc \a k.
+ * \param next_node_comm_1 number of external node comms of proc \a k.
+ * \param ext_node_comm_1 external node comms of proc \a k.
+ * \param gid_comm for each appended proc, the global indices of the points
+ * shared with higher procs, stored in the \a int_comm_index arrays of a list
+ * of external communicators.
+ * \param ngid_comm for each appended proc, the number of comms of \a gid_comm.
+ * \param np number of points already appended to the merged mesh.
+ * \param xp number of xpoints already appended to the merged mesh.
+ * \param ne number of tetra already appended to the merged mesh.
+ * \param xt number of xtetra already appended to the merged mesh.
  *
- * \return 0 if fail, 1 otherwise (no allreduce over procs)
+ * \return 0 if fail, 1 otherwise.
  *
- * Merge the parmeshes data contained in the rcv_* arrays into 1 parmesh with 1
- * group.
+ * Append the mesh of proc \a k to the merged mesh. The procs must be appended
+ * in increasing rank order: the points shared with a lower proc have already
+ * been appended and we pick their global index from \a gid_comm, the other
+ * points are new points. The global indices of the points shared with a higher
+ * proc are then stored in \a gid_comm.
  *
  */
 static inline
-int PMMG_mergeParmesh_rcvParMeshes ( PMMG_pParMesh parmesh,PMMG_pGrp rcv_grps,
-                                     PMMG_pInt_comm rcv_int_node_comm,
-                                     int *rcv_next_node_comm,
-                                     PMMG_pExt_comm *rcv_ext_node_comm ) {
-  PMMG_pGrp      grp,grp_1,grp_2;
-  PMMG_pInt_comm int_node_comm_1,int_node_comm_2;
-  PMMG_pExt_comm ext_node_comm_1,ext_node_comm_2;
-  MMG5_pMesh     mesh;
-  MMG5_pPoint    point_1,point_2,ppt;
-  MMG5_pxPoint   xpoint_1,pxp;
-  MMG5_pTetra    tetra_1,pt;
-  MMG5_pxTetra   xtetra_1,pxt;
-  MMG5_pSol      met,ls,disp,psl,met_1,ls_1,disp_1,psl_1;
-  size_t         memAv;
-  int            is,*int_comm_index_1,*int_comm_index_2;
-  int            next_node_comm_1,next_node_comm_2;
-  int            *intvalues_1,*intvalues_2,nitem_1,nitem_2;
-  int            nprocs,k,i,j,idx,color_in,color_out;
-  int            np,ne,xt,ne_tot,xt_tot,ismet,isls,isdisp;
-  int            type[MMG5_NSOLS_MAX];
+int PMMG_mergeParmesh_appendGrp( PMMG_pParMesh parmesh,PMMG_pGrp grp,int k,
+                                 PMMG_pGrp grp_1,int *intvalues_1,
+                                 int next_node_comm_1,
+                                 PMMG_pExt_comm ext_node_comm_1,
+                                 PMMG_pExt_comm *gid_comm,int *ngid_comm,
+                                 int *np,int *xp,int *ne,int *xt ) {
+  PMMG_pExt_comm ext_node_comm,gid_comm_2;
+  MMG5_pMesh     mesh,mesh_1;
+  MMG5_pPoint    point_1,ppt;
+  MMG5_pTetra    pt;
+  MMG5_pSol      met,ls,disp,psl,psl_1;
+  int            np0,is,i,j,idx,color_out,ngid;
+
+  gid_comm[k]  = NULL;
+  ngid_comm[k] = 0;
+
+  if ( (!grp_1) || (!grp_1->mesh) ) return 1;
+
+  mesh    = grp->mesh;
+  mesh_1  = grp_1->mesh;
+  point_1 = mesh_1->point;
+  np0     = *np;
+
+  for ( i=1; i<=mesh_1->np; ++i ) point_1[i].tmp = 0;
+
+  /** Recover the indices of the points shared with a lower proc */
+  for ( i=0; i<next_node_comm_1; ++i ) {
+    ext_node_comm = &ext_node_comm_1[i];
+    color_out     = ext_node_comm->color_out;
+
+    assert( ext_node_comm->color_in==k );
+    assert( color_out!=k );
+
+    if ( color_out > k ) continue;
+
+    /* Find the matching communicator over proc color_out (->k) */
+    gid_comm_2 = NULL;
+    for ( j=0; j<ngid_comm[color_out]; ++j ) {
+      if ( gid_comm[color_out][j].color_out == k ) {
+        gid_comm_2 = &gid_comm[color_out][j];
+        break;
+      }
+    }
+    if ( (!gid_comm_2) || gid_comm_2->nitem != ext_node_comm->nitem ) {
+      fprintf(stderr,"\n  ## Error: %s: unable to match the interface of procs"
+              " %d and %d.\n",__func__,color_out,k);
+      return 0;
+    }
 
-  nprocs = parmesh->nprocs;
+    for ( j=0; j<ext_node_comm->nitem; ++j ) {
+      point_1[intvalues_1[ext_node_comm->int_comm_index[j]]].tmp =
+        gid_comm_2->int_comm_index[j];
+    }
 
-  if ( parmesh->myrank != parmesh->info.root ) return 1;
+    /* The interface color_out->k is no more needed */
+    PMMG_DEL_MEM(parmesh,gid_comm_2->int_comm_index,int,"global indices");
+  }
 
-  assert ( !parmesh->listgrp );
+  /** Create new indices for the other points */
+  for ( i=1; i<=mesh_1->np; ++i ) {
+    if ( !point_1[i].tmp ) {
+      point_1[i].tmp = ++(*np);
+    }
+  }
+  if ( *np > mesh->np ) {
+    fprintf(stderr,"\n  ## Error: %s: unexpected number of points on proc %d.\n",
+            __func__,k);
+    return 0;
+  }
 
-  PMMG_CALLOC(parmesh,parmesh->listgrp,1,PMMG_Grp,"listgrp", return 0);
+  /** Store the indices of the points shared with a higher proc */
+  ngid = 0;
+  for ( i=0; i<next_node_comm_1; ++i ) {
+    if ( ext_node_comm_1[i].color_out > k ) ++ngid;
+  }
 
-  MMG3D_Init_mesh( MMG5_ARG_start, MMG5_ARG_ppMesh, &parmesh->listgrp[0].mesh,
-                   MMG5_ARG_ppMet, &parmesh->listgrp[0].met, MMG5_ARG_end );
+  if ( ngid ) {
+    PMMG_CALLOC(parmesh,gid_comm[k],ngid,PMMG_Ext_comm,"gid_comm",return 0);
+    ngid_comm[k] = ngid;
 
+    ngid = 0;
+    for ( i=0; i<next_node_comm_1; ++i ) {
+      ext_node_comm = &ext_node_comm_1[i];
+      if ( ext_node_comm->color_out < k ) continue;
 
-  grp    = &parmesh->listgrp[0];
-  mesh   = grp->mesh;
-  met    = grp->met ;
+      gid_comm_2            = &gid_comm[k][ngid++];
+      gid_comm_2->color_in  = k;
+      gid_comm_2->color_out = ext_node_comm->color_out;
+      gid_comm_2->nitem     = ext_node_comm->nitem;
 
-  /* Set maximum memory */
-  mesh->memMax = parmesh->memGloMax;
+      if ( !gid_comm_2->nitem ) continue;
 
-  np = 0;
+      PMMG_MALLOC(parmesh,gid_comm_2->int_comm_index,gid_comm_2->nitem,int,
+                  "global indices",return 0);
+      for ( j=0; j<gid_comm_2->nitem; ++j ) {
+        gid_comm_2->int_comm_index[j] =
+          point_1[intvalues_1[ext_node_comm->int_comm_index[j]]].tmp;
+      }
+    }
+  }
 
-  /** Mesh renumbering to have the same indices at points shared by multiple
-   * processors; The new indices are stored in the tmp field of the MMG5_Point
-   * structure. */
-  for ( k=0; k<nprocs; ++k ) {
-    grp_1            = &rcv_grps[k];
-    int_node_comm_1  = &rcv_int_node_comm[k];
-    ext_node_comm_1  = rcv_ext_node_comm[k];
-    next_node_comm_1 = rcv_next_node_comm[k];
-
-    /* Points and internal communicators for proc \a k */
-    point_1     = grp_1->mesh->point;
-    intvalues_1 = int_node_comm_1->intvalues;
-
-    /* Travel through the external communicators that lists the points at the
-     * interface of the procs color_in and color_out: if color_in<color_out,
-     * create new indices for the points over the color_in proc. If
-     * color_out<color_in, get the indices from the matching points over the
-     * proc color_out. */
-    for ( i=0; i<next_node_comm_1; ++i ) {
-      nitem_1 = ext_node_comm_1[i].nitem;
+  /** Allocate the solutions with the first non-empty mesh */
+  if ( (!np0) && mesh_1->np ) {
+    if ( !PMMG_mergeParmesh_allocSols(mesh,grp,grp_1) ) return 0;
+  }
+  met  = grp->met;
+  ls   = grp->ls;
+  disp = grp->disp;
+
+  /** Points owned by proc k, their xpoints and solutions */
+  for ( i=1; i<=mesh_1->np; ++i ) {
+    idx = point_1[i].tmp;
+    if ( idx <= np0 ) continue;
+
+    ppt = &mesh->point[idx];
+    memcpy(ppt,&point_1[i],sizeof(MMG5_Point));
+    ppt->tmp = 0;
+    ppt->xp  = 0;
+
+    if ( point_1[i].xp ) {
+      if ( *xp >= mesh->xp ) {
+        fprintf(stderr,"\n  ## Error: %s: unexpected number of xpoints on"
+                " proc %d.\n",__func__,k);
+        return 0;
+      }
+      memcpy(&mesh->xpoint[++(*xp)],&mesh_1->xpoint[point_1[i].xp],
+             sizeof(MMG5_xPoint));
+      ppt->xp = *xp;
+    }
 
-      int_comm_index_1 = ext_node_comm_1[i].int_comm_index;
+    /* Copy solution structures */
+    if ( met && met->m ) {
+      assert ( grp_1->met->size == met->size );
+      memcpy ( &met->m[idx*met->size],&grp_1->met->m[i*met->size],
+               met->size*sizeof(double) );
+    }
+    if ( ls ) {
+      assert ( ls->m && grp_1->ls->size == ls->size );
+      memcpy ( &ls->m[idx*ls->size],&grp_1->ls->m[i*ls->size],
+               ls->size*sizeof(double) );
+    }
+    if ( disp ) {
+      assert ( disp->m && grp_1->disp->size == disp->size );
+      memcpy ( &disp->m[idx*disp->size],&grp_1->disp->m[i*disp->size],
+               disp->size*sizeof(double) );
+    }
+    for ( is=0; is<mesh->nsols; ++is ) {
+      psl   = &grp->field[is];
+      psl_1 = &grp_1->field[is];
+      assert ( psl->m && psl_1->size == psl->size );
+      memcpy ( &psl->m[idx*psl->size],&psl_1->m[i*psl->size],
+               psl->size*sizeof(double) );
+    }
+  }
 
-      /* External communicator k->color_out */
-      color_in    = ext_node_comm_1[i].color_in;
-      color_out   = ext_node_comm_1[i].color_out;
+  /** Tetra + xTetra */
+  if ( *ne + mesh_1->ne > mesh->ne ) {
+    fprintf(stderr,"\n  ## Error: %s: unexpected number of tetra on proc %d.\n",
+            __func__,k);
+    return 0;
+  }
+  for ( i=1; i<=mesh_1->ne; ++i ) {
+    pt = &mesh->tetra[++(*ne)];
+    memcpy(pt,&mesh_1->tetra[i],sizeof(MMG5_Tetra));
 
-      assert( color_in==k );
-      assert( color_in!=color_out );
+    for ( j=0; j<4; ++j ) {
+      pt->v[j] = point_1[pt->v[j]].tmp;
+    }
 
-      if ( color_in < color_out ) {
-        /* New point */
-        for ( j=0; j<nitem_1; ++j ) {
-          if ( !point_1[intvalues_1[int_comm_index_1[j]]].tmp ) {
-            point_1[intvalues_1[int_comm_index_1[j]]].tmp = ++np;
-          }
-        }
+    if ( pt->xt ) {
+      if ( *xt >= mesh->xt ) {
+        fprintf(stderr,"\n  ## Error: %s: unexpected number of xtetra on"
+                " proc %d.\n",__func__,k);
+        return 0;
       }
-      else {
-        /* Get the point index from the neighbouring proc */
+      memcpy(&mesh->xtetra[++(*xt)],&mesh_1->xtetra[pt->xt],sizeof(MMG5_xTetra));
+      pt->xt = *xt;
+    }
+  }
 
-        /* Find the matching external communicator over proc color_out (->k) */
-        grp_2            = &rcv_grps[color_out];
-        int_node_comm_2  = &rcv_int_node_comm[color_out];
-        ext_node_comm_2  = rcv_ext_node_comm[color_out];
-        next_node_comm_2 = rcv_next_node_comm[color_out];
+  /** Recover mesh infos */
+  if ( !k ) {
+    if ( !PMMG_copy_mmgInfo ( &mesh_1->info,&mesh->info ) ) return 0;
+  }
 
-        for ( j=0; j<next_node_comm_2; ++j ) {
-          nitem_2 = ext_node_comm_2[j].nitem;
-          int_comm_index_2 = ext_node_comm_2[j].int_comm_index;
+  return 1;
+}
 
-          if ( ext_node_comm_2[j].color_in  == color_out &&
-               ext_node_comm_2[j].color_out == color_in  )  break;
-        }
-        assert ( j < next_node_comm_2 );
-        assert ( nitem_1 == nitem_2 );
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param grp pointer toward the merged group.
+ *
+ * Set the names of the merged mesh and solutions from the parmesh names.
+ *
+ */
+static inline
+void PMMG_mergeParmesh_setNames( PMMG_pParMesh parmesh,PMMG_pGrp grp ) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  psl;
+  int        is;
 
+  mesh = grp->mesh;
 
-        /* Points and internal communicators for proc \a color_out */
-        point_2     = grp_2->mesh->point;
-        intvalues_2 = int_node_comm_2->intvalues;
+  if ( parmesh->meshin ) {
+    MMG3D_Set_inputMeshName (mesh, parmesh->meshin);
+  }
+  if ( parmesh->meshout ) {
+    MMG3D_Set_outputMeshName(mesh, parmesh->meshout);
+  }
 
-        /* Update point indices (stored in the tmp field) */
-        for ( j=0; j<nitem_1; ++j ) {
-          point_1[intvalues_1[int_comm_index_1[j]]].tmp =
-            point_2[intvalues_2[int_comm_index_2[j]]].tmp;
-        }
-      }
+  if ( grp->met ) {
+    if ( parmesh->metin ) {
+      MMG3D_Set_inputSolName (mesh,grp->met, parmesh->metin);
     }
-
-    /* Create new indices for the points that haven't been seen. */
-    for ( i=1; i <= grp_1->mesh->np; ++i ) {
-      if ( !point_1[i].tmp ) {
-        point_1[i].tmp = ++np;
-      }
+    if ( parmesh->metout ) {
+      MMG3D_Set_outputSolName(mesh,grp->met, parmesh->metout);
     }
   }
-
-  /** Tetra + xTetra */
-  ne_tot = xt_tot = 0;
-  for ( k=0; k<nprocs; ++k ) {
-    ne_tot += rcv_grps[k].mesh->ne;
-    xt_tot += rcv_grps[k].mesh->xt;
+  if ( grp->ls ) {
+    if ( parmesh->lsin ) {
+      MMG3D_Set_inputSolName (mesh,grp->ls, parmesh->lsin);
+    }
+    if ( parmesh->lsout ) {
+      MMG3D_Set_outputSolName (mesh,grp->ls, parmesh->lsout);
+    }
   }
+  if ( grp->disp ) {
+    if ( parmesh->dispin ) {
+      MMG3D_Set_inputSolName (mesh,grp->disp, parmesh->dispin);
+    }
+  }
+  for ( is=0; is < mesh->nsols; ++is ) {
+    psl = &grp->field[is];
+    if ( parmesh->fieldin ) {
+      MMG3D_Set_inputSolName (mesh, psl,parmesh->fieldin);
+    }
+    if ( parmesh->fieldout ) {
+      MMG3D_Set_outputSolName(mesh, psl,parmesh->fieldout);
+    }
+  }
+}
 
-  mesh->nemax  = mesh->ne = ne_tot;
-  mesh->nenil  = 0;
-  mesh->xtmax  = mesh->xt = xt_tot;
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param pack_size size of the packed parmesh.
+ *
+ * \return 0 if fail, 1 otherwise (no allreduce over procs)
+ *
+ * Pack the parmesh and send it to the root proc. Large parmeshes may be sent
+ * compressed: a message smaller than the packed parmesh is compressed. If the
+ * packing fails, an empty message is sent so the root proc doesn't hang.
+ *
+ * \warning We must have at most 1 group per parmesh
+ *
+ */
+static inline
+int PMMG_send_parmesh( PMMG_pParMesh parmesh,int pack_size ) {
+  size_t zsize;
+  int    ier,root;
+  char   *buffer,*buffer_to_send,*zbuf;
 
-  MMG5_ADD_MEM(mesh,(mesh->nemax+1)*sizeof(MMG5_Tetra),"tetra",
-               fprintf(stderr,"  Exit program.\n");
-               return 0);
+  root   = parmesh->info.root;
+  ier    = 1;
+  buffer = NULL;
+  zbuf   = NULL;
 
-  MMG5_ADD_MEM(mesh,(mesh->xtmax+1)*sizeof(MMG5_xTetra),"xtetra",
-               fprintf(stderr,"  Exit program.\n");
-               return 0);
+  PMMG_MALLOC( parmesh,buffer,pack_size,char,"buffer",ier=0);
 
-  MMG5_SAFE_CALLOC(mesh->xtetra,mesh->xtmax+1,MMG5_xTetra,return 0);
-  MMG5_SAFE_CALLOC(mesh->tetra,mesh->nemax+1,MMG5_Tetra,return 0);
+  if ( !ier ) {
+    MPI_CHECK(
+      MPI_Send(NULL, 0, MPI_CHAR, root, MPI_MERGEMESH_TAG,parmesh->comm),
+      ier = 0);
+    return 0;
+  }
 
-  ne = xt = idx = 0;
-  for ( k=0; k<nprocs; ++k ) {
-    grp_1       = &rcv_grps[k];
-    xtetra_1    = grp_1->mesh->xtetra;
-    tetra_1     = grp_1->mesh->tetra;
-    point_1     = grp_1->mesh->point;
+  /* /!\ mpipack_parmesh is modifying the buffer pointer making it not valid for
+   * unalloc */
+  buffer_to_send = buffer;
+  ier = PMMG_mpipack_parmesh ( parmesh ,&buffer );
+  assert ( ier );
 
-    for ( i=1; i<=grp_1->mesh->ne; ++i ) {
-      pt = &mesh->tetra[++ne];
+  if ( PMMG_compress_isUsed(parmesh,(size_t)pack_size) &&
+       PMMG_compress_buffer(parmesh,buffer_to_send,(size_t)pack_size,
+                            &zbuf,&zsize) ) {
+    MPI_CHECK(
+      MPI_Send(zbuf, (int)zsize, MPI_CHAR, root, MPI_MERGEMESH_TAG,parmesh->comm),
+      ier = 0);
+    PMMG_trace_bytes(parmesh,zsize);
+    parmesh->trace.zbytesIn  += (size_t)pack_size;
+    parmesh->trace.zbytesOut += zsize;
+    PMMG_DEL_MEM( parmesh,zbuf,char,"compressed buffer");
+  }
+  else {
+    MPI_CHECK(
+      MPI_Send(buffer_to_send, pack_size, MPI_CHAR, root, MPI_MERGEMESH_TAG,
+               parmesh->comm),
+      ier = 0);
+    PMMG_trace_bytes(parmesh,(size_t)pack_size);
+  }
 
-      for ( j=0; j<4; ++j ) {
-        tetra_1[i].v[j] = point_1[tetra_1[i].v[j]].tmp;
-      }
+  PMMG_DEL_MEM(parmesh,buffer_to_send,char,"buffer");
 
-      memcpy(pt,&tetra_1[i],sizeof(MMG5_Tetra));
+  return ier;
+}
 
-      if ( tetra_1[i].xt ) {
-        pxt = &xtetra_1[tetra_1[i].xt];
-        memcpy(&mesh->xtetra[++xt],pxt,sizeof(MMG5_xTetra));
-        pt->xt = xt;
-      }
-    }
-  }
-  mesh->xt=xt;
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param k rank of the sender.
+ * \param pack_size size of the packed parmesh of proc \a k.
+ * \param ier 0 if we only have to drain the message.
+ *
+ * \return the packed parmesh of proc \a k (NULL if fail or if \a ier is 0).
+ *
+ * Receive the packed parmesh of proc \a k on the root proc and uncompress it
+ * if needed.
+ *
+ */
+static inline
+char* PMMG_recv_parmesh( PMMG_pParMesh parmesh,int k,int pack_size,int ier ) {
+  MPI_Status status;
+  int        count;
+  char       *rcv,*buffer;
 
-  /** Points and solutions */
-  mesh->np = np;
-  mesh->npmax = mesh->np;
-  mesh->npnil = 0;
-  MMG5_ADD_MEM(mesh,(mesh->npmax+1)*sizeof(MMG5_Point),"merge point",
-                fprintf(stderr,"  Exit program.\n");
-                return 0);
-  MMG5_SAFE_CALLOC(mesh->point,mesh->npmax+1,MMG5_Point,return 0);
+  rcv    = NULL;
+  buffer = NULL;
 
-  /* Check the presence of solution structures */
-  ismet  = 0;
-  isls   = 0;
-  isdisp = 0;
-  for ( k=0; k<nprocs; ++k ) {
-    if ( rcv_grps[k].mesh->np ) {
-      ismet  = (rcv_grps[k].met  && rcv_grps[k].met->m  )? rcv_grps[k].met->size:0;
-      isls   = (rcv_grps[k].ls   && rcv_grps[k].ls->m   )? rcv_grps[k].ls->size:0;
-      isdisp = (rcv_grps[k].disp && rcv_grps[k].disp->m )? rcv_grps[k].disp->size:0;
-      mesh->nsols = rcv_grps[k].mesh->nsols;
-
-      /* Allocation of solution structures */
-      if ( ismet ) {
-        MMG3D_Set_solSize(mesh,met,MMG5_Vertex,mesh->np,rcv_grps[k].met->type);
-      }
-      if ( isls ) {
-        PMMG_CALLOC(mesh,grp->ls,1,MMG5_Sol,"ls",return 0);
-        MMG3D_Set_solSize(mesh,grp->ls,MMG5_Vertex,mesh->np,rcv_grps[k].ls->type);
-      }
-      if ( isdisp ) {
-        PMMG_CALLOC(mesh,grp->disp,1,MMG5_Sol,"disp",return 0);
-        MMG3D_Set_solSize(mesh,grp->disp,MMG5_Vertex,mesh->np,rcv_grps[k].disp->type);
-      }
+  MPI_CHECK( MPI_Probe(k,MPI_MERGEMESH_TAG,parmesh->comm,&status), ier = 0 );
+  MPI_CHECK( MPI_Get_count(&status,MPI_CHAR,&count), count = 0 );
 
-      if ( mesh->nsols ) {
-        assert ( !grp->field );
-        for ( i=0; i<mesh->nsols; ++i ) {
-          type[i] = rcv_grps[k].field[i].type;
-        }
-        MMG3D_Set_solsAtVerticesSize( mesh,&grp->field,mesh->nsols,mesh->np,type);
-      }
-      break;
-    }
+  /* An empty message means that the sender has failed */
+  if ( !count ) ier = 0;
+
+  if ( count > 0 ) {
+    PMMG_MALLOC( parmesh,rcv,count,char,"rcv_buffer",ier = 0; count = 0 );
   }
-  ls    = grp->ls;
-  disp  = grp->disp;
+  MPI_CHECK( MPI_Recv(rcv, count, MPI_CHAR, k, MPI_MERGEMESH_TAG,
+                      parmesh->comm, MPI_STATUS_IGNORE), ier = 0 );
 
-  for ( i=1; i<=mesh->np; ++i ) mesh->point[i].tag = MG_NUL;
+  if ( !ier ) {
+    PMMG_DEL_MEM( parmesh,rcv,char,"rcv_buffer");
+    return NULL;
+  }
 
-  np = 0;
-  for ( k=0; k<nprocs; ++k ) {
-    grp_1   = &rcv_grps[k];
-    point_1 = grp_1->mesh->point;
-    met_1   = grp_1->met;
-    ls_1    = grp_1->ls;
-    disp_1  = grp_1->disp;
-
-    for ( i=1; i<=grp_1->mesh->np; ++i ) {
-      idx = point_1[i].tmp;
-      assert(idx);
-      ppt = &mesh->point[idx];
-
-      if ( MG_VOK(ppt) ) {
-        point_1[i].tmp = 0;
-        continue;
-      }
+  if ( count == pack_size ) return rcv;
 
-      memcpy(ppt,&point_1[i],sizeof(MMG5_Point));
-      ppt->tmp = 0;
+  /* Compressed message */
+  PMMG_MALLOC( parmesh,buffer,pack_size,char,"rcv_buffer",ier = 0);
 
-      /* Copy solution structures */
-      if ( ismet ) {
-        assert ( met && met->m );
-        assert ( met_1->size == met->size );
-        memcpy ( &met->m[idx*met->size],&met_1->m[i*met_1->size],
-                 met->size*sizeof(double) );
-      }
-      if ( isls ) {
-        assert ( ls && ls->m );
-        assert ( ls_1->size == ls->size );
-        memcpy ( &ls->m[idx*ls->size],&ls_1->m[i*ls_1->size],
-                 ls->size*sizeof(double) );
-      }
-      if ( isdisp ) {
-        assert ( disp && disp->m );
-        assert ( disp_1->size == disp->size );
-        memcpy ( &disp->m[idx*disp->size],&disp_1->m[i*disp_1->size],
-                 disp->size*sizeof(double) );
-      }
-      if ( mesh->nsols ) {
-        for ( is=0; is<mesh->nsols; ++is ) {
-          psl   = &grp->field[is];
-          psl_1 = &grp_1->field[is];
-          assert ( psl && psl->m );
-          assert ( psl_1->size == psl->size );
-          memcpy ( &psl->m[idx*psl->size],&psl_1->m[i*psl_1->size],
-                   psl->size*sizeof(double) );
-        }
-      }
-
-      /* Count xpoints */
-      if ( point_1[i].xp ) ++np;
-    }
+  if ( ier && !PMMG_uncompress_buffer(parmesh,rcv,(size_t)count,buffer,
+                                      (size_t)pack_size) ) {
+    PMMG_DEL_MEM( parmesh,buffer,char,"rcv_buffer");
   }
+  PMMG_DEL_MEM( parmesh,rcv,char,"rcv_buffer");
 
-  /** xPoints */
-  mesh->xpmax = mesh->xp = np;
-  MMG5_ADD_MEM(mesh,(mesh->xpmax+1)*sizeof(MMG5_xPoint),"merge xPoint",
-                fprintf(stderr,"  Exit program.\n");
-                return 0);
-  MMG5_SAFE_CALLOC(mesh->xpoint,mesh->xpmax+1,MMG5_xPoint,return 0);
-  np = 0;
-  for ( k=0; k<nprocs; ++k ) {
-    grp_1       = &rcv_grps[k];
-    point_1     = grp_1->mesh->point;
-    xpoint_1    = grp_1->mesh->xpoint;
+  return buffer;
+}
 
-    for ( i=1; i<=grp_1->mesh->np; ++i ) {
-      idx = point_1[i].tmp;
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param mrg_grp pointer toward the merged group (allocated on root only).
+ *
+ * \return 0 if fail, 1 otherwise (no allreduce over procs)
+ *
+ * Gather the parmeshes on the root proc and merge them into 1 group. The
+ * parmeshes are received and appended one by one, in rank order, so the root
+ * proc only stores the merged mesh, its own parmesh, the packed parmesh of 1
+ * proc and the global indices of the pending interface points.
+ *
+ * The parmeshes are left untouched so a parallel save remains possible if the
+ * merge fails.
+ *
+ * \warning We must have at most 1 group per parmesh
+ *
+ */
+static inline
+int PMMG_stream_parmesh( PMMG_pParMesh parmesh,PMMG_pGrp *mrg_grp ) {
+  PMMG_Grp       rcv_grp;
+  PMMG_Int_comm  rcv_int_node_comm;
+  PMMG_pExt_comm rcv_ext_node_comm,*gid_comm;
+  int            *rcv_sizes,*ngid_comm,sizes[5],rcv_next_node_comm;
+  int            nprocs,root,k,i,np,xp,ne,xt,ier,ier_glob;
+  char           *rcv_buffer,*buffer;
 
-      if ( !idx ) continue;
-      ppt = &mesh->point[idx];
+  nprocs    = parmesh->nprocs;
+  root      = parmesh->info.root;
 
-      if ( !point_1[i].xp ) continue;
+  ier       = 1;
+  *mrg_grp  = NULL;
+  rcv_sizes = NULL;
+  gid_comm  = NULL;
+  ngid_comm = NULL;
 
-      pxp = &mesh->xpoint[++np];
-      memcpy(pxp, &xpoint_1[point_1[i].xp],sizeof(MMG5_xPoint));
-      ppt->xp = np;
-    }
+  /** 1: Gather the sizes of the contributions of the procs on root */
+  PMMG_mergeParmesh_sizes ( parmesh,sizes );
+
+  if ( parmesh->myrank == root ) {
+    PMMG_MALLOC( parmesh,rcv_sizes,5*nprocs,int,"rcv_sizes",ier=0);
   }
 
-  /** Recover mesh infos */
-  grp_1 = &rcv_grps[0];
-  assert ( grp_1->mesh );
-  if ( !PMMG_copy_mmgInfo ( &grp_1->mesh->info,&mesh->info ) ) return 0;
+  /* Remark: a non allocated buffer used in gather creates a segfault over all
+   * procs */
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) {
+    PMMG_DEL_MEM(parmesh,rcv_sizes,int,"rcv_sizes");
+    return ier_glob;
+  }
 
-  /** Recover mesh name */
+  MPI_CHECK( MPI_Gather(sizes,5,MPI_INT,rcv_sizes,5,MPI_INT,root,parmesh->comm),
+             ier = 0);
 
-  if ( parmesh->meshin ) {
-    MMG3D_Set_inputMeshName (mesh, parmesh->meshin);
+  /** 2: Procs other than root send their packed parmesh */
+  if ( parmesh->myrank != root ) {
+    /* Remark: MG_MIN would evaluate the send twice */
+    if ( !PMMG_send_parmesh ( parmesh,sizes[4] ) ) ier = 0;
+    return ier;
   }
-  if ( parmesh->meshout ) {
-    MMG3D_Set_outputMeshName(mesh, parmesh->meshout);
+
+  /** 3: Root allocates the merged mesh at its final size */
+  np = xp = ne = xt = 0;
+  for ( k=0; k<nprocs; ++k ) {
+    np += rcv_sizes[5*k];
+    xp += rcv_sizes[5*k+1];
+    ne += rcv_sizes[5*k+2];
+    xt += rcv_sizes[5*k+3];
   }
 
-  if ( met ) {
-    if ( parmesh->metin ) {
-      MMG3D_Set_inputSolName (mesh,met, parmesh->metin);
+  if ( ier ) {
+    ier = PMMG_mergeParmesh_allocGrp ( parmesh,mrg_grp,np,xp,ne,xt );
+  }
+  PMMG_CALLOC( parmesh,gid_comm,nprocs,PMMG_pExt_comm,"gid_comm",ier=0);
+  PMMG_CALLOC( parmesh,ngid_comm,nprocs,int,"ngid_comm",ier=0);
+
+  /** 4: Root receives the parmeshes one by one and appends them to the merged
+   * mesh: we travel through the external communicators to recover the
+   * numbering of the points shared with a lower proc. The other points are
+   * concatenated. On failure, the remaining messages are drained. */
+  np = xp = ne = xt = 0;
+  for ( k=0; k<nprocs; ++k ) {
+    if ( k == root ) {
+      if ( ier ) {
+        ier = PMMG_mergeParmesh_appendGrp ( parmesh,*mrg_grp,k,
+                                            parmesh->ngrp ? parmesh->listgrp : NULL,
+                                            parmesh->int_node_comm->intvalues,
+                                            parmesh->next_node_comm,
+                                            parmesh->ext_node_comm,
+                                            gid_comm,ngid_comm,&np,&xp,&ne,&xt );
+      }
+      continue;
     }
-    if ( parmesh->metout ) {
-      MMG3D_Set_outputSolName(mesh,met, parmesh->metout);
+
+    rcv_buffer = PMMG_recv_parmesh ( parmesh,k,rcv_sizes[5*k+4],ier );
+    if ( !rcv_buffer ) {
+      ier = 0;
+      continue;
     }
-  }
-  if ( ls ) {
-    if ( parmesh->lsin ) {
-      MMG3D_Set_inputSolName (mesh,ls, parmesh->lsin);
+
+    memset(&rcv_grp,0,sizeof(PMMG_Grp));
+    memset(&rcv_int_node_comm,0,sizeof(PMMG_Int_comm));
+    rcv_next_node_comm = 0;
+    rcv_ext_node_comm  = NULL;
+
+    /* /!\ mpiunpack_parmesh is modifying the buffer pointer making it not valid
+     * for unalloc */
+    buffer = rcv_buffer;
+    ier = PMMG_mpiunpack_parmesh ( parmesh,&rcv_grp,0,&rcv_int_node_comm,
+                                   &rcv_next_node_comm,&rcv_ext_node_comm,
+                                   &buffer );
+    PMMG_DEL_MEM(parmesh,rcv_buffer,char,"rcv_buffer");
+
+    if ( ier ) {
+      ier = PMMG_mergeParmesh_appendGrp ( parmesh,*mrg_grp,k,&rcv_grp,
+                                          rcv_int_node_comm.intvalues,
+                                          rcv_next_node_comm,rcv_ext_node_comm,
+                                          gid_comm,ngid_comm,&np,&xp,&ne,&xt );
     }
-    if ( parmesh->lsout ) {
-      MMG3D_Set_outputSolName (mesh,ls, parmesh->lsout);
+
+    /* Free the data of proc k */
+    PMMG_grp_free( parmesh, &rcv_grp );
+    PMMG_DEL_MEM(parmesh,rcv_int_node_comm.intvalues,int,"intvalues");
+    for ( i=0; i<rcv_next_node_comm; ++i ) {
+      PMMG_DEL_MEM(parmesh,rcv_ext_node_comm[i].int_comm_index,int,"int_comm_index");
     }
+    PMMG_DEL_MEM(parmesh,rcv_ext_node_comm,PMMG_Ext_comm,"ext_node_comm");
   }
-  if ( disp ) {
-    if ( parmesh->dispin ) {
-      MMG3D_Set_inputSolName (mesh,disp, parmesh->dispin);
-    }
+
+  if ( ier ) {
+    assert ( np == (*mrg_grp)->mesh->np && xp == (*mrg_grp)->mesh->xp );
+    assert ( ne == (*mrg_grp)->mesh->ne && xt == (*mrg_grp)->mesh->xt );
+
+    PMMG_mergeParmesh_setNames ( parmesh,*mrg_grp );
   }
-  if ( mesh->nsols ) {
-    for ( is=0; is < mesh->nsols; ++is ) {
-      psl = &parmesh->listgrp[0].field[is];
-      if ( parmesh->fieldin ) {
-        MMG3D_Set_inputSolName (mesh, psl,parmesh->fieldin);
-      }
-      if ( parmesh->fieldout ) {
-        MMG3D_Set_outputSolName(mesh, psl,parmesh->fieldout);
+
+  /** Free the memory */
+  if ( gid_comm ) {
+    for ( k=0; k<nprocs; ++k ) {
+      for ( i=0; i<ngid_comm[k]; ++i ) {
+        PMMG_DEL_MEM(parmesh,gid_comm[k][i].int_comm_index,int,"global indices");
       }
+      PMMG_DEL_MEM(parmesh,gid_comm[k],PMMG_Ext_comm,"gid_comm");
     }
   }
+  PMMG_DEL_MEM(parmesh,gid_comm,PMMG_pExt_comm,"gid_comm");
+  PMMG_DEL_MEM(parmesh,ngid_comm,int,"ngid_comm");
+  PMMG_DEL_MEM(parmesh,rcv_sizes,int,"rcv_sizes");
 
-  return 1;
+  return ier;
 }
 
 /**
@@ -1612,12 +1776,10 @@ int PMMG_mergeParmesh_rcvParMeshes ( PMMG_pParMesh parmesh,PMMG_pGrp rcv_grps,
  *  merge all meshes to a single mesh in P0's parmesh
  */
 int PMMG_merge_parmesh( PMMG_pParMesh parmesh ) {
-  PMMG_pGrp      grp,rcv_grps;
-  PMMG_pInt_comm int_node_comm,rcv_int_node_comm;
-  PMMG_pExt_comm *rcv_ext_node_comm,enc;
+  PMMG_pGrp      grp,mrg_grp;
+  PMMG_pInt_comm int_node_comm;
   MMG5_pMesh     mesh;
   MMG5_pPoint    ppt;
-  int            *rcv_next_node_comm;
   int            k,idx,ier,ieresult;
 
   ier = 1;
@@ -1653,45 +1815,25 @@ int PMMG_merge_parmesh( PMMG_pParMesh parmesh ) {
     }
   }
 
-  /** Step 2: Procs send their parmeshes to Proc 0 and Proc 0 recieve the data */
-  ier = PMMG_gather_parmesh ( parmesh,&rcv_grps,&rcv_int_node_comm,
-                              &rcv_next_node_comm,&rcv_ext_node_comm );
+  /** Step 2: Procs send their parmeshes to the root proc that merges them on
+   * the fly into 1 parmesh with 1 group */
+  ier = PMMG_stream_parmesh ( parmesh,&mrg_grp );
   MPI_CHECK( MPI_Allreduce(&ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm),ieresult=0);
 
   if ( ieresult ) {
-    /* Free useless data of the parmesh (rcv_* arrays contains all the needed data) */
+    /* Free useless data of the parmesh (the merged group contains all the
+     * needed data) */
     /* 1: groups */
     PMMG_listgrp_free( parmesh, &parmesh->listgrp, parmesh->ngrp );
 
     /* 2: communicators */
     PMMG_parmesh_Free_Comm(parmesh);
 
-    /** Step 3: Proc 0 merges the meshes: We travel through the external
-     * communicators to recover the numbering of the points shared with a lower
-     * proc. The other points are concatenated with the proc 0. */
-    ieresult = PMMG_mergeParmesh_rcvParMeshes(parmesh,rcv_grps,rcv_int_node_comm,
-                                              rcv_next_node_comm,rcv_ext_node_comm);
-    /* Only root may return a non-zero value */
-    MPI_CHECK( MPI_Bcast(&ieresult,1,MPI_INT,parmesh->info.root,parmesh->comm),
-               ieresult=0 );
-  }
-
-  /* Free useless receivers */
-  if ( rcv_grps ) {
-    PMMG_listgrp_free( parmesh, &rcv_grps, parmesh->nprocs );
-
-    for ( k=0; k<parmesh->nprocs; ++k ) {
-      PMMG_DEL_MEM(parmesh,rcv_int_node_comm[k].intvalues,int,"intvalues");
-      enc = rcv_ext_node_comm[k];
-      for ( idx=0; idx<rcv_next_node_comm[k]; ++idx ) {
-        PMMG_DEL_MEM(parmesh,enc[idx].int_comm_index,int,"int_comm_index");
-      }
-      PMMG_DEL_MEM(parmesh,enc,PMMG_Ext_comm,"ext_node_comm");
-    }
-
-    PMMG_DEL_MEM(parmesh,rcv_int_node_comm,PMMG_Int_comm,"rcv_int_node_comm");
-    PMMG_DEL_MEM(parmesh,rcv_next_node_comm,int,"rcv_next_node_comm");
-    PMMG_DEL_MEM(parmesh,rcv_ext_node_comm,PMMG_Ext_comm,"rcv_ext_node_comm");
+    /** Step 3: Proc 0 takes the merged group */
+    parmesh->listgrp = mrg_grp;
+  }
+  else if ( mrg_grp ) {
+    PMMG_listgrp_free( parmesh, &mrg_grp, 1 );
   }
 
   if ( !ieresult ) {
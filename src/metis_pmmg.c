@@ -303,6 +303,59 @@ double PMMG_computeWgt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ifac )
   return res;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 1 if the partition node weights must be computed from the
+ * remeshing cost model, 0 otherwise.
+ *
+ * The cost-model weights are only used by the repartitionings of the
+ * remeshing iterations: never by the initial mesh distribution nor by the
+ * output load balancing of the last iteration.
+ *
+ */
+int PMMG_costWeights_isUsed( PMMG_pParMesh parmesh ) {
+
+  if ( !parmesh->info.costWeights ) return 0;
+
+  /* Initial mesh distribution */
+  if ( parmesh->iter == PMMG_UNSET ) return 0;
+
+  /* Output load balancing */
+  if ( (parmesh->iter == parmesh->niter-1) && !parmesh->info.nobalancing ) return 0;
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met  pointer toward the met structure.
+ * \param pt   pointer toward the tetrahedron structure.
+ *
+ * \return The predicted cost of the element.
+ *
+ * Predict the remeshing work of an element from its edge lengths in the metric
+ * space: an element whose mean edge length is \f$l\f$ should be replaced by
+ * about \f$l^3\f$ unit elements. Elements that will be coarsened still have
+ * to be processed, so the cost is at least 1.
+ *
+ */
+double PMMG_computeCost( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt ) {
+  double       len,res;
+  int          ia;
+
+  if ( !(met && met->m) ) return 1.0;
+
+  len = 0.0;
+  for( ia=0; ia<6; ia++ )
+    len += MMG5_lenedg(mesh,met,ia,pt);
+  len /= 6.0;
+
+  res = len*len*len;
+
+  return MG_MAX(1.0,MG_MIN(res,PMMG_WGTVAL_COSTMAX));
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  *
@@ -737,6 +790,9 @@ int PMMG_correct_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t *vtxdist,
  * \param mesh pointer toward a MMG5 mesh structure
  * \param xadj pointer toward the position of the elt adjacents in adjncy
  * \param adjncy pointer toward the list of the adjacent of each elt
+ * \param vwgt pointer toward the metis node weights (allocated only if the
+ * cost-model weights are used, see \ref PMMG_costWeights_isUsed)
+ * \param adjwgt pointer toward the metis edge weights
  * \param nadjncy number of data in adjncy array
  *
  * \return  1 if success, 0 if fail
@@ -747,8 +803,8 @@ int PMMG_correct_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t *vtxdist,
  *
  */
 int PMMG_graph_meshElts2metis( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_pSol met,
-                               idx_t **xadj,idx_t **adjncy,idx_t **adjwgt,
-                               idx_t *nadjncy ) {
+                               idx_t **xadj,idx_t **adjncy,idx_t **vwgt,
+                               idx_t **adjwgt,idx_t *nadjncy ) {
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
   int          *adja;
@@ -798,6 +854,17 @@ int PMMG_graph_meshElts2metis( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_pSol m
       PMMG_DEL_MEM(parmesh, (*adjncy), idx_t, "deallocate adjncy" );
       return ier;
     }
+
+    /* Balance the predicted remeshing work instead of the number of elements */
+    if ( PMMG_costWeights_isUsed(parmesh) ) {
+      PMMG_CALLOC(parmesh, (*vwgt), mesh->ne, idx_t, "allocate vwgt", ier=0;);
+      if( !ier ) {
+        PMMG_DEL_MEM(parmesh, (*xadj), idx_t, "deallocate xadj" );
+        PMMG_DEL_MEM(parmesh, (*adjncy), idx_t, "deallocate adjncy" );
+        PMMG_DEL_MEM(parmesh, (*adjwgt), idx_t, "deallocate adjwgt" );
+        return ier;
+      }
+    }
   }
 
   count = 0;
@@ -805,6 +872,12 @@ int PMMG_graph_meshElts2metis( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_pSol m
     iadr = 4*(k-1) + 1;
     adja = &mesh->adja[iadr];
     pt   = &mesh->tetra[k];
+
+    /* Assign graph node weights */
+    if( *vwgt ) {
+      (*vwgt)[k-1] = (idx_t)PMMG_computeCost(mesh,met,pt);
+    }
+
     for ( j = 0; j < 4; j++ ) {
       jel = adja[j] / 4;
       if ( !jel ) continue;
@@ -870,6 +943,9 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   if( (parmesh->iter == parmesh->niter-1) && !parmesh->info.nobalancing ) {
     /* Switch off weights for output load balancing */
     *wgtflag = PMMG_WGTFLAG_NONE;
+  } else if ( PMMG_costWeights_isUsed(parmesh) ) {
+    /* Use the predicted remeshing cost of the groups as node weights */
+    *wgtflag = PMMG_WGTFLAG_BOTH;
   } else {
     /* Default weight choice for parmetis */
     *wgtflag = PMMG_WGTFLAG_DEF;
@@ -892,11 +968,13 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   for ( k=1; k<=nproc; ++k )
     (*vtxdist)[k] += (*vtxdist)[k-1];
 
-  /** Step 2: Fill weights array with the number of MG_PARBDY face per group */
+  /** Step 2: Fill weights array with the number of MG_PARBDY face per group
+   * (and with the predicted remeshing cost of the group if asked) */
   PMMG_CALLOC(parmesh,*vwgt,ngrp,idx_t,"parmetis vwgt", goto fail_1);
 
   for ( igrp=0; igrp<ngrp; ++igrp ) {
     mesh = parmesh->listgrp[igrp].mesh;
+    met  = parmesh->listgrp[igrp].met;
 
     if ( !mesh ) {
       (*vwgt)[igrp] = 1;
@@ -908,6 +986,10 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
       if ( !MG_EOK(pt) ) continue;
 
       (*vwgt)[igrp] += pt->mark;
+
+      if ( *wgtflag == PMMG_WGTFLAG_BOTH ) {
+        (*vwgt)[igrp] += (idx_t)PMMG_computeCost(mesh,met,pt);
+      }
     }
   }
 
@@ -1297,10 +1379,11 @@ int PMMG_part_meshElts2metis( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
   /* Set contiguity of partitions if using Metis also for graph partitioning */
   METIS_SetDefaultOptions(options);
   options[METIS_OPTION_CONTIG] = ( parmesh->info.contiguous_mode &&
-    (parmesh->info.loadbalancing_mode & PMMG_LOADBALANCING_metis) );
+    (parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_metis) );
 
   /** Build the graph */
-  if ( !PMMG_graph_meshElts2metis(parmesh,mesh,met,&xadj,&adjncy,&adjwgt,&adjsize) )
+  if ( !PMMG_graph_meshElts2metis(parmesh,mesh,met,&xadj,&adjncy,&vwgt,&adjwgt,
+                                  &adjsize) )
     return 0;
 
 
@@ -1333,6 +1416,7 @@ int PMMG_part_meshElts2metis( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
   /** Correct partitioning to avoid empty partitions */
   if( !PMMG_correct_meshElts2metis( parmesh,part,nelt,nproc ) ) return 0;
 
+  PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
   PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
   PMMG_DEL_MEM(parmesh, adjncy, idx_t, "deallocate adjncy" );
   PMMG_DEL_MEM(parmesh, xadj, idx_t, "deallocate xadj" );
@@ -1557,6 +1641,63 @@ int PMMG_part_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t* part,idx_t nproc )
 }
 
 #ifdef USE_PARMETIS
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param vtxdist parmetis structure for nb of groups on each proc
+ * \param xadj pointer toward the position of the adjacents of each group
+ * \param adjncy list of the adjacent groups
+ * \param vwgt groups weights
+ * \param adjwgt adjacency weights
+ * \param wgtflag parmetis weights flag
+ * \param numflag parmetis numbering flag
+ * \param ncon number of weights per group
+ * \param nproc number of partitions asked
+ * \param tpwgts parmetis target weights
+ * \param ubvec parmetis imbalance tolerance
+ * \param part pointer of an array containing the partitions (at the end)
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Call the parmetis adaptive repartitioning: the migration volume of a group
+ * is its number of elements and \a repartItr gives the relative cost of the
+ * edge cut compared to the migration volume.
+ *
+ */
+static
+int PMMG_part_parmeshGrps2parmetisAdaptive( PMMG_pParMesh parmesh,idx_t *vtxdist,
+                                            idx_t *xadj,idx_t *adjncy,idx_t *vwgt,
+                                            idx_t *adjwgt,idx_t wgtflag,
+                                            idx_t numflag,idx_t ncon,idx_t nproc,
+                                            real_t *tpwgts,real_t *ubvec,
+                                            idx_t *part ) {
+  MMG5_pMesh mesh;
+  real_t     itr;
+  idx_t      *vsize,edgecut,options[4];
+  int        igrp,ier;
+
+  ier = 1;
+  options[0] = 0;
+  itr = (real_t)parmesh->info.repartItr;
+
+  PMMG_MALLOC(parmesh,vsize,parmesh->ngrp+1,idx_t,"parmetis vsize",return 0);
+  for ( igrp=0; igrp<parmesh->ngrp; ++igrp ) {
+    mesh = parmesh->listgrp[igrp].mesh;
+    vsize[igrp] = ( mesh && mesh->ne ) ? mesh->ne : 1;
+  }
+
+  if ( ParMETIS_V3_AdaptiveRepart( vtxdist,xadj,adjncy,vwgt,vsize,adjwgt,
+                                   &wgtflag,&numflag,&ncon,&nproc,tpwgts,ubvec,
+                                   &itr,options,&edgecut,part,
+                                   &parmesh->comm) != METIS_OK ) {
+    fprintf(stderr,"\n  ## Error: Parmetis adaptive repartitioning fails.\n" );
+    ier = 0;
+  }
+
+  PMMG_DEL_MEM(parmesh,vsize,idx_t,"parmetis vsize");
+
+  return ier;
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure
  * \param part pointer of an array containing the partitions (at the end)
@@ -1593,9 +1734,16 @@ int PMMG_part_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t* part,idx_t npro
 
   /** Call parmetis and get the partition array */
   if ( 2 < nprocs + ngrp ) {
-    if ( ParMETIS_V3_PartKway( vtxdist,xadj,adjncy,vwgt,adjwgt,&wgtflag,&numflag,
-                               &ncon,&nproc,tpwgts,ubvec,options,&edgecut,part,
-                               &parmesh->comm) != METIS_OK ) {
+    if ( parmesh->info.repartItr > 0. && nproc == nprocs ) {
+      /* Adaptive repartitioning: balance the edge cut against the size of the
+       * groups that leave their current process */
+      ier = PMMG_part_parmeshGrps2parmetisAdaptive(parmesh,vtxdist,xadj,adjncy,
+                                                   vwgt,adjwgt,wgtflag,numflag,
+                                                   ncon,nproc,tpwgts,ubvec,part);
+    }
+    else if ( ParMETIS_V3_PartKway( vtxdist,xadj,adjncy,vwgt,adjwgt,&wgtflag,&numflag,
+                                    &ncon,&nproc,tpwgts,ubvec,options,&edgecut,part,
+                                    &parmesh->comm) != METIS_OK ) {
         fprintf(stderr,"\n  ## Error: Parmetis fails.\n" );
         ier = 0;
     }
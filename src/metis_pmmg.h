@@ -41,6 +41,10 @@
 #include <parmetis.h>
 #endif
 
+#ifdef USE_PTSCOTCH
+#include <ptscotch.h>
+#endif
+
 /* Available choices for the wgtflag parameter of ParMetis */
 #define PMMG_WGTFLAG_NONE  0
 #define PMMG_WGTFLAG_ADJ   1
@@ -63,6 +67,16 @@
  */
 #define PMMG_WGTVAL_HUGEINT   1000000
 
+/**
+ * \def PMMG_WGTVAL_COSTMAX
+ *
+ * Maximal predicted cost of one element when the partition weights are
+ * computed from the remeshing cost model (keeps the group weights in the idx_t
+ * range)
+ *
+ */
+#define PMMG_WGTVAL_COSTMAX   1000
+
 /**
  * \def PMMG_UBVEC_DEF
  *
@@ -111,9 +125,26 @@ typedef struct {
   PMMG_hgrp    *item;
 } PMMG_HGrp;
 
+/**
+ * \struct PMMG_Partitioner
+ *
+ * \brief Graph partitioner backend.
+ *
+ * The backends share the graph builders (\ref PMMG_graph_meshElts2metis and
+ * \ref PMMG_graph_parmeshGrps2parmetis) and return the partition of the graph
+ * nodes in a \a idx_t array.
+ *
+ */
+typedef struct {
+  int         mode; /*!< PMMG_LOADBALANCING_ value of the backend */
+  const char  *name; /*!< Backend name */
+  int (*part_meshElts)(PMMG_pParMesh,idx_t*,idx_t); /*!< Partition the elements of the first group (sequential) */
+  int (*part_parmeshGrps)(PMMG_pParMesh,idx_t*,idx_t); /*!< Partition the groups of all the processes (collective) */
+} PMMG_Partitioner;
+
 int PMMG_checkAndReset_grps_contiguity( PMMG_pParMesh parmesh );
 int PMMG_check_grps_contiguity( PMMG_pParMesh parmesh );
-int PMMG_graph_meshElts2metis(PMMG_pParMesh,MMG5_pMesh,MMG5_pSol,idx_t**,idx_t**,idx_t**,idx_t*);
+int PMMG_graph_meshElts2metis(PMMG_pParMesh,MMG5_pMesh,MMG5_pSol,idx_t**,idx_t**,idx_t**,idx_t**,idx_t*);
 int PMMG_part_meshElts2metis( PMMG_pParMesh,idx_t*,idx_t);
 int PMMG_graph_parmeshGrps2parmetis(PMMG_pParMesh,idx_t**,idx_t**,idx_t**,idx_t*,
                                     idx_t**,idx_t**,idx_t*,idx_t*,idx_t*,idx_t,
@@ -122,5 +153,21 @@ int PMMG_part_parmeshGrps2parmetis(PMMG_pParMesh,idx_t*,idx_t);
 int PMMG_part_parmeshGrps2metis(PMMG_pParMesh,idx_t*,idx_t);
 int PMMG_correct_parmeshGrps2parmetis( PMMG_pParMesh parmesh, idx_t *vtxdist,
                                        idx_t* mypart,idx_t nproc );
+int PMMG_correct_meshElts2metis( PMMG_pParMesh parmesh,idx_t* part,idx_t ne,idx_t nproc );
+
+/* Partitioner backends */
+const PMMG_Partitioner* PMMG_partitioner_get( int mode );
+int PMMG_part_meshElts( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc );
+int PMMG_part_parmeshGrps( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc );
+int PMMG_remap_parmeshGrps( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc,int *nodeOf );
+int PMMG_get_procNodes( PMMG_pParMesh parmesh,int *nodeOf );
+int PMMG_map_parmeshGrps2nodes( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc,
+                                int *nodeOf,int nnode );
+int PMMG_part_meshElts2sfc( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc );
+int PMMG_part_parmeshGrps2sfc( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc );
+#ifdef USE_PTSCOTCH
+int PMMG_part_meshElts2scotch( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc );
+int PMMG_part_parmeshGrps2ptscotch( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc );
+#endif
 
 #endif
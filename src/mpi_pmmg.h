@@ -37,12 +37,14 @@
 
 #define MPI_COMMUNICATORS_NODE_TAG      1000
 #define MPI_COMMUNICATORS_EDGE_TAG      1001
+#define MPI_COMMUNICATORS_FACE_TAG      1002
 #define MPI_CHKCOMM_NODE_TAG            2000
 #define MPI_CHKCOMM_EDGE_TAG            2002
 #define MPI_CHKCOMM_FACE_TAG            3000
 #define MPI_DISTRIBUTEGRPS_MESHSIZE_TAG 4000
 #define MPI_PARMESHGRPS2PARMETIS_TAG    5000
 #define MPI_SENDGRP_TAG                 6000
+#define MPI_SENDGRP_ARRAYS_TAG          6001
 #define MPI_SENDEXTFACECOMM_TAG         7000
 #define MPI_TRANSFER_GRP_TAG            8000
 #define MPI_COMMUNICATORS_REF_TAG       9000
@@ -0,0 +1,1814 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file mpiio_pmmg.c
+ * \brief Parallel reading and writing of centralized Medit files (MPI-IO).
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * The mesh is written from its distributed state, without merging it on the
+ * root process. Each process writes the entities that it owns in its own byte
+ * range of each section of the file: the vertices that it owns (numbered by
+ * \a PMMG_Compute_verticesGloNum), all its tetrahedra and the boundary
+ * triangles that it owns (see \a PMMG_Compute_trianglesGloNum). The byte
+ * ranges are given by an exclusive scan of the local section sizes, thus both
+ * the ASCII and the binary Medit formats are supported.
+ *
+ * The binary Medit files can also be read in parallel: the root process only
+ * scans the keywords of the file, then each process reads a block of the
+ * tetrahedra and a block of the vertices. The vertices are sent to the
+ * processes that use them (the process reading a vertex block is the directory
+ * of these vertices) and the node communicators are built from the file
+ * numbering of the shared vertices.
+ *
+ */
+#include "parmmg.h"
+
+/** Maximal size of a line of an ASCII Medit file */
+#define PMMG_MPIIO_LINE 256
+
+/** Medit keywords */
+#define PMMG_MPIIO_KwDimension         3
+#define PMMG_MPIIO_KwVertices          4
+#define PMMG_MPIIO_KwTriangles         6
+#define PMMG_MPIIO_KwTetrahedra        8
+#define PMMG_MPIIO_KwCorners          13
+#define PMMG_MPIIO_KwRequiredVertices 15
+#define PMMG_MPIIO_KwEnd              54
+#define PMMG_MPIIO_KwSolAtVertices    62
+
+/** Sections read by the parallel loader */
+#define PMMG_MPIIO_SecVertices   0
+#define PMMG_MPIIO_SecTriangles  1
+#define PMMG_MPIIO_SecTetrahedra 2
+#define PMMG_MPIIO_SecCorners    3
+#define PMMG_MPIIO_SecRequired   4
+#define PMMG_MPIIO_SecSol        5
+#define PMMG_MPIIO_NSec          6
+
+/** Size of a vertex record of a binary Medit file (coordinates and ref) */
+#define PMMG_MPIIO_VerSize (3*sizeof(double)+sizeof(int))
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 1 if the centralized output has to be written in parallel, 0 if the
+ * mesh has to be merged on the root process.
+ *
+ * The parallel writer handles the Medit formats for the mesh, the metric and
+ * the level-set of processes storing one group each: the other solution fields
+ * need the merge.
+ *
+ * \remark collective: the same value is returned on all the processes.
+ *
+ */
+int PMMG_mpiio_isUsed( PMMG_pParMesh parmesh ) {
+  int use;
+
+  if ( !parmesh->info.mpiioOutput ) return 0;
+
+  if ( parmesh->info.fmtout != MMG5_FMT_MeditASCII &&
+       parmesh->info.fmtout != MMG5_FMT_MeditBinary ) return 0;
+
+  /* The writer is collective and needs one group per process: a process
+   * without group doesn't know if there are fields, so the decision is
+   * shared */
+  use = ( parmesh->ngrp == 1 ) && !parmesh->listgrp[0].field;
+  MPI_Allreduce( MPI_IN_PLACE,&use,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  if ( !use && parmesh->myrank == parmesh->info.root &&
+       parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"  ## Warning: %s: solution fields (or processes without"
+            " mesh) can't be written in parallel. The mesh will be merged.\n",
+            __func__);
+  }
+
+  return use;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param info pointer toward the MPI info object to create.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Create the MPI info object passed to the MPI-IO files (Medit and HDF5) from
+ * the hints provided by the user (number of collective buffering aggregators,
+ * collective buffering of the writes and file striping). \a info is
+ * MPI_INFO_NULL if no hint is given, else it has to be freed by the caller.
+ *
+ */
+int PMMG_mpiio_hints( PMMG_pParMesh parmesh,MPI_Info *info ) {
+  char val[32];
+
+  *info = MPI_INFO_NULL;
+
+  if ( !parmesh->info.mpiioCbNodes && parmesh->info.mpiioCbWrite < 0 &&
+       !parmesh->info.mpiioStripeCount && !parmesh->info.mpiioStripeSize ) {
+    return 1;
+  }
+
+  if ( MPI_SUCCESS != MPI_Info_create(info) ) {
+    *info = MPI_INFO_NULL;
+    return 0;
+  }
+
+  if ( parmesh->info.mpiioCbNodes ) {
+    snprintf(val,sizeof(val),"%d",parmesh->info.mpiioCbNodes);
+    MPI_Info_set(*info,"cb_nodes",val);
+  }
+  if ( parmesh->info.mpiioCbWrite >= 0 ) {
+    MPI_Info_set(*info,"romio_cb_write",
+                 parmesh->info.mpiioCbWrite ? "enable" : "disable");
+  }
+  if ( parmesh->info.mpiioStripeCount ) {
+    snprintf(val,sizeof(val),"%d",parmesh->info.mpiioStripeCount);
+    MPI_Info_set(*info,"striping_factor",val);
+  }
+  if ( parmesh->info.mpiioStripeSize ) {
+    /* striping_unit is given in bytes (may exceed INT_MAX) */
+    snprintf(val,sizeof(val),"%lld",(long long)parmesh->info.mpiioStripeSize*1024LL);
+    MPI_Info_set(*info,"striping_unit",val);
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file.
+ * \param binext extension of the binary files (".meshb" or ".solb").
+ * \param fh pointer toward the MPI file handle.
+ * \param bin pointer toward the file type (1 for binary, 0 for ASCII).
+ * \param offset pointer toward the position of the end of the file header.
+ *
+ * \return 1 if success, 0 if fail (collective).
+ *
+ * Create the file and write its header (format version and space dimension).
+ *
+ */
+static int PMMG_mpiio_open( PMMG_pParMesh parmesh,const char *filename,
+                            const char *binext,MPI_File *fh,int *bin,
+                            MPI_Offset *offset ) {
+  char *ptr;
+  char head[PMMG_MPIIO_LINE];
+  int  ier,ieresult,hsize,bhead[5];
+  MPI_Info info;
+
+  ptr  = MMG5_Get_filenameExt((char*)filename);
+  *bin = ( ptr && !strcmp(ptr,binext) );
+
+  /* The hints (as the striping) are taken into account at file creation */
+  PMMG_mpiio_hints(parmesh,&info);
+
+  ier = ( MPI_SUCCESS == MPI_File_open(parmesh->comm,(char*)filename,
+                                       MPI_MODE_WRONLY | MPI_MODE_CREATE,
+                                       info,fh) );
+  if ( info != MPI_INFO_NULL ) MPI_Info_free(&info);
+
+  if ( !ier ) {
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"  ** %s  NOT FOUND.\n",filename);
+      fprintf(stderr,"  ** UNABLE TO OPEN.\n");
+    }
+    return 0;
+  }
+  if ( MPI_SUCCESS != MPI_File_set_size(*fh,0) ) ier = 0;
+
+  /* Header: binary code, version (double precision) and dimension */
+  if ( *bin ) {
+    bhead[0] = 1;
+    bhead[1] = 2;
+    bhead[2] = PMMG_MPIIO_KwDimension;
+    bhead[3] = 5*sizeof(int);
+    bhead[4] = 3;
+    hsize    = 5*sizeof(int);
+    memcpy(head,bhead,hsize);
+  }
+  else {
+    hsize = snprintf(head,PMMG_MPIIO_LINE,"MeshVersionFormatted 2\n\nDimension 3\n");
+  }
+
+  if ( parmesh->myrank == parmesh->info.root ) {
+    if ( MPI_SUCCESS != MPI_File_write_at(*fh,0,head,hsize,MPI_CHAR,
+                                          MPI_STATUS_IGNORE) ) ier = 0;
+  }
+  *offset = hsize;
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) {
+    MPI_File_close(fh);
+  }
+  else if ( parmesh->info.imprim > PMMG_VERB_VERSION &&
+            parmesh->myrank == parmesh->info.root ) {
+    fprintf(stdout,"\n  %%%% %s OPENED (PARALLEL WRITE)\n",filename);
+  }
+
+  return ieresult;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh pointer toward the MPI file handle.
+ * \param bin 1 for a binary file, 0 for an ASCII one.
+ * \param offset position of the end of the last section.
+ *
+ * \return 1 if success, 0 if fail (collective).
+ *
+ * Write the end keyword and close the file.
+ *
+ */
+static int PMMG_mpiio_close( PMMG_pParMesh parmesh,MPI_File *fh,int bin,
+                             MPI_Offset offset ) {
+  char head[PMMG_MPIIO_LINE];
+  int  ier,ieresult,hsize,kw;
+
+  ier = 1;
+
+  if ( bin ) {
+    kw    = PMMG_MPIIO_KwEnd;
+    hsize = sizeof(int);
+    memcpy(head,&kw,hsize);
+  }
+  else {
+    hsize = snprintf(head,PMMG_MPIIO_LINE,"\nEnd\n");
+  }
+
+  if ( parmesh->myrank == parmesh->info.root ) {
+    if ( MPI_SUCCESS != MPI_File_write_at(*fh,offset,head,hsize,MPI_CHAR,
+                                          MPI_STATUS_IGNORE) ) ier = 0;
+  }
+
+  if ( MPI_SUCCESS != MPI_File_close(fh) ) ier = 0;
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  return ieresult;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handle.
+ * \param bin 1 for a binary file, 0 for an ASCII one.
+ * \param kw Medit keyword of the section.
+ * \param kwname name of the section (ASCII files).
+ * \param nglob global number of entities of the section.
+ * \param sub additional data of the section header (NULL if none).
+ * \param subsize size (in bytes) of \a sub.
+ * \param buf local data of the section.
+ * \param size size (in bytes) of \a buf.
+ * \param offset position of the section, updated to the end of the section.
+ *
+ * \return 1 if success, 0 if fail (collective).
+ *
+ * Write a section of a Medit file: the root process writes the section header
+ * and each process writes its data after the data of the lower ranks.
+ *
+ */
+static int PMMG_mpiio_writeSection( PMMG_pParMesh parmesh,MPI_File fh,int bin,
+                                    int kw,const char *kwname,int nglob,
+                                    const char *sub,int subsize,
+                                    const char *buf,size_t size,
+                                    MPI_Offset *offset ) {
+  long long  lsize,lpos,gsize;
+  char       head[PMMG_MPIIO_LINE];
+  int        ier,ieresult,hsize,bhead[3],count;
+
+  ier = 1;
+
+  lsize = (long long)size;
+  lpos  = 0;
+  MPI_Exscan( &lsize,&lpos,1,MPI_LONG_LONG,MPI_SUM,parmesh->comm );
+  /* The result of the exclusive scan is undefined on rank 0 */
+  if ( !parmesh->myrank ) lpos = 0;
+  MPI_Allreduce( &lsize,&gsize,1,MPI_LONG_LONG,MPI_SUM,parmesh->comm );
+
+  /* Section header */
+  if ( bin ) {
+    hsize = 3*sizeof(int) + subsize;
+    if ( *offset + hsize + gsize > INT_MAX ) {
+      /* Same failure on all the procs */
+      if ( parmesh->myrank == parmesh->info.root ) {
+        fprintf(stderr,"\n  ## Error: %s: file too large for the binary Medit"
+                " format (32 bits positions). Use the HDF5 output.\n",__func__);
+      }
+      return 0;
+    }
+    bhead[0] = kw;
+    bhead[1] = (int)(*offset + hsize + gsize);
+    bhead[2] = nglob;
+    memcpy(head,bhead,3*sizeof(int));
+    if ( subsize ) memcpy(head+3*sizeof(int),sub,subsize);
+  }
+  else {
+    hsize = snprintf(head,PMMG_MPIIO_LINE,"\n%s\n%d\n",kwname,nglob);
+    if ( subsize ) memcpy(head+hsize,sub,subsize);
+    hsize += subsize;
+  }
+
+  if ( parmesh->myrank == parmesh->info.root ) {
+    if ( MPI_SUCCESS != MPI_File_write_at(fh,*offset,head,hsize,MPI_CHAR,
+                                          MPI_STATUS_IGNORE) ) ier = 0;
+  }
+
+  /* Local data (collective write) */
+  count = (int)size;
+  if ( size > INT_MAX ) {
+    fprintf(stderr,"\n  ## Error: %s: rank %d: section %s too large.\n",
+            __func__,parmesh->myrank,kwname);
+    ier   = 0;
+    count = 0;
+  }
+  if ( MPI_SUCCESS != MPI_File_write_at_all(fh,*offset+hsize+lpos,(void*)buf,
+                                            count,MPI_CHAR,MPI_STATUS_IGNORE) ) {
+    ier = 0;
+  }
+
+  *offset += hsize + gsize;
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  return ieresult;
+}
+
+/**
+ * \param buf buffer to fill.
+ * \param bin 1 for a binary file, 0 for an ASCII one.
+ * \param ni number of integers to write.
+ * \param ival integers to write.
+ *
+ * \return the number of written bytes.
+ *
+ * Write a record of integers.
+ *
+ */
+static inline
+size_t PMMG_mpiio_intRecord( char *buf,int bin,int ni,int *ival ) {
+  size_t pos;
+  int    i;
+
+  if ( bin ) {
+    memcpy(buf,ival,ni*sizeof(int));
+    return ni*sizeof(int);
+  }
+
+  pos = 0;
+  for ( i=0; i<ni; ++i ) {
+    pos += snprintf(buf+pos,PMMG_MPIIO_LINE-pos,i ? " %d" : "%d",ival[i]);
+  }
+  buf[pos++] = '\n';
+
+  return pos;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param tria 1 if we need the triangles numbering.
+ *
+ * \return 1 if success, 0 if fail (collective).
+ *
+ * Compute the global numbering and the owners of the vertices and of the
+ * triangles (stored in the tmp and flag fields of the points and in the flag
+ * and base fields of the triangles).
+ *
+ */
+static int PMMG_mpiio_gloNum( PMMG_pParMesh parmesh,int tria ) {
+  int ier,ieresult;
+
+  ier = PMMG_Compute_verticesGloNum( parmesh,parmesh->comm );
+
+  if ( tria ) {
+    if ( !PMMG_Compute_trianglesGloNum( parmesh,parmesh->comm ) ) ier = 0;
+  }
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  return ieresult;
+}
+
+
+int PMMG_saveMesh_mpiio(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh  mesh;
+  MMG5_pPoint ppt;
+  MMG5_pTetra pt;
+  MMG5_pTria  ptt;
+  MPI_File    fh;
+  MPI_Offset  offset;
+  size_t      pos,recsize;
+  int         nloc[5],nglob[5],ival[5],ier,bin,k,i,nmax,na;
+  char        *buf,*name;
+
+  ier = ( parmesh->ngrp == 1 );
+  if ( !ier ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.\n",
+            __func__);
+  }
+  MPI_Allreduce( MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ier ) return 0;
+
+  mesh = parmesh->listgrp[0].mesh;
+  name = ( filename && *filename ) ? (char*)filename : parmesh->meshout;
+
+  if ( !PMMG_mpiio_gloNum(parmesh,1) ) return 0;
+
+  /** Count the owned entities: vertices, triangles, tetra, corners and
+   * required vertices */
+  nloc[0] = nloc[1] = nloc[2] = nloc[3] = nloc[4] = 0;
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( (ppt->tag & MG_OVERLAP) || ppt->flag != parmesh->myrank ) continue;
+    ++nloc[0];
+    if ( ppt->tag & MG_CRN ) ++nloc[3];
+    /* Parallel vertices are required with the MG_NOSURF tag */
+    if ( (ppt->tag & MG_REQ) && !(ppt->tag & MG_NOSURF) ) ++nloc[4];
+  }
+  for ( k=1; k<=mesh->nt; ++k ) {
+    if ( mesh->tria[k].base == parmesh->myrank ) ++nloc[1];
+  }
+  for ( k=1; k<=mesh->ne; ++k ) {
+    if ( MG_EOK(&mesh->tetra[k]) ) ++nloc[2];
+  }
+  MPI_Allreduce( nloc,nglob,5,MPI_INT,MPI_SUM,parmesh->comm );
+
+  /** The boundary edges (and their ridge/required tags) are not written by
+   * the parallel writer: warn the user that they will be lost */
+  ival[0] = ( mesh->na > 0 );
+  MPI_Allreduce( ival,&na,1,MPI_INT,MPI_MAX,parmesh->comm );
+  if ( na && parmesh->info.imprim > PMMG_VERB_VERSION &&
+       parmesh->myrank == parmesh->info.root ) {
+    fprintf(stderr,"\n  ## Warning: %s: Edges, Ridges and RequiredEdges"
+            " sections are not written by the parallel writer.\n"
+            "               Use the centralized output to save them.\n",
+            __func__);
+  }
+
+  if ( !PMMG_mpiio_open(parmesh,name,".meshb",&fh,&bin,&offset) ) return 0;
+
+  /** Buffer for the largest section */
+  recsize = bin ? 3*sizeof(double)+sizeof(int) : PMMG_MPIIO_LINE;
+  nmax    = MG_MAX ( MG_MAX(nloc[0],nloc[1]), nloc[2] );
+
+  ier = 1;
+  buf = NULL;
+  PMMG_MALLOC(parmesh,buf,(size_t)nmax*recsize+1,char,"mpiio buffer",ier = 0);
+
+  /** Vertices */
+  pos = 0;
+  for ( k=1; ier && k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( (ppt->tag & MG_OVERLAP) || ppt->flag != parmesh->myrank ) continue;
+    if ( bin ) {
+      memcpy(buf+pos,ppt->c,3*sizeof(double));
+      pos += 3*sizeof(double);
+      ival[0] = (int)ppt->ref;
+      pos += PMMG_mpiio_intRecord(buf+pos,bin,1,ival);
+    }
+    else {
+      pos += snprintf(buf+pos,PMMG_MPIIO_LINE,"%.15lg %.15lg %.15lg %d\n",
+                      ppt->c[0],ppt->c[1],ppt->c[2],(int)ppt->ref);
+    }
+  }
+  /* Remark: the sections are written even after a failure to avoid deadlocks */
+  if ( !PMMG_mpiio_writeSection(parmesh,fh,bin,PMMG_MPIIO_KwVertices,
+                                "Vertices",nglob[0],NULL,0,buf,pos,
+                                &offset) ) ier = 0;
+
+  /** Triangles */
+  if ( nglob[1] ) {
+    pos = 0;
+    for ( k=1; ier && k<=mesh->nt; ++k ) {
+      ptt = &mesh->tria[k];
+      if ( ptt->base != parmesh->myrank ) continue;
+      for ( i=0; i<3; ++i ) {
+        ival[i] = (int)mesh->point[ptt->v[i]].tmp;
+      }
+      ival[3] = (int)ptt->ref;
+      pos += PMMG_mpiio_intRecord(buf+pos,bin,4,ival);
+    }
+    if ( !PMMG_mpiio_writeSection(parmesh,fh,bin,PMMG_MPIIO_KwTriangles,
+                                  "Triangles",nglob[1],NULL,0,buf,pos,
+                                  &offset) ) ier = 0;
+  }
+
+  /** Tetrahedra */
+  pos = 0;
+  for ( k=1; ier && k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+    for ( i=0; i<4; ++i ) {
+      ival[i] = (int)mesh->point[pt->v[i]].tmp;
+    }
+    ival[4] = (int)pt->ref;
+    pos += PMMG_mpiio_intRecord(buf+pos,bin,5,ival);
+  }
+  if ( !PMMG_mpiio_writeSection(parmesh,fh,bin,PMMG_MPIIO_KwTetrahedra,
+                                "Tetrahedra",nglob[2],NULL,0,buf,pos,
+                                &offset) ) ier = 0;
+
+  /** Corners and required vertices */
+  for ( i=3; i<5; ++i ) {
+    if ( !nglob[i] ) continue;
+
+    pos = 0;
+    for ( k=1; ier && k<=mesh->np; ++k ) {
+      ppt = &mesh->point[k];
+      if ( (ppt->tag & MG_OVERLAP) || ppt->flag != parmesh->myrank ) continue;
+      if ( i==3 && !(ppt->tag & MG_CRN) ) continue;
+      if ( i==4 && ( !(ppt->tag & MG_REQ) || (ppt->tag & MG_NOSURF) ) ) continue;
+      ival[0] = (int)ppt->tmp;
+      pos += PMMG_mpiio_intRecord(buf+pos,bin,1,ival);
+    }
+    if ( !PMMG_mpiio_writeSection(parmesh,fh,bin,
+                                  i==3 ? PMMG_MPIIO_KwCorners :
+                                  PMMG_MPIIO_KwRequiredVertices,
+                                  i==3 ? "Corners" : "RequiredVertices",
+                                  nglob[i],NULL,0,buf,pos,&offset) ) ier = 0;
+  }
+
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio buffer");
+
+  if ( !PMMG_mpiio_close(parmesh,&fh,bin,offset) ) ier = 0;
+
+  if ( parmesh->info.imprim > PMMG_VERB_VERSION &&
+       parmesh->myrank == parmesh->info.root ) {
+    fprintf(stdout,"     NUMBER OF VERTICES   %8d   CORNERS    %6d   REQUIRED %6d\n",
+            nglob[0],nglob[3],nglob[4]);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",nglob[1]);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %8d\n",nglob[2]);
+  }
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param sol pointer toward the solution to save.
+ * \param filename name of the file.
+ *
+ * \return 1 if success, 0 if fail (collective).
+ *
+ * Write a solution at vertices in a centralized Medit file: each process
+ * writes the values at the vertices that it owns.
+ *
+ */
+static int PMMG_saveSol_mpiio(PMMG_pParMesh parmesh,MMG5_pSol sol,
+                              const char *filename) {
+  MMG5_pMesh  mesh;
+  MMG5_pPoint ppt;
+  MPI_File    fh;
+  MPI_Offset  offset;
+  size_t      pos,recsize;
+  double      *m,dbuf[6];
+  int         nloc,nglob,ival[2],ier,bin,k,i,subsize;
+  char        *buf,sub[PMMG_MPIIO_LINE];
+
+  mesh = parmesh->listgrp[0].mesh;
+
+  if ( (!filename) || (!*filename) ) {
+    fprintf(stderr,"  ## Error: %s: no name given for the solution file.\n",
+            __func__);
+    return 0;
+  }
+
+  if ( !PMMG_mpiio_gloNum(parmesh,0) ) return 0;
+
+  nloc = 0;
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( (ppt->tag & MG_OVERLAP) || ppt->flag != parmesh->myrank ) continue;
+    ++nloc;
+  }
+  MPI_Allreduce( &nloc,&nglob,1,MPI_INT,MPI_SUM,parmesh->comm );
+
+  if ( !PMMG_mpiio_open(parmesh,filename,".solb",&fh,&bin,&offset) ) return 0;
+
+  recsize = bin ? sol->size*sizeof(double) : PMMG_MPIIO_LINE;
+
+  ier = 1;
+  buf = NULL;
+  PMMG_MALLOC(parmesh,buf,(size_t)nloc*recsize+1,char,"mpiio buffer",ier = 0);
+
+  /* Number of solutions and their type */
+  ival[0] = 1;
+  ival[1] = sol->type;
+  subsize = (int)PMMG_mpiio_intRecord(sub,bin,2,ival);
+
+  pos = 0;
+  for ( k=1; ier && k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( (ppt->tag & MG_OVERLAP) || ppt->flag != parmesh->myrank ) continue;
+
+    m = &sol->m[k*sol->size];
+    memcpy(dbuf,m,sol->size*sizeof(double));
+    if ( sol->size == 6 ) {
+      /* Medit stores the symmetric tensors as m11 m12 m22 m13 m23 m33 */
+      dbuf[2] = m[3];
+      dbuf[3] = m[2];
+    }
+
+    if ( bin ) {
+      memcpy(buf+pos,dbuf,sol->size*sizeof(double));
+      pos += sol->size*sizeof(double);
+    }
+    else {
+      for ( i=0; i<sol->size; ++i ) {
+        pos += snprintf(buf+pos,PMMG_MPIIO_LINE,"%.15lg ",dbuf[i]);
+      }
+      buf[pos++] = '\n';
+    }
+  }
+  if ( !PMMG_mpiio_writeSection(parmesh,fh,bin,
+                                PMMG_MPIIO_KwSolAtVertices,
+                                "SolAtVertices",nglob,sub,subsize,
+                                buf,pos,&offset) ) ier = 0;
+
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio buffer");
+
+  if ( !PMMG_mpiio_close(parmesh,&fh,bin,offset) ) ier = 0;
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param sol pointer toward the solution to save (NULL if the process has no
+ * group).
+ *
+ * \return 1 if the solution has to be saved, -1 if no process stores it, 0 if
+ * fail (collective).
+ *
+ * Check that each process has exactly one group and share the existence of the
+ * solution, so all the processes enter (or skip) the collective writer.
+ *
+ */
+static int PMMG_mpiio_solCheck( PMMG_pParMesh parmesh,MMG5_pSol sol ) {
+  int ier,isSol[2];
+
+  ier = ( parmesh->ngrp == 1 );
+  if ( !ier ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.\n",
+            __func__);
+  }
+  MPI_Allreduce( MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ier ) return 0;
+
+  /* Solution stored on some processes, missing on some processes */
+  isSol[0] = ( sol && sol->m );
+  isSol[1] = !isSol[0];
+  MPI_Allreduce( MPI_IN_PLACE,isSol,2,MPI_INT,MPI_MAX,parmesh->comm );
+
+  if ( !isSol[0] ) return -1;
+
+  if ( isSol[1] ) {
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"  ## Error: %s: solution not allocated on all the"
+              " processes.\n",__func__);
+    }
+    return 0;
+  }
+
+  return 1;
+}
+
+int PMMG_saveMet_mpiio(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pSol met;
+  int       ier;
+
+  met = parmesh->ngrp ? parmesh->listgrp[0].met : NULL;
+
+  ier = PMMG_mpiio_solCheck(parmesh,met);
+  if ( ier < 1 ) return ier < 0 ? 1 : 0;
+
+  return PMMG_saveSol_mpiio(parmesh,met,( filename && *filename ) ?
+                            filename : parmesh->metout);
+}
+
+int PMMG_saveLs_mpiio(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pSol ls;
+  int       ier;
+
+  ls = parmesh->ngrp ? parmesh->listgrp[0].ls : NULL;
+
+  /* Except in cases where we want to partition and input mesh + ls without
+   * inserting the ls and remeshing, the level-set will be deallocated */
+  ier = PMMG_mpiio_solCheck(parmesh,ls);
+  if ( ier < 1 ) return ier < 0 ? 1 : 0;
+
+  return PMMG_saveSol_mpiio(parmesh,ls,( filename && *filename ) ?
+                            filename : parmesh->lsout);
+}
+
+/**
+ * \param n number of entities.
+ * \param nprocs number of processes.
+ * \param rank index of the process.
+ *
+ * \return the index (starting from 0) of the first entity of the block of
+ * \a rank in the block partition of \a n entities.
+ *
+ */
+static inline
+int PMMG_mpiio_blockFirst( int n,int nprocs,int rank ) {
+  return (int)( ((long long)n*rank) / nprocs );
+}
+
+/**
+ * \param n number of entities.
+ * \param nprocs number of processes.
+ * \param i index of the entity (starting from 0).
+ *
+ * \return the process that owns the entity \a i in the block partition of \a n
+ * entities.
+ *
+ */
+static inline
+int PMMG_mpiio_blockOwner( int n,int nprocs,int i ) {
+  int rank;
+
+  rank = (int)( ((long long)i*nprocs) / n );
+  while ( rank < nprocs-1 && PMMG_mpiio_blockFirst(n,nprocs,rank+1) <= i ) ++rank;
+  while ( PMMG_mpiio_blockFirst(n,nprocs,rank) > i ) --rank;
+
+  return rank;
+}
+
+/**
+ * \param a pointer toward an integer.
+ * \param b pointer toward an integer.
+ *
+ * \return -1, 0 or 1 if \a a is lower, equal or greater than \a b.
+ *
+ * Compare two integers (to use in qsort and bsearch).
+ *
+ */
+static int PMMG_mpiio_compInt( const void *a,const void *b ) {
+  int ia,ib;
+
+  ia = *(const int*)a;
+  ib = *(const int*)b;
+
+  return ( ia > ib ) - ( ia < ib );
+}
+
+/**
+ * \param gids sorted global indices of the local vertices.
+ * \param np number of local vertices.
+ * \param gid global index of a vertex.
+ *
+ * \return the local index of the vertex \a gid, 0 if it isn't a local vertex.
+ *
+ */
+static inline
+int PMMG_mpiio_locId( int *gids,int np,int gid ) {
+  int *ptr;
+
+  ptr = (int*)bsearch(&gid,gids,np,sizeof(int),PMMG_mpiio_compInt);
+
+  return ptr ? (int)(ptr-gids)+1 : 0;
+}
+
+/**
+ * \param fh MPI file handle.
+ * \param sol 1 for a solution file, 0 for a mesh file.
+ * \param pos positions of the data of the sections.
+ * \param nent number of entities of the sections.
+ * \param msize size of the solution (solution files).
+ *
+ * \return 1 if success, 0 if the file can't be read, -1 if the file contains
+ * data that isn't handled by the parallel loader.
+ *
+ * Scan the keywords of a binary Medit file and store the position and the
+ * number of entities of the sections read by the parallel loader (local call).
+ *
+ */
+static int PMMG_mpiio_scan( MPI_File fh,int sol,long long *pos,int *nent,
+                            int *msize ) {
+  MPI_Offset off,next;
+  long long  pos64;
+  int        ival[3],ver,kw,pos32,sec;
+
+  if ( MPI_SUCCESS != MPI_File_read_at(fh,0,ival,2,MPI_INT,MPI_STATUS_IGNORE) ) {
+    return 0;
+  }
+
+  /* Other endianness, single precision (version 1) and 64 bits integers
+   * (version 4) are left to the Mmg loader */
+  if ( ival[0] != 1 || ( ival[1] != 2 && ival[1] != 3 ) ) return -1;
+  ver = ival[1];
+
+  off = 2*sizeof(int);
+  while ( 1 ) {
+    if ( MPI_SUCCESS != MPI_File_read_at(fh,off,&kw,1,MPI_INT,MPI_STATUS_IGNORE) ) {
+      return 0;
+    }
+    off += sizeof(int);
+    if ( kw == PMMG_MPIIO_KwEnd ) break;
+
+    /* Position of the next keyword (64 bits from version 3) */
+    if ( ver == 3 ) {
+      if ( MPI_SUCCESS != MPI_File_read_at(fh,off,&pos64,1,MPI_LONG_LONG,
+                                           MPI_STATUS_IGNORE) ) return 0;
+      next = pos64;
+      off += sizeof(long long);
+    }
+    else {
+      if ( MPI_SUCCESS != MPI_File_read_at(fh,off,&pos32,1,MPI_INT,
+                                           MPI_STATUS_IGNORE) ) return 0;
+      next = pos32;
+      off += sizeof(int);
+    }
+    if ( next <= off ) return -1;
+
+    /* Number of entities (and solution header) */
+    ival[0] = ival[1] = ival[2] = 0;
+    if ( MPI_SUCCESS != MPI_File_read_at(fh,off,ival,3,MPI_INT,MPI_STATUS_IGNORE) ) {
+      return 0;
+    }
+
+    sec = -1;
+    switch ( kw ) {
+    case ( PMMG_MPIIO_KwDimension ):
+      if ( ival[0] != 3 ) return -1;
+      break;
+    case ( PMMG_MPIIO_KwVertices ):
+      sec = PMMG_MPIIO_SecVertices;
+      break;
+    case ( PMMG_MPIIO_KwTriangles ):
+      sec = PMMG_MPIIO_SecTriangles;
+      break;
+    case ( PMMG_MPIIO_KwTetrahedra ):
+      sec = PMMG_MPIIO_SecTetrahedra;
+      break;
+    case ( PMMG_MPIIO_KwCorners ):
+      sec = PMMG_MPIIO_SecCorners;
+      break;
+    case ( PMMG_MPIIO_KwRequiredVertices ):
+      sec = PMMG_MPIIO_SecRequired;
+      break;
+    case ( PMMG_MPIIO_KwSolAtVertices ):
+      /* Only one scalar or tensor solution */
+      if ( !sol || ival[1] != 1 ) return -1;
+      if ( ival[2] == 1 ) {
+        *msize = 1;
+      }
+      else if ( ival[2] == 3 ) {
+        *msize = 6;
+      }
+      else {
+        return -1;
+      }
+      pos[PMMG_MPIIO_SecSol]  = off + 3*sizeof(int);
+      nent[PMMG_MPIIO_SecSol] = ival[0];
+      break;
+    default:
+      /* Edges, ridges, normals... */
+      return -1;
+    }
+
+    if ( sec >= 0 ) {
+      if ( sol ) return -1;
+      pos[sec]  = off + sizeof(int);
+      nent[sec] = ival[0];
+    }
+
+    off = next;
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file.
+ * \param sol 1 for a solution file, 0 for a mesh file.
+ * \param fh pointer toward the MPI file handle.
+ * \param pos positions of the data of the sections.
+ * \param nent number of entities of the sections.
+ * \param msize size of the solution (solution files).
+ *
+ * \return 1 if success, 0 if the file can't be opened or read, -1 if the file
+ * contains data that isn't handled by the parallel loader (collective).
+ *
+ * Open a binary Medit file, scan its sections on the root process and
+ * broadcast their positions and sizes. The file is left open only if success.
+ *
+ */
+static int PMMG_mpiio_openRead( PMMG_pParMesh parmesh,const char *filename,
+                                int sol,MPI_File *fh,long long *pos,int *nent,
+                                int *msize ) {
+  int      ier,i;
+  MPI_Info info;
+
+  PMMG_mpiio_hints(parmesh,&info);
+
+  ier = ( MPI_SUCCESS == MPI_File_open(parmesh->comm,(char*)filename,
+                                       MPI_MODE_RDONLY,info,fh) );
+  if ( info != MPI_INFO_NULL ) MPI_Info_free(&info);
+
+  if ( !ier ) {
+    return 0;
+  }
+
+  for ( i=0; i<PMMG_MPIIO_NSec; ++i ) {
+    pos[i]  = 0;
+    nent[i] = 0;
+  }
+  *msize = 0;
+
+  ier = 1;
+  if ( parmesh->myrank == parmesh->info.root ) {
+    ier = PMMG_mpiio_scan(*fh,sol,pos,nent,msize);
+  }
+
+  MPI_Bcast( &ier,1,MPI_INT,parmesh->info.root,parmesh->comm );
+  MPI_Bcast( pos,PMMG_MPIIO_NSec,MPI_LONG_LONG,parmesh->info.root,parmesh->comm );
+  MPI_Bcast( nent,PMMG_MPIIO_NSec,MPI_INT,parmesh->info.root,parmesh->comm );
+  MPI_Bcast( msize,1,MPI_INT,parmesh->info.root,parmesh->comm );
+
+  if ( ier != 1 ) {
+    MPI_File_close(fh);
+  }
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handle.
+ * \param pos position of the data of the section.
+ * \param nglob number of entities of the section.
+ * \param recsize size (in bytes) of the record of an entity.
+ * \param buf pointer toward the allocated buffer containing the block.
+ * \param first index of the first entity of the block (starting from 0).
+ * \param nloc number of entities of the block.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the block of the process in the block partition of a section
+ * (collective read).
+ *
+ */
+static int PMMG_mpiio_readBlock( PMMG_pParMesh parmesh,MPI_File fh,long long pos,
+                                 int nglob,int recsize,char **buf,int *first,
+                                 int *nloc ) {
+  MPI_Datatype rtype;
+  int          ier,count;
+
+  *first = PMMG_mpiio_blockFirst(nglob,parmesh->nprocs,parmesh->myrank);
+  *nloc  = PMMG_mpiio_blockFirst(nglob,parmesh->nprocs,parmesh->myrank+1) - *first;
+
+  ier  = 1;
+  *buf = NULL;
+  PMMG_MALLOC(parmesh,*buf,(size_t)(*nloc)*recsize,char,"mpiio read buffer",ier = 0);
+  count = ier ? *nloc : 0;
+
+  /* One record per item to avoid overflows of the count */
+  MPI_Type_contiguous( recsize,MPI_CHAR,&rtype );
+  MPI_Type_commit( &rtype );
+
+  if ( MPI_SUCCESS != MPI_File_read_at_all(fh,(MPI_Offset)pos+(MPI_Offset)(*first)*recsize,
+                                           *buf,count,rtype,MPI_STATUS_IGNORE) ) {
+    ier = 0;
+  }
+
+  MPI_Type_free( &rtype );
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param recsize size (in bytes) of a record.
+ * \param sbuf records to send, sorted by destination.
+ * \param scount number of records to send to each process.
+ * \param rbuf pointer toward the allocated buffer of the received records.
+ * \param rcount number of records received from each process.
+ * \param rdispl displacement of the records of each process in \a rbuf (size
+ * nprocs+1, the last value is the number of received records).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Exchange records between all the processes (collective).
+ *
+ */
+static int PMMG_mpiio_alltoallv( PMMG_pParMesh parmesh,int recsize,char *sbuf,
+                                 int *scount,char **rbuf,int *rcount,
+                                 int *rdispl ) {
+  MPI_Datatype rtype;
+  int          *sdispl,nprocs,k,ier;
+
+  nprocs = parmesh->nprocs;
+  ier    = 1;
+  *rbuf  = NULL;
+
+  MPI_CHECK( MPI_Alltoall(scount,1,MPI_INT,rcount,1,MPI_INT,parmesh->comm),
+             return 0 );
+
+  PMMG_MALLOC(parmesh,sdispl,nprocs,int,"sdispl",return 0);
+
+  sdispl[0] = rdispl[0] = 0;
+  for ( k=1; k<nprocs; ++k ) {
+    sdispl[k] = sdispl[k-1] + scount[k-1];
+    rdispl[k] = rdispl[k-1] + rcount[k-1];
+  }
+  rdispl[nprocs] = rdispl[nprocs-1] + rcount[nprocs-1];
+
+  PMMG_MALLOC(parmesh,*rbuf,(size_t)rdispl[nprocs]*recsize,char,
+              "mpiio recv buffer",ier = 0);
+
+  if ( ier ) {
+    MPI_Type_contiguous( recsize,MPI_CHAR,&rtype );
+    MPI_Type_commit( &rtype );
+
+    MPI_CHECK( MPI_Alltoallv(sbuf,scount,sdispl,rtype,*rbuf,rcount,rdispl,rtype,
+                             parmesh->comm),ier = 0 );
+
+    MPI_Type_free( &rtype );
+  }
+
+  PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handle.
+ * \param pos position of the data of the section.
+ * \param nglob number of entities of the section.
+ * \param npglob number of vertices of the mesh.
+ * \param vfirst index of the first vertex of the block of the process.
+ * \param vnloc number of vertices of the block of the process.
+ * \param vtag tags of the vertices of the block.
+ * \param bit tag to add.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read by blocks a section of vertex indices (corners or required vertices)
+ * and tag the vertices in the block of the process that owns them
+ * (collective).
+ *
+ */
+static int PMMG_mpiio_readTags( PMMG_pParMesh parmesh,MPI_File fh,long long pos,
+                                int nglob,int npglob,int vfirst,int vnloc,
+                                char *vtag,char bit ) {
+  char *buf,*rbuf;
+  int  *ids,*sids,*scount,*rcount,*rdispl,*cur,nprocs,first,nloc,ier,ieresult,k,r;
+
+  nprocs = parmesh->nprocs;
+  buf = rbuf = NULL;
+  sids = scount = rcount = rdispl = cur = NULL;
+
+  ier = PMMG_mpiio_readBlock(parmesh,fh,pos,nglob,sizeof(int),&buf,&first,&nloc);
+  ids = (int*)buf;
+  if ( !ier ) nloc = 0;
+
+  PMMG_CALLOC(parmesh,scount,nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,nprocs,int,"rcount",ier = 0);
+  PMMG_CALLOC(parmesh,rdispl,nprocs+1,int,"rdispl",ier = 0);
+  PMMG_CALLOC(parmesh,cur,nprocs,int,"cur",ier = 0);
+  PMMG_MALLOC(parmesh,sids,nloc,int,"sids",ier = 0);
+
+  for ( k=0; ier && k<nloc; ++k ) {
+    if ( ids[k] < 1 || ids[k] > npglob ) {
+      fprintf(stderr,"\n  ## Error: %s: wrong vertex index %d.\n",__func__,ids[k]);
+      ier = 0;
+    }
+  }
+
+  /* The exchange is collective: all the processes have to skip it together */
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) {
+    ier = 0;
+    goto end;
+  }
+
+  /* Sort the indices by owner */
+  for ( k=0; k<nloc; ++k ) {
+    ++scount[PMMG_mpiio_blockOwner(npglob,nprocs,ids[k]-1)];
+  }
+  for ( r=1; r<nprocs; ++r ) {
+    cur[r] = cur[r-1] + scount[r-1];
+  }
+  for ( k=0; k<nloc; ++k ) {
+    sids[cur[PMMG_mpiio_blockOwner(npglob,nprocs,ids[k]-1)]++] = ids[k];
+  }
+
+  ier = PMMG_mpiio_alltoallv(parmesh,sizeof(int),(char*)sids,scount,&rbuf,
+                             rcount,rdispl);
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) {
+    ier = 0;
+    goto end;
+  }
+
+  ids = (int*)rbuf;
+  for ( k=0; k<rdispl[nprocs]; ++k ) {
+    assert ( ids[k]-1-vfirst >= 0 && ids[k]-1-vfirst < vnloc );
+    vtag[ids[k]-1-vfirst] |= bit;
+  }
+
+end:
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio read buffer");
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio recv buffer");
+  PMMG_DEL_MEM(parmesh,sids,int,"sids");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,cur,int,"cur");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handle of the mesh.
+ * \param mfh MPI file handle of the metric (unused if \a msize is 0).
+ * \param pos positions of the sections of the mesh file.
+ * \param mpos positions of the sections of the metric file.
+ * \param nent number of entities of the sections of the mesh file.
+ * \param msize size of the metric (0 if no metric).
+ * \param gids sorted global indices of the local vertices.
+ * \param np number of local vertices.
+ * \param vdata pointer toward the allocated data of the local vertices
+ * (coordinates, reference, tags and metric).
+ * \param vfirst index of the first vertex of the block of the process.
+ * \param vnloc number of vertices of the block of the process.
+ * \param reqptr pointer toward the allocated list of the first requester of
+ * each vertex of the block (size vnloc+1).
+ * \param reqrank pointer toward the allocated list of the requesters of the
+ * vertices of the block.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the block of vertices of the process (with its metric, corners and
+ * required vertices) and send the vertices to the processes that use them.
+ * The processes that use each vertex of the block are stored to build the
+ * node communicators (collective).
+ *
+ */
+static int PMMG_mpiio_readVertices( PMMG_pParMesh parmesh,MPI_File fh,MPI_File mfh,
+                                    long long *pos,long long *mpos,int *nent,
+                                    int msize,int *gids,int np,double **vdata,
+                                    int *vfirst,int *vnloc,int **reqptr,
+                                    int **reqrank ) {
+  double *ans;
+  char   *vbuf,*mbuf,*vtag,*rbuf;
+  int    *req,*scount,*rcount,*rdispl,*sdispl,*cur;
+  int    nprocs,npglob,vrec,first,nloc,ier,ieresult,slot,ref,i,k,r;
+
+  nprocs = parmesh->nprocs;
+  npglob = nent[PMMG_MPIIO_SecVertices];
+  vrec   = 5 + msize;
+
+  vbuf = mbuf = vtag = rbuf = NULL;
+  ans  = NULL;
+  scount = rcount = rdispl = sdispl = cur = NULL;
+  *vdata = NULL;
+  *reqptr = *reqrank = NULL;
+
+  /** Block of vertices, metric, corners and required vertices */
+  ier = PMMG_mpiio_readBlock(parmesh,fh,pos[PMMG_MPIIO_SecVertices],npglob,
+                             PMMG_MPIIO_VerSize,&vbuf,vfirst,vnloc);
+  if ( msize ) {
+    if ( !PMMG_mpiio_readBlock(parmesh,mfh,mpos[PMMG_MPIIO_SecSol],
+                               npglob,msize*sizeof(double),&mbuf,
+                               &first,&nloc) ) ier = 0;
+  }
+  PMMG_CALLOC(parmesh,vtag,*vnloc,char,"vtag",ier = 0);
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  if ( nent[PMMG_MPIIO_SecCorners] ) {
+    ier = PMMG_mpiio_readTags(parmesh,fh,pos[PMMG_MPIIO_SecCorners],
+                              nent[PMMG_MPIIO_SecCorners],npglob,*vfirst,*vnloc,
+                              vtag,1);
+  }
+  if ( nent[PMMG_MPIIO_SecRequired] ) {
+    if ( !PMMG_mpiio_readTags(parmesh,fh,pos[PMMG_MPIIO_SecRequired],
+                              nent[PMMG_MPIIO_SecRequired],npglob,
+                              *vfirst,*vnloc,vtag,2) ) ier = 0;
+  }
+
+  /** Requests of the local vertices to the processes that read them (the local
+   * vertices are sorted, thus they are already sorted by owner) */
+  PMMG_CALLOC(parmesh,scount,nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,nprocs,int,"rcount",ier = 0);
+  PMMG_CALLOC(parmesh,rdispl,nprocs+1,int,"rdispl",ier = 0);
+  PMMG_CALLOC(parmesh,sdispl,nprocs+1,int,"sdispl",ier = 0);
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( i=0; i<np; ++i ) {
+    ++scount[PMMG_mpiio_blockOwner(npglob,nprocs,gids[i]-1)];
+  }
+
+  ier = PMMG_mpiio_alltoallv(parmesh,sizeof(int),(char*)gids,scount,&rbuf,
+                             rcount,rdispl);
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+  req = (int*)rbuf;
+
+  /** Answers: coordinates, reference, tags and metric of the requested
+   * vertices, in the order of the requests */
+  PMMG_MALLOC(parmesh,ans,(size_t)rdispl[nprocs]*vrec,double,"ans",ier = 0);
+  PMMG_CALLOC(parmesh,*reqptr,*vnloc+1,int,"reqptr",ier = 0);
+  PMMG_MALLOC(parmesh,*reqrank,rdispl[nprocs],int,"reqrank",ier = 0);
+  PMMG_CALLOC(parmesh,cur,*vnloc,int,"cur",ier = 0);
+
+  for ( k=0; ier && k<rdispl[nprocs]; ++k ) {
+    slot = req[k]-1-*vfirst;
+    assert ( slot >= 0 && slot < *vnloc );
+
+    memcpy(&ans[k*vrec],vbuf+slot*PMMG_MPIIO_VerSize,3*sizeof(double));
+    memcpy(&ref,vbuf+slot*PMMG_MPIIO_VerSize+3*sizeof(double),sizeof(int));
+    ans[k*vrec+3] = ref;
+    ans[k*vrec+4] = vtag[slot];
+    if ( msize ) {
+      memcpy(&ans[k*vrec+5],mbuf+slot*msize*sizeof(double),msize*sizeof(double));
+    }
+    ++(*reqptr)[slot+1];
+  }
+
+  /* Processes that use each vertex of the block */
+  for ( slot=0; ier && slot<*vnloc; ++slot ) {
+    (*reqptr)[slot+1] += (*reqptr)[slot];
+  }
+  for ( r=0; ier && r<nprocs; ++r ) {
+    for ( k=rdispl[r]; k<rdispl[r+1]; ++k ) {
+      slot = req[k]-1-*vfirst;
+      (*reqrank)[(*reqptr)[slot]+cur[slot]++] = r;
+    }
+  }
+
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio recv buffer");
+  PMMG_DEL_MEM(parmesh,vbuf,char,"mpiio read buffer");
+  PMMG_DEL_MEM(parmesh,mbuf,char,"mpiio read buffer");
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  /** Send back the answers: they are received in the order of the local
+   * vertices */
+  ier = PMMG_mpiio_alltoallv(parmesh,vrec*sizeof(double),(char*)ans,rcount,
+                             &rbuf,scount,sdispl);
+  *vdata = (double*)rbuf;
+  rbuf   = NULL;
+
+  if ( ier && sdispl[nprocs] != np ) ier = 0;
+
+end:
+  PMMG_DEL_MEM(parmesh,ans,double,"ans");
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio recv buffer");
+  PMMG_DEL_MEM(parmesh,vbuf,char,"mpiio read buffer");
+  PMMG_DEL_MEM(parmesh,mbuf,char,"mpiio read buffer");
+  PMMG_DEL_MEM(parmesh,vtag,char,"vtag");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+  PMMG_DEL_MEM(parmesh,cur,int,"cur");
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  return ieresult;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param vfirst index of the first vertex of the block of the process.
+ * \param vnloc number of vertices of the block of the process.
+ * \param reqptr first requester of each vertex of the block.
+ * \param reqrank requesters of the vertices of the block.
+ * \param gids sorted global indices of the local vertices.
+ * \param np number of local vertices.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Send to each process the list of the other processes that use its vertices
+ * and set the node communicators with the global indices of the vertices
+ * (collective).
+ *
+ */
+static int PMMG_mpiio_setNodeComms( PMMG_pParMesh parmesh,int vfirst,int vnloc,
+                                    int *reqptr,int *reqrank,int *gids,int np ) {
+  char *rbuf;
+  int  *pairs,*scount,*rcount,*rdispl,*cur,*nitem,*first,*loc,*glob;
+  int  nprocs,npairs,ncomm,icomm,ier,ieresult,slot,i,j,k,r;
+
+  nprocs = parmesh->nprocs;
+  ier    = 1;
+  rbuf   = NULL;
+  pairs  = scount = rcount = rdispl = cur = nitem = first = loc = glob = NULL;
+
+  PMMG_CALLOC(parmesh,scount,nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,nprocs,int,"rcount",ier = 0);
+  PMMG_CALLOC(parmesh,rdispl,nprocs+1,int,"rdispl",ier = 0);
+  PMMG_CALLOC(parmesh,cur,nprocs,int,"cur",ier = 0);
+  PMMG_CALLOC(parmesh,nitem,nprocs,int,"nitem",ier = 0);
+  PMMG_CALLOC(parmesh,first,nprocs+1,int,"first",ier = 0);
+
+  /** Pairs (vertex, other process using the vertex) for each process using a
+   * shared vertex */
+  npairs = 0;
+  for ( slot=0; ier && slot<vnloc; ++slot ) {
+    k = reqptr[slot+1] - reqptr[slot];
+    if ( k < 2 ) continue;
+    for ( i=reqptr[slot]; i<reqptr[slot+1]; ++i ) {
+      scount[reqrank[i]] += k-1;
+    }
+    npairs += k*(k-1);
+  }
+  PMMG_MALLOC(parmesh,pairs,2*npairs,int,"pairs",ier = 0);
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( r=1; r<nprocs; ++r ) {
+    cur[r] = cur[r-1] + scount[r-1];
+  }
+  for ( slot=0; slot<vnloc; ++slot ) {
+    if ( reqptr[slot+1] - reqptr[slot] < 2 ) continue;
+    for ( i=reqptr[slot]; i<reqptr[slot+1]; ++i ) {
+      for ( j=reqptr[slot]; j<reqptr[slot+1]; ++j ) {
+        if ( i==j ) continue;
+        k = cur[reqrank[i]]++;
+        pairs[2*k]   = vfirst+slot+1;
+        pairs[2*k+1] = reqrank[j];
+      }
+    }
+  }
+
+  ier = PMMG_mpiio_alltoallv(parmesh,2*sizeof(int),(char*)pairs,scount,&rbuf,
+                             rcount,rdispl);
+  PMMG_DEL_MEM(parmesh,pairs,int,"pairs");
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  pairs  = (int*)rbuf;
+  rbuf   = NULL;
+  npairs = rdispl[nprocs];
+
+  /** Interface vertices with each neighbour */
+  for ( k=0; k<npairs; ++k ) {
+    ++nitem[pairs[2*k+1]];
+  }
+  ncomm = 0;
+  for ( r=0; r<nprocs; ++r ) {
+    first[r+1] = first[r] + nitem[r];
+    cur[r]     = first[r];
+    if ( nitem[r] ) ++ncomm;
+  }
+
+  PMMG_MALLOC(parmesh,loc,npairs,int,"loc",ier = 0);
+  PMMG_MALLOC(parmesh,glob,npairs,int,"glob",ier = 0);
+  if ( !ier ) goto end;
+
+  for ( k=0; k<npairs; ++k ) {
+    i       = cur[pairs[2*k+1]]++;
+    glob[i] = pairs[2*k];
+    loc[i]  = PMMG_mpiio_locId(gids,np,pairs[2*k]);
+    assert ( loc[i] );
+  }
+
+  /** Node communicators (ordered by global index) */
+  if ( !PMMG_Set_numberOfNodeCommunicators(parmesh,ncomm) ) {
+    ier = 0;
+    goto end;
+  }
+  icomm = 0;
+  for ( r=0; r<nprocs; ++r ) {
+    if ( !nitem[r] ) continue;
+    if ( !PMMG_Set_ithNodeCommunicatorSize(parmesh,icomm,r,nitem[r]) ||
+         !PMMG_Set_ithNodeCommunicator_nodes(parmesh,icomm,&loc[first[r]],
+                                             &glob[first[r]],1) ) {
+      ier = 0;
+      goto end;
+    }
+    ++icomm;
+  }
+
+end:
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio recv buffer");
+  PMMG_DEL_MEM(parmesh,pairs,int,"pairs");
+  PMMG_DEL_MEM(parmesh,loc,int,"loc");
+  PMMG_DEL_MEM(parmesh,glob,int,"glob");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,cur,int,"cur");
+  PMMG_DEL_MEM(parmesh,nitem,int,"nitem");
+  PMMG_DEL_MEM(parmesh,first,int,"first");
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  return ieresult;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handle of the mesh.
+ * \param pos positions of the sections of the mesh file.
+ * \param nent number of entities of the sections of the mesh file.
+ * \param vfirst index of the first vertex of the block of the process.
+ * \param reqptr first requester of each vertex of the block.
+ * \param reqrank requesters of the vertices of the block.
+ * \param gids sorted global indices of the local vertices.
+ * \param np number of local vertices.
+ * \param tetra local tetrahedra (4 local vertex indices and ref per tetra).
+ * \param ne number of local tetrahedra.
+ * \param tria pointer toward the allocated local triangles (3 local vertex
+ * indices and ref per triangle).
+ * \param nt pointer toward the number of local triangles.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the triangles by blocks and send each triangle to the processes that
+ * use its first vertex: each process keeps the triangles that are faces of its
+ * tetrahedra (collective).
+ *
+ */
+static int PMMG_mpiio_readTriangles( PMMG_pParMesh parmesh,MPI_File fh,
+                                     long long *pos,int *nent,int vfirst,
+                                     int *reqptr,int *reqrank,int *gids,int np,
+                                     int *tetra,int ne,int **tria,int *nt ) {
+  char *buf,*rbuf;
+  int  *tri,*stri,*scount,*rcount,*rdispl,*cur,*vptr,*vtet;
+  int  nprocs,npglob,first,nloc,ntri,ier,ieresult,slot,ip[3],found,i,j,k,r;
+
+  nprocs = parmesh->nprocs;
+  npglob = nent[PMMG_MPIIO_SecVertices];
+  *tria  = NULL;
+  *nt    = 0;
+
+  buf = rbuf = NULL;
+  stri = scount = rcount = rdispl = cur = vptr = vtet = NULL;
+
+  ier = PMMG_mpiio_readBlock(parmesh,fh,pos[PMMG_MPIIO_SecTriangles],
+                             nent[PMMG_MPIIO_SecTriangles],4*sizeof(int),&buf,
+                             &first,&nloc);
+  tri = (int*)buf;
+
+  PMMG_CALLOC(parmesh,scount,nprocs,int,"scount",ier = 0);
+  PMMG_CALLOC(parmesh,rcount,nprocs,int,"rcount",ier = 0);
+  PMMG_CALLOC(parmesh,rdispl,nprocs+1,int,"rdispl",ier = 0);
+  PMMG_CALLOC(parmesh,cur,nprocs,int,"cur",ier = 0);
+  PMMG_MALLOC(parmesh,stri,4*nloc,int,"stri",ier = 0);
+
+  for ( k=0; ier && k<nloc; ++k ) {
+    for ( i=0; i<3; ++i ) {
+      if ( tri[4*k+i] < 1 || tri[4*k+i] > npglob ) {
+        fprintf(stderr,"\n  ## Error: %s: wrong vertex index %d in triangle %d.\n",
+                __func__,tri[4*k+i],first+k+1);
+        ier = 0;
+      }
+    }
+  }
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  /** Send the triangles to the process that owns their first vertex */
+  for ( k=0; k<nloc; ++k ) {
+    ++scount[PMMG_mpiio_blockOwner(npglob,nprocs,tri[4*k]-1)];
+  }
+  for ( r=1; r<nprocs; ++r ) {
+    cur[r] = cur[r-1] + scount[r-1];
+  }
+  for ( k=0; k<nloc; ++k ) {
+    j = cur[PMMG_mpiio_blockOwner(npglob,nprocs,tri[4*k]-1)]++;
+    memcpy(&stri[4*j],&tri[4*k],4*sizeof(int));
+  }
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio read buffer");
+
+  ier = PMMG_mpiio_alltoallv(parmesh,4*sizeof(int),(char*)stri,scount,&rbuf,
+                             rcount,rdispl);
+  PMMG_DEL_MEM(parmesh,stri,int,"stri");
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  /** Forward them to the processes that use this vertex */
+  buf  = rbuf;
+  rbuf = NULL;
+  tri  = (int*)buf;
+  ntri = rdispl[nprocs];
+
+  for ( r=0; r<nprocs; ++r ) {
+    scount[r] = 0;
+  }
+  nloc = 0;
+  for ( k=0; k<ntri; ++k ) {
+    slot = tri[4*k]-1-vfirst;
+    for ( i=reqptr[slot]; i<reqptr[slot+1]; ++i ) {
+      ++scount[reqrank[i]];
+      ++nloc;
+    }
+  }
+  PMMG_MALLOC(parmesh,stri,4*nloc,int,"stri",ier = 0);
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  cur[0] = 0;
+  for ( r=1; r<nprocs; ++r ) {
+    cur[r] = cur[r-1] + scount[r-1];
+  }
+  for ( k=0; k<ntri; ++k ) {
+    slot = tri[4*k]-1-vfirst;
+    for ( i=reqptr[slot]; i<reqptr[slot+1]; ++i ) {
+      j = cur[reqrank[i]]++;
+      memcpy(&stri[4*j],&tri[4*k],4*sizeof(int));
+    }
+  }
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio recv buffer");
+
+  ier = PMMG_mpiio_alltoallv(parmesh,4*sizeof(int),(char*)stri,scount,&rbuf,
+                             rcount,rdispl);
+  PMMG_DEL_MEM(parmesh,stri,int,"stri");
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  tri  = (int*)rbuf;
+  ntri = rdispl[nprocs];
+
+  /** Keep the triangles that are faces of the local tetra: ball of the local
+   * vertices */
+  PMMG_CALLOC(parmesh,vptr,np+2,int,"vptr",ier = 0);
+  PMMG_MALLOC(parmesh,vtet,4*ne,int,"vtet",ier = 0);
+  if ( !ier ) goto end;
+
+  for ( k=0; k<ne; ++k ) {
+    for ( i=0; i<4; ++i ) {
+      ++vptr[tetra[5*k+i]+1];
+    }
+  }
+  for ( i=1; i<=np+1; ++i ) {
+    vptr[i] += vptr[i-1];
+  }
+  for ( k=0; k<ne; ++k ) {
+    for ( i=0; i<4; ++i ) {
+      vtet[vptr[tetra[5*k+i]]++] = k;
+    }
+  }
+  for ( i=np+1; i>0; --i ) {
+    vptr[i] = vptr[i-1];
+  }
+  vptr[0] = 0;
+
+  *nt = 0;
+  for ( k=0; k<ntri; ++k ) {
+    for ( i=0; i<3; ++i ) {
+      ip[i] = PMMG_mpiio_locId(gids,np,tri[4*k+i]);
+    }
+    if ( !ip[0] || !ip[1] || !ip[2] ) continue;
+
+    found = 0;
+    for ( j=vptr[ip[0]]; j<vptr[ip[0]+1] && found < 2; ++j ) {
+      found = 0;
+      for ( i=0; i<4; ++i ) {
+        r = tetra[5*vtet[j]+i];
+        if ( r == ip[1] || r == ip[2] ) ++found;
+      }
+    }
+    if ( found < 2 ) continue;
+
+    tri[4*(*nt)]   = ip[0];
+    tri[4*(*nt)+1] = ip[1];
+    tri[4*(*nt)+2] = ip[2];
+    tri[4*(*nt)+3] = tri[4*k+3];
+    ++(*nt);
+  }
+  *tria = tri;
+  rbuf  = NULL;
+
+end:
+  PMMG_DEL_MEM(parmesh,buf,char,"mpiio buffer");
+  PMMG_DEL_MEM(parmesh,rbuf,char,"mpiio recv buffer");
+  PMMG_DEL_MEM(parmesh,stri,int,"stri");
+  PMMG_DEL_MEM(parmesh,scount,int,"scount");
+  PMMG_DEL_MEM(parmesh,rcount,int,"rcount");
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,cur,int,"cur");
+  PMMG_DEL_MEM(parmesh,vptr,int,"vptr");
+  PMMG_DEL_MEM(parmesh,vtet,int,"vtet");
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  return ieresult;
+}
+
+int PMMG_loadMesh_mpiio(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh mesh;
+  MPI_File   fh,mfh;
+  long long  pos[PMMG_MPIIO_NSec],mpos[PMMG_MPIIO_NSec];
+  double     *vdata,*vd;
+  size_t     len;
+  char       *name,*metname,*tbuf,*ptr;
+  int        nent[PMMG_MPIIO_NSec],ment[PMMG_MPIIO_NSec],msize,mdum;
+  int        *tetra,*gids,*tria,*reqptr,*reqrank;
+  int        ier,ieresult,mier,first,ne,np,nt,vfirst,vnloc,vrec,k,i;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.\n",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  name = ( filename && *filename ) ? (char*)filename : parmesh->meshin;
+  mfh  = MPI_FILE_NULL;
+
+  /** The level-set, displacement and fields inputs need the Mmg loaders */
+  if ( parmesh->nprocs < 2 || mesh->info.iso || mesh->info.lag >= 0 ||
+       ( parmesh->fieldin && *parmesh->fieldin ) ) {
+    return -1;
+  }
+
+  /** Sections of the mesh and metric files */
+  ier = PMMG_mpiio_openRead(parmesh,name,0,&fh,pos,nent,&mdum);
+  if ( ier != 1 ) return ier;
+
+  if ( nent[PMMG_MPIIO_SecTetrahedra] < parmesh->nprocs ||
+       !nent[PMMG_MPIIO_SecVertices] ) {
+    MPI_File_close(&fh);
+    return -1;
+  }
+
+  msize = 0;
+  mier  = 0;
+  if ( parmesh->metin && *parmesh->metin ) {
+    mier = PMMG_mpiio_openRead(parmesh,parmesh->metin,1,&mfh,mpos,ment,&msize);
+
+    ptr = MMG5_Get_filenameExt(parmesh->metin);
+    if ( !mier && ptr && !strcmp(ptr,".sol") ) {
+      /* Try the binary file */
+      len     = strlen(parmesh->metin);
+      metname = NULL;
+      PMMG_MALLOC(parmesh,metname,len+2,char,"metname",MPI_File_close(&fh);return 0);
+      strcpy(metname,parmesh->metin);
+      strcat(metname,"b");
+      mier = PMMG_mpiio_openRead(parmesh,metname,1,&mfh,mpos,ment,&msize);
+      PMMG_DEL_MEM(parmesh,metname,char,"metname");
+    }
+
+    if ( mier == 1 && ment[PMMG_MPIIO_SecSol] != nent[PMMG_MPIIO_SecVertices] ) {
+      MPI_File_close(&mfh);
+      mier = -1;
+    }
+    if ( mier == -1 ) {
+      /* ASCII or unsupported metric: use the Mmg loaders */
+      MPI_File_close(&fh);
+      return -1;
+    }
+    if ( mier != 1 ) msize = 0;
+  }
+
+  if ( parmesh->info.imprim > PMMG_VERB_VERSION &&
+       parmesh->myrank == parmesh->info.root ) {
+    fprintf(stdout,"\n  %%%% %s OPENED (PARALLEL READ)\n",name);
+  }
+
+  tbuf  = NULL;
+  gids  = tria = reqptr = reqrank = NULL;
+  vdata = NULL;
+  nt    = 0;
+
+  /** Block of tetra and sorted list of their vertices */
+  ier = PMMG_mpiio_readBlock(parmesh,fh,pos[PMMG_MPIIO_SecTetrahedra],
+                             nent[PMMG_MPIIO_SecTetrahedra],5*sizeof(int),&tbuf,
+                             &first,&ne);
+  tetra = (int*)tbuf;
+
+  PMMG_MALLOC(parmesh,gids,4*ne,int,"gids",ier = 0);
+
+  np = 0;
+  if ( ier ) {
+    for ( k=0; k<ne; ++k ) {
+      for ( i=0; i<4; ++i ) {
+        gids[4*k+i] = tetra[5*k+i];
+        if ( gids[4*k+i] < 1 || gids[4*k+i] > nent[PMMG_MPIIO_SecVertices] ) {
+          fprintf(stderr,"\n  ## Error: %s: wrong vertex index %d in tetra %d.\n",
+                  __func__,gids[4*k+i],first+k+1);
+          ier = 0;
+        }
+      }
+    }
+    qsort(gids,4*ne,sizeof(int),PMMG_mpiio_compInt);
+    for ( k=0; k<4*ne; ++k ) {
+      if ( !np || gids[k] != gids[np-1] ) gids[np++] = gids[k];
+    }
+    /* Local numbering of the tetra vertices */
+    for ( k=0; k<ne; ++k ) {
+      for ( i=0; i<4; ++i ) {
+        tetra[5*k+i] = PMMG_mpiio_locId(gids,np,tetra[5*k+i]);
+      }
+    }
+  }
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  /** Vertices and node communicators */
+  ier = PMMG_mpiio_readVertices(parmesh,fh,mfh,pos,mpos,nent,msize,gids,np,
+                                &vdata,&vfirst,&vnloc,&reqptr,&reqrank);
+  if ( !ier ) goto end;
+
+  ier = PMMG_mpiio_setNodeComms(parmesh,vfirst,vnloc,reqptr,reqrank,gids,np);
+  if ( !ier ) goto end;
+
+  /** Triangles */
+  if ( nent[PMMG_MPIIO_SecTriangles] ) {
+    ier = PMMG_mpiio_readTriangles(parmesh,fh,pos,nent,vfirst,reqptr,reqrank,
+                                   gids,np,tetra,ne,&tria,&nt);
+    if ( !ier ) goto end;
+  }
+  PMMG_DEL_MEM(parmesh,reqptr,int,"reqptr");
+  PMMG_DEL_MEM(parmesh,reqrank,int,"reqrank");
+
+  /** Build the local mesh */
+  ier = PMMG_Set_meshSize(parmesh,np,ne,0,nt,0,0);
+
+  vrec = 5 + msize;
+  for ( k=0; ier && k<np; ++k ) {
+    vd  = &vdata[k*vrec];
+    ier = PMMG_Set_vertex(parmesh,vd[0],vd[1],vd[2],(int)vd[3],k+1);
+    if ( ier && ((int)vd[4] & 1) ) ier = PMMG_Set_corner(parmesh,k+1);
+    if ( ier && ((int)vd[4] & 2) ) ier = PMMG_Set_requiredVertex(parmesh,k+1);
+  }
+  for ( k=0; ier && k<ne; ++k ) {
+    ier = PMMG_Set_tetrahedron(parmesh,tetra[5*k],tetra[5*k+1],tetra[5*k+2],
+                               tetra[5*k+3],tetra[5*k+4],k+1);
+  }
+  for ( k=0; ier && k<nt; ++k ) {
+    ier = PMMG_Set_triangle(parmesh,tria[4*k],tria[4*k+1],tria[4*k+2],
+                            tria[4*k+3],k+1);
+  }
+
+  if ( ier && msize ) {
+    ier = PMMG_Set_metSize(parmesh,MMG5_Vertex,np,msize==1 ? MMG5_Scalar : MMG5_Tensor);
+    for ( k=0; ier && k<np; ++k ) {
+      vd = &vdata[k*vrec+5];
+      if ( msize == 1 ) {
+        ier = PMMG_Set_scalarMet(parmesh,vd[0],k+1);
+      }
+      else {
+        /* Medit stores the symmetric tensors as m11 m12 m22 m13 m23 m33 */
+        ier = PMMG_Set_tensorMet(parmesh,vd[0],vd[1],vd[3],vd[2],vd[4],vd[5],k+1);
+      }
+    }
+  }
+
+  /* The interfaces are given by the node communicators */
+  if ( ier ) {
+    ier = PMMG_Set_iparameter(parmesh,PMMG_IPARAM_APImode,PMMG_APIDISTRIB_nodes);
+  }
+
+end:
+  PMMG_DEL_MEM(parmesh,tbuf,char,"mpiio read buffer");
+  PMMG_DEL_MEM(parmesh,gids,int,"gids");
+  PMMG_DEL_MEM(parmesh,tria,int,"tria");
+  PMMG_DEL_MEM(parmesh,reqptr,int,"reqptr");
+  PMMG_DEL_MEM(parmesh,reqrank,int,"reqrank");
+  PMMG_DEL_MEM(parmesh,vdata,double,"vdata");
+
+  MPI_File_close(&fh);
+  if ( msize ) MPI_File_close(&mfh);
+
+  MPI_Allreduce( &ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  if ( ieresult && parmesh->info.imprim > PMMG_VERB_VERSION &&
+       parmesh->myrank == parmesh->info.root ) {
+    fprintf(stdout,"     NUMBER OF VERTICES   %8d   CORNERS    %6d   REQUIRED %6d\n",
+            nent[PMMG_MPIIO_SecVertices],nent[PMMG_MPIIO_SecCorners],
+            nent[PMMG_MPIIO_SecRequired]);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",nent[PMMG_MPIIO_SecTriangles]);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %8d\n",nent[PMMG_MPIIO_SecTetrahedra]);
+  }
+
+  return ieresult;
+}
@@ -465,6 +465,41 @@ int PMMG_mpisizeof_grp ( PMMG_pGrp grp ) {
   return idx;
 }
 
+/**
+ * \param grp pointer toward a PMMG_Grp structure.
+ * \return the size (in char) of the packed group header.
+ *
+ * \warning the mesh prisms are not treated.
+ *
+ * Compute the size of the group header, that is, of the packed group without
+ * its mesh and solutions arrays (see \a PMMG_create_MPI_grpArrays).
+ *
+ */
+int PMMG_mpisizeof_grpHeader ( PMMG_pGrp grp ) {
+  const MMG5_pMesh mesh = grp->mesh;
+
+  int idx;
+
+  /** Used or unused group */
+  idx = sizeof(int);
+
+  if ( !grp->mesh ) {
+    /* unused group */
+    return idx;
+  }
+
+  /** Size of mesh / metric / fields... arrays (np, met->siz...) */
+  idx += PMMG_mpisizeof_meshSizes ( grp );
+
+  /** Size of Info */
+  idx += PMMG_mpisizeof_infos ( &mesh->info );
+
+  /** Size of compressed internal group communicators */
+  idx += PMMG_mpisizeof_grpintcomm ( grp );
+
+  return idx;
+}
+
 /**
  * \param grp pointer toward a PMMG_Grp structure.
  * \return the size (in char) of the packed group.
@@ -1115,6 +1150,48 @@ int PMMG_mpipack_grp ( PMMG_pGrp grp,char **buffer ) {
   return ier;
 }
 
+/**
+ * \param grp pointer toward a PMMG_Grp structure.
+ * \param buffer pointer toward the buffer in which we pack the group header
+ *
+ * \return 1 if success, 0 if fail
+ *
+ * \warning the mesh prisms are not treated.
+ *
+ * Pack the group header (array sizes, infos and internal communicators) into a
+ * buffer and shift the buffer pointer at the end of the written area. Once the
+ * header is unpacked, the receiver has allocated the mesh and solutions arrays
+ * at their final size so the arrays themselves can be communicated in place
+ * through the \a PMMG_create_MPI_grpArrays data type.
+ *
+ */
+int PMMG_mpipack_grpHeader ( PMMG_pGrp grp,char **buffer ) {
+  char  *tmp;
+
+  tmp = *buffer;
+
+  if ( !grp->mesh ) {
+    /* unused group */
+    *( (int *) tmp ) = 0; tmp += sizeof(int);
+    *buffer = tmp;
+
+    return 1;
+  }
+
+  /* used group */
+  *( (int *) tmp) = 1; tmp += sizeof(int);
+
+  *buffer = tmp;
+
+  PMMG_mpipack_meshSizes(grp,buffer);
+
+  PMMG_mpipack_infos(&(grp->mesh->info),buffer);
+
+  PMMG_mpipack_grpintcomm(grp,buffer);
+
+  return 1;
+}
+
 /**
  * \param parmesh pointer toward a PMMG_ParMesh structure.
  * \param buffer pointer toward the buffer in which we pack the group
@@ -36,7 +36,9 @@
 
 int PMMG_mpisizeof_grp ( PMMG_pGrp grp );
 int PMMG_mpisizeof_parmesh ( PMMG_pParMesh parmesh );
+int PMMG_mpisizeof_grpHeader ( PMMG_pGrp grp );
 int PMMG_mpipack_grp ( PMMG_pGrp grp,char **buffer );
 int PMMG_mpipack_parmesh ( PMMG_pParMesh parmesh,char **buffer );
+int PMMG_mpipack_grpHeader ( PMMG_pGrp grp,char **buffer );
 
 #endif
@@ -144,21 +144,22 @@ int PMMG_create_MPI_Point(MPI_Datatype *mpi_point)
 int PMMG_create_MPI_xPoint(MPI_Datatype *mpi_xpoint)
 {
   MMG5_xPoint  xPoint[2];
-  int          i,blck_lengths[2] = {3,3};
-  MPI_Aint     displs[2],lb,ub;
+  int          i,blck_lengths[3] = {3,3,1};
+  MPI_Aint     displs[3],lb,ub;
   MPI_Datatype mpi_noextent;
-  MPI_Datatype types[2] = {MPI_DOUBLE,MPI_DOUBLE};
+  MPI_Datatype types[3] = {MPI_DOUBLE,MPI_DOUBLE,MPI_INT8_T};
 
   MPI_CHECK( MPI_Get_address(&(xPoint[0]),       &lb),return 0);
   MPI_CHECK( MPI_Get_address(&(xPoint[0].n1[0]), &displs[0]),return 0);
   MPI_CHECK( MPI_Get_address(&(xPoint[0].n2[0]), &displs[1]),return 0);
+  MPI_CHECK( MPI_Get_address(&(xPoint[0].nnor),  &displs[2]),return 0);
   MPI_CHECK( MPI_Get_address(&(xPoint[1]),       &ub),return 0);
 
   /* Relative displacement from field 0 to field i */
-  for ( i=1 ; i>= 0; --i )
+  for ( i=2 ; i>= 0; --i )
     displs[i] -= lb;
 
-  MPI_CHECK( MPI_Type_create_struct(2, blck_lengths, displs, types, &mpi_noextent),
+  MPI_CHECK( MPI_Type_create_struct(3, blck_lengths, displs, types, &mpi_noextent),
              return 0 );
 
   MPI_CHECK( MPI_Type_create_resized(mpi_noextent,lb,ub-lb,mpi_xpoint),return 0);
@@ -330,23 +331,24 @@ int PMMG_create_MPI_Tria(MPI_Datatype *mpi_tria)
 int PMMG_create_MPI_xTetra(MPI_Datatype *mpi_xtetra)
 {
   MMG5_xTetra  xTetra[2];
-  MPI_Aint     displs[4],lb,ub;
+  MPI_Aint     displs[5],lb,ub;
   MPI_Datatype mpi_noextent;
-  MPI_Datatype types[4] = {MPI_INT,MPI_INT,MPI_INT16_T,MPI_INT16_T};
-  int          i,blck_lengths[4] = {4,6,4,6};
+  MPI_Datatype types[5] = {MPI_INT,MPI_INT,MPI_INT16_T,MPI_INT16_T,MPI_INT8_T};
+  int          i,blck_lengths[5] = {4,6,4,6,1};
 
   MPI_CHECK( MPI_Get_address(&(xTetra[0])       ,  &lb),return 0);
   MPI_CHECK( MPI_Get_address(&(xTetra[0].ref[0]),  &displs[0]),return 0);
   MPI_CHECK( MPI_Get_address(&(xTetra[0].edg[0]),  &displs[1]),return 0);
   MPI_CHECK( MPI_Get_address(&(xTetra[0].ftag[0]), &displs[2]),return 0);
   MPI_CHECK( MPI_Get_address(&(xTetra[0].tag[0]),  &displs[3]),return 0);
+  MPI_CHECK( MPI_Get_address(&(xTetra[0].ori),     &displs[4]),return 0);
   MPI_CHECK( MPI_Get_address(&(xTetra[1])       ,  &ub),return 0);
 
  /* Relative displacement from field 0 to field i */
-  for ( i=3 ; i>= 0; --i )
+  for ( i=4 ; i>= 0; --i )
     displs[i] -= lb;
 
-  MPI_CHECK( MPI_Type_create_struct(4, blck_lengths, displs, types, &mpi_noextent),
+  MPI_CHECK( MPI_Type_create_struct(5, blck_lengths, displs, types, &mpi_noextent),
              return 0);
 
   MPI_CHECK( MPI_Type_create_resized(mpi_noextent,lb,ub-lb,mpi_xtetra),return 0);
@@ -392,3 +394,161 @@ int PMMG_Free_MPI_meshDatatype( MPI_Datatype *mpi_point,
 
   return 1;
 }
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param listgrp array of groups.
+ * \param ngrp number of groups in \a listgrp.
+ * \param color flag of the groups to describe.
+ * \param mpi_grps new MPI data type
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Create an MPI data type that describes, in place, the mesh and solution
+ * arrays (metric, ls, disp and fields) of the used groups of \a listgrp whose
+ * flag is \a color. The data type uses absolute addresses and must be
+ * communicated from \a MPI_BOTTOM with a count of 1: the arrays are sent
+ * without staging and received directly in their final storage if the sizes
+ * of the receiver arrays have been set before. The communicated fields are
+ * the ones of the \a PMMG_mpipack_grp buffer.
+ *
+ */
+int PMMG_create_MPI_grpArrays(PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int ngrp,
+                              int color,MPI_Datatype *mpi_grps)
+{
+  PMMG_pGrp    grp;
+  MMG5_pMesh   mesh;
+  MMG5_pSol    psl;
+  MPI_Datatype mpi_point,mpi_xpoint,mpi_tetra,mpi_xtetra;
+  MPI_Datatype *types;
+  MPI_Aint     *displs;
+  int          *blck_lengths;
+  int          k,is,nblck,ier;
+
+  *mpi_grps  = MPI_DATATYPE_NULL;
+  mpi_point  = MPI_DATATYPE_NULL;
+  mpi_xpoint = MPI_DATATYPE_NULL;
+  mpi_tetra  = MPI_DATATYPE_NULL;
+  mpi_xtetra = MPI_DATATYPE_NULL;
+
+  types        = NULL;
+  displs       = NULL;
+  blck_lengths = NULL;
+
+  ier = 1;
+
+  /** Count the number of contiguous blocks to communicate */
+  nblck = 0;
+  for ( k=0; k<ngrp; ++k ) {
+    grp = &listgrp[k];
+    if ( grp->flag != color || !grp->mesh ) continue;
+
+    /* point, xpoint, tetra and xtetra arrays */
+    nblck += 4;
+    if ( grp->met  && grp->met->m  ) ++nblck;
+    if ( grp->ls   && grp->ls->m   ) ++nblck;
+    if ( grp->disp && grp->disp->m ) ++nblck;
+    nblck += grp->mesh->nsols;
+  }
+
+  if ( !PMMG_create_MPI_Point(&mpi_point)   ) ier = 0;
+  if ( !PMMG_create_MPI_xPoint(&mpi_xpoint) ) ier = 0;
+  if ( !PMMG_create_MPI_Tetra(&mpi_tetra)   ) ier = 0;
+  if ( !PMMG_create_MPI_xTetra(&mpi_xtetra) ) ier = 0;
+
+  if ( ier && nblck ) {
+    PMMG_MALLOC(parmesh,types,nblck,MPI_Datatype,"grps types",ier = 0);
+    PMMG_MALLOC(parmesh,displs,nblck,MPI_Aint,"grps displs",ier = 0);
+    PMMG_MALLOC(parmesh,blck_lengths,nblck,int,"grps blck_lengths",ier = 0);
+  }
+
+  if ( ier ) {
+    /** Describe the arrays of each group from their first used entity (empty
+     * arrays are skipped, which is consistent between the sender and the
+     * receiver as both sides have the same array sizes) */
+    nblck = 0;
+    for ( k=0; k<ngrp; ++k ) {
+      grp = &listgrp[k];
+      if ( grp->flag != color || !grp->mesh ) continue;
+
+      mesh = grp->mesh;
+
+      if ( mesh->np ) {
+        types[nblck]        = mpi_point;
+        blck_lengths[nblck] = mesh->np;
+        MPI_CHECK( MPI_Get_address(&mesh->point[1],&displs[nblck++]),ier = 0 );
+      }
+
+      if ( mesh->xp ) {
+        types[nblck]        = mpi_xpoint;
+        blck_lengths[nblck] = mesh->xp;
+        MPI_CHECK( MPI_Get_address(&mesh->xpoint[1],&displs[nblck++]),ier = 0 );
+      }
+
+      if ( mesh->ne ) {
+        types[nblck]        = mpi_tetra;
+        blck_lengths[nblck] = mesh->ne;
+        MPI_CHECK( MPI_Get_address(&mesh->tetra[1],&displs[nblck++]),ier = 0 );
+      }
+
+      if ( mesh->xt ) {
+        types[nblck]        = mpi_xtetra;
+        blck_lengths[nblck] = mesh->xt;
+        MPI_CHECK( MPI_Get_address(&mesh->xtetra[1],&displs[nblck++]),ier = 0 );
+      }
+
+      psl = grp->met;
+      if ( psl && psl->m && psl->np ) {
+        types[nblck]        = MPI_DOUBLE;
+        blck_lengths[nblck] = psl->size*psl->np;
+        MPI_CHECK( MPI_Get_address(&psl->m[psl->size],&displs[nblck++]),ier = 0 );
+      }
+
+      psl = grp->ls;
+      if ( psl && psl->m && psl->np ) {
+        types[nblck]        = MPI_DOUBLE;
+        blck_lengths[nblck] = psl->size*psl->np;
+        MPI_CHECK( MPI_Get_address(&psl->m[psl->size],&displs[nblck++]),ier = 0 );
+      }
+
+      psl = grp->disp;
+      if ( psl && psl->m && psl->np ) {
+        types[nblck]        = MPI_DOUBLE;
+        blck_lengths[nblck] = psl->size*psl->np;
+        MPI_CHECK( MPI_Get_address(&psl->m[psl->size],&displs[nblck++]),ier = 0 );
+      }
+
+      for ( is=0; is<mesh->nsols; ++is ) {
+        psl = &grp->field[is];
+        if ( !psl->np ) continue;
+        types[nblck]        = MPI_DOUBLE;
+        blck_lengths[nblck] = psl->size*psl->np;
+        MPI_CHECK( MPI_Get_address(&psl->m[psl->size],&displs[nblck++]),ier = 0 );
+      }
+    }
+  }
+
+  if ( ier ) {
+    MPI_CHECK( MPI_Type_create_struct(nblck,blck_lengths,displs,types,mpi_grps),
+               ier = 0 );
+  }
+  if ( ier ) {
+    MPI_CHECK( MPI_Type_commit(mpi_grps),ier = 0 );
+  }
+
+  PMMG_DEL_MEM(parmesh,blck_lengths,int,"grps blck_lengths");
+  PMMG_DEL_MEM(parmesh,displs,MPI_Aint,"grps displs");
+  PMMG_DEL_MEM(parmesh,types,MPI_Datatype,"grps types");
+
+  if ( mpi_xtetra != MPI_DATATYPE_NULL ) MPI_Type_free(&mpi_xtetra);
+  if ( mpi_tetra  != MPI_DATATYPE_NULL ) MPI_Type_free(&mpi_tetra);
+  if ( mpi_xpoint != MPI_DATATYPE_NULL ) MPI_Type_free(&mpi_xpoint);
+  if ( mpi_point  != MPI_DATATYPE_NULL ) MPI_Type_free(&mpi_point);
+
+  if ( !ier && *mpi_grps != MPI_DATATYPE_NULL ) {
+    MPI_Type_free(mpi_grps);
+    *mpi_grps = MPI_DATATYPE_NULL;
+  }
+
+  return ier;
+}
@@ -54,4 +54,7 @@ int PMMG_create_MPI_xTetra(MPI_Datatype *mpi_xtetra);
 int PMMG_Free_MPI_meshDatatype( MPI_Datatype*,MPI_Datatype*,
                                 MPI_Datatype*,MPI_Datatype*);
 
+int PMMG_create_MPI_grpArrays(PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int ngrp,
+                              int color,MPI_Datatype *mpi_grps);
+
 #endif
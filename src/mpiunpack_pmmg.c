@@ -1096,6 +1096,56 @@ int PMMG_mpiunpack_grp ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,char *
   return ier;
 }
 
+/**
+ * \param parmesh pointer toward a parmesh structure.
+ * \param listgrp pointer toward a PMMG_Grp structure array.
+ * \param igrp index of the group to handle.
+ * \param buffer pointer toward the buffer in which we unpack the group header
+ *
+ * \return 0 if fail, 1 otherwise
+ *
+ * \warning the mesh prisms are not treated.
+ *
+ * Upack a group header (see \a PMMG_mpipack_grpHeader) and shift the pointer
+ * toward the buffer to point to the next header stored in the buffer. The mesh
+ * and solutions arrays are allocated at their final size but are not filled:
+ * they have to be received in place using the \a PMMG_create_MPI_grpArrays
+ * data type. If the function fails, the arrays can't be received in place.
+ *
+ */
+int PMMG_mpiunpack_grpHeader ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,
+                               char **buffer ) {
+  PMMG_pGrp const grp = &listgrp[igrp];
+  int        ier,ier_mesh,ier_met,ier_ls,ier_disp,ier_field;
+  int        np,npmet,npdisp,npls,xp,ne,xt;
+  int        metsize,lssize,dispsize,fieldsize[MMG5_NSOLS_MAX];
+  int        nsols,used;
+
+  ier = 1;
+
+  used = *( (int *) *buffer ); *buffer += sizeof(int);
+  if ( !used ) {
+    /* unused group */
+    return ier;
+  }
+
+  ier = PMMG_mpiunpack_meshSizes ( parmesh,listgrp,igrp,buffer,&np,&ne,&xp,&xt,
+                             &ier_mesh,&npmet,&ier_met,&metsize,
+                             &npls,&ier_ls,&lssize,&npdisp,&ier_disp,&dispsize,
+                             &nsols,&ier_field,fieldsize );
+
+  PMMG_copy_filenames ( parmesh,grp,&ier,ier_mesh,ier_ls,ier_disp,nsols,ier_field );
+
+  PMMG_mpiunpack_infos(&(grp->mesh->info),buffer,&ier,ier_mesh);
+
+  PMMG_mpiunpack_grpintcomm ( parmesh,grp,buffer,&ier);
+
+  /* The arrays must all be allocated to be received in place */
+  if ( !(ier_mesh && ier_met && ier_ls && ier_disp && ier_field) ) ier = 0;
+
+  return ier;
+}
+
 /**
  * \param parmesh pointer toward a parmesh structure.
  * \param listgrp pointer toward a PMMG_Grp structure array.
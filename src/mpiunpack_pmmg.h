@@ -36,6 +36,8 @@
 
 int PMMG_mpiunpack_grp ( PMMG_pParMesh,PMMG_pGrp,int,char **buffer);
 
+int PMMG_mpiunpack_grpHeader ( PMMG_pParMesh,PMMG_pGrp,int,char **buffer);
+
 int PMMG_mpiunpack_parmesh ( PMMG_pParMesh,PMMG_pGrp,int,PMMG_pInt_comm,int*,
                              PMMG_pExt_comm*,char** );
 
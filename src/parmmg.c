@@ -64,7 +64,7 @@ int main( int argc, char *argv[] )
   PMMG_pGrp     grp;
   int           rank;
   int           ier,iermesh,iresult,ierSave,fmtin,fmtout;
-  int8_t        tim,distributedInput;
+  int8_t        tim,distributedInput,mpiioInput;
   char          stim[32],*ptr;
 
   // Shared memory communicator: processes that are on the same node, sharing
@@ -157,13 +157,42 @@ int main( int argc, char *argv[] )
   fmtout = PMMG_Get_format(ptr,fmtin);
 
   distributedInput = 0;
+  mpiioInput       = 0;
+
+  if ( parmesh->info.restart && fmtin != PMMG_FMT_HDF5 ) {
+    if ( rank == parmesh->info.root ) {
+      fprintf(stderr,"\n  ## ERROR: RESTART NEEDS A CHECKPOINT AT HDF5 FORMAT"
+              " (.h5 FILE).\n");
+    }
+    ier = 0;
+    goto check_mesh_loading;
+  }
 
   switch ( fmtin ) {
   case ( MMG5_FMT_MeditASCII ): case ( MMG5_FMT_MeditBinary ):
 
-    // Algiane: Dirty (to be discussed, I don't have a clean solution)
-    iermesh = PMMG_loadMesh_centralized(parmesh,parmesh->meshin);
-    MPI_Bcast( &iermesh,     1, MPI_INT, parmesh->info.root, parmesh->comm );
+    iermesh = -1;
+    if ( parmesh->info.mpiioInput && fmtin == MMG5_FMT_MeditBinary ) {
+      /* Parallel read of the mesh and metric (-1 if the file content needs the
+       * centralized loader) */
+      iermesh = PMMG_loadMesh_mpiio(parmesh,parmesh->meshin);
+      if ( iermesh == 1 ) {
+        distributedInput = 1;
+        mpiioInput       = 1;
+      }
+      else if ( iermesh == -1 && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+        fprintf(stderr,"\n  ## Warning: the parallel loader doesn't handle the"
+                " content of %s (edges, ridges, single precision...).\n"
+                "               The mesh is read by the root process.\n",
+                parmesh->meshin);
+      }
+    }
+
+    if ( iermesh == -1 ) {
+      // Algiane: Dirty (to be discussed, I don't have a clean solution)
+      iermesh = PMMG_loadMesh_centralized(parmesh,parmesh->meshin);
+      MPI_Bcast( &iermesh,     1, MPI_INT, parmesh->info.root, parmesh->comm );
+    }
 
     if ( 1 != iermesh ) {
       /* try to load distributed mesh */
@@ -222,6 +251,11 @@ int main( int argc, char *argv[] )
       goto check_mesh_loading;
     }
 
+    if ( mpiioInput ) {
+      /* The metric has been read with the mesh */
+      break;
+    }
+
     if ( grp->mesh->info.lag >= 0 ) {
 
       if ( rank == parmesh->info.root ) {
@@ -326,10 +360,31 @@ int main( int argc, char *argv[] )
     break;
 
   case PMMG_FMT_HDF5:
-    ier = PMMG_loadMesh_hdf5( parmesh, parmesh->meshin );
+    if ( parmesh->info.restart ) {
+      /* Resume the adaptation from a checkpoint */
+      ier = PMMG_loadCheckpoint( parmesh, parmesh->meshin );
+    }
+    else {
+      ier = PMMG_loadMesh_hdf5( parmesh, parmesh->meshin );
+    }
     parmesh->info.fmtout = fmtout;
     distributedInput = 1;
 
+    if ( ier == 1 && parmesh->listgrp[0].field &&
+         ( (!parmesh->fieldout) || (!*parmesh->fieldout) ) ) {
+      /* Give a name to the fields loaded from the HDF5 file for non HDF5
+       * outputs */
+      char *fieldout;
+      MMG5_SAFE_MALLOC(fieldout,strlen(parmesh->meshout)+12,char,ier = 0);
+      if ( fieldout ) {
+        strcpy(fieldout,parmesh->meshout);
+        ptr = MMG5_Get_filenameExt(fieldout);
+        if ( ptr ) *ptr = '\0';
+        strcat(fieldout,"-fields.sol");
+        ier = PMMG_Set_outputSolsName(parmesh,fieldout);
+        MMG5_SAFE_FREE(fieldout);
+      }
+    }
     break;
 
   default:
@@ -487,6 +542,22 @@ check_mesh_loading:
 
       break;
 
+    case ( PMMG_FMT_MeditMPIIO ):
+      /* Collective writes: the returned values are the same on all procs */
+      ierSave = PMMG_saveMesh_mpiio(parmesh,parmesh->meshout);
+
+      if ( ierSave ) {
+        ierSave = PMMG_saveMet_mpiio(parmesh,parmesh->metout);
+      }
+      if ( ierSave ) {
+        /* Warning: if the ls has the same name than the metric (default case
+         * when no input metric in ls mode), if the ls is not deallocated, the
+         * metric file is overwritten */
+        ierSave = PMMG_saveLs_mpiio(parmesh,parmesh->lsout);
+      }
+
+      break;
+
     default:
       ierSave = PMMG_saveMesh_centralized(parmesh,parmesh->meshout);
 
@@ -72,6 +72,14 @@ extern "C" {
  */
 #define PMMG_NITER   3
 
+/**
+ * \def PMMG_NTHREADS
+ *
+ * Default number of threads used to remesh the groups of a process
+ *
+ */
+#define PMMG_NTHREADS   1
+
 /**
  * \def PMMG_IMPRIM
  *
@@ -206,6 +214,7 @@ enum PMMG_Format {
   PMMG_FMT_DistributedMeditASCII,             /*!< Distributed ASCII Medit (.mesh) */
   PMMG_FMT_DistributedMeditBinary,            /*!< Distributed Binary Medit (.meshb) */
   PMMG_FMT_HDF5,                              /*!< HDF5 format */
+  PMMG_FMT_MeditMPIIO,                        /*!< Centralized Medit written in parallel (MPI-IO) */
   PMMG_FMT_Unknown,                           /*!< Unrecognized */
 };
 
@@ -215,6 +224,18 @@ static const int PMMG_REMESHER_TARGET_MESH_SIZE = -30000000;
 /**< Subgroups target size for a fast remeshing step */
 static const int PMMG_REMESHER_NGRPS_MAX = 100;
 
+/**
+ * \def PMMG_TUNE_NBINS
+ *
+ * Number of group size bins (half octaves) used by the tuning of the target
+ * group size
+ *
+ */
+#define PMMG_TUNE_NBINS 64
+
+/**< Minimal target group size allowed by the tuning of the group size */
+static const int PMMG_TUNE_MESH_SIZE_MIN = 1000;
+
 /**< Number of metis node per mmg mesh... to test*/
 static const int PMMG_RATIO_MMG_METIS = -100;
 
@@ -227,6 +248,30 @@ static const int PMMG_REDISTR_NELEM_MIN = 6;
 /**< Allowed imbalance ratio between current and demanded groups size */
 static const double PMMG_GRPS_RATIO = 2.0;
 
+/**< Default convergence target on the fraction of edges whose length is outside
+ * [1/sqrt(2),sqrt(2)] */
+static const double PMMG_CONV_LENGTH = 0.1;
+
+/**< Default convergence target on the worst quality of the elements touching
+ * the parallel interfaces */
+static const double PMMG_CONV_QUALITY = 0.1;
+
+/**< Minimal quality of the elements of a group that is not remeshed because it
+ * already conforms to the metric */
+static const double PMMG_FREEZE_QUALITY = 0.3;
+
+/**< Default size (in kB) above which the messages are compressed when the
+ * compression is enabled without threshold */
+static const int PMMG_COMPRESS_SIZE = 256;
+
+/**< Default deflate level of the HDF5 metric and fields when the compression is
+ * enabled without level */
+static const int PMMG_H5_DEFLATE = 4;
+
+/**< Default chunk size (in number of entities) of the compressed HDF5 datasets
+ * if no chunk size is provided */
+static const int PMMG_H5_CHUNK = 65536;
+
 /**< Number of elements layers for interface displacement */
 static const int PMMG_MVIFCS_NLAYERS = 2;
 
@@ -288,6 +333,20 @@ static const int PMMG_MVIFCS_NLAYERS = 2;
   }while(0)
 
 
+/**
+ * \struct PMMG_MemCount
+ * \brief Memory counter that can be passed in place of a parmesh to the
+ * PMMG_MALLOC family of macros (only the memMax and memCur fields are used).
+ *
+ * It allows each thread of the hybrid remeshing loop to count its own
+ * allocations without touching the shared parmesh->memCur field.
+ */
+typedef struct {
+  size_t memMax; /*!< Maximum memory the counter is allowed to allocate */
+  size_t memCur; /*!< Currently allocated memory */
+} PMMG_MemCount;
+typedef PMMG_MemCount * PMMG_pMemCount;
+
 #define ERROR_AT(msg1,msg2)                                          \
   fprintf( stderr, "%s %s function: %s, file: %s, line: %d \n", \
            msg1, msg2, __func__, __FILE__, __LINE__ )
@@ -486,8 +545,6 @@ int PMMG_parmmglib1 ( PMMG_pParMesh parmesh );
 
 /* Mesh distrib */
 int PMMG_bdryUpdate( MMG5_pMesh mesh );
-int PMMG_bcast_mesh ( PMMG_pParMesh parmesh );
-int PMMG_partBcast_mesh( PMMG_pParMesh parmesh );
 int PMMG_splitPart_grps( PMMG_pParMesh,int,int,int );
 int PMMG_split_grps( PMMG_pParMesh parmesh,int grpIdOld,int ngrp,idx_t *part,int fitMesh );
 
@@ -498,12 +555,15 @@ int PMMG_distribute_grps( PMMG_pParMesh parmesh,int partitioning_mode );
 int PMMG_loadBalancing( PMMG_pParMesh parmesh,int partitioning_mode );
 int PMMG_split_n2mGrps( PMMG_pParMesh,int,int,int );
 double PMMG_computeWgt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ifac );
+double PMMG_computeCost( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt );
+int PMMG_costWeights_isUsed( PMMG_pParMesh parmesh );
 void PMMG_computeWgt_mesh( MMG5_pMesh mesh,MMG5_pSol met,int tag );
 
 /* Mesh interpolation */
 int PMMG_oldGrps_newGroup( PMMG_pParMesh parmesh,int igrp );
 int PMMG_oldGrps_fillGroup( PMMG_pParMesh parmesh,int igrp );
 int PMMG_update_oldGrps( PMMG_pParMesh parmesh );
+void PMMG_oldGrp_handOffFields( PMMG_pGrp grp,PMMG_pGrp oldGrp );
 int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int* );
 int PMMG_copyMetricsAndFields_point( MMG5_pMesh mesh, MMG5_pMesh oldMesh, MMG5_pSol met, MMG5_pSol oldMet, MMG5_pSol,MMG5_pSol, int* permNodGlob,uint8_t);
 
@@ -529,6 +589,10 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh, MPI_Comm comm );
 int PMMG_build_edgeComm( PMMG_pParMesh,MMG5_pMesh,MMG5_HGeom *hpar,MPI_Comm);
 int PMMG_build_completeExtEdgeComm( PMMG_pParMesh parmesh, MPI_Comm comm  );
 
+int PMMG_extComm_exchange( PMMG_pParMesh parmesh,PMMG_pExt_comm ext_comm,
+                           int next_comm,int nint,int ndouble,int itag,
+                           int rtag,MPI_Comm comm );
+
 int PMMG_pack_faceCommunicators(PMMG_pParMesh parmesh);
 int PMMG_pack_nodeCommunicators(PMMG_pParMesh parmesh);
 
@@ -604,6 +668,32 @@ int PMMG_copy_mmgInfo ( MMG5_Info *info, MMG5_Info *info_cpy );
 int PMMG_qualhisto( PMMG_pParMesh parmesh,int,int,MPI_Comm comm );
 int PMMG_prilen( PMMG_pParMesh parmesh,int8_t,int,MPI_Comm comm );
 int PMMG_tetraQual( PMMG_pParMesh parmesh,int8_t metRidTyp );
+int PMMG_convergenceStats( PMMG_pParMesh parmesh,int8_t metRidTyp,double *lenOut,double *qualIfc );
+int PMMG_isConform( MMG5_pMesh mesh,MMG5_pSol met,int8_t metRidTyp,double qualMin );
+
+/* Performance trace */
+int  PMMG_trace_init( PMMG_pParMesh parmesh );
+void PMMG_trace_start( PMMG_pParMesh parmesh,int phase );
+void PMMG_trace_end( PMMG_pParMesh parmesh,int phase );
+void PMMG_trace_grps( PMMG_pParMesh parmesh,int phase );
+void PMMG_trace_bytes( PMMG_pParMesh parmesh,size_t nbytes );
+int  PMMG_trace_write( PMMG_pParMesh parmesh );
+void PMMG_trace_free( PMMG_pParMesh parmesh );
+
+/* Messages compression */
+int  PMMG_compress_isUsed( PMMG_pParMesh parmesh,size_t size );
+int  PMMG_compress_buffer( PMMG_pParMesh parmesh,const char *in,size_t size,
+                           char **out,size_t *outsize );
+int  PMMG_uncompress_buffer( PMMG_pParMesh parmesh,const char *in,size_t insize,
+                             char *out,size_t size );
+int  PMMG_compress_datatype( PMMG_pParMesh parmesh,MPI_Datatype datatype,
+                             char **out,size_t *outsize );
+int  PMMG_uncompress_datatype( PMMG_pParMesh parmesh,const char *in,size_t insize,
+                               MPI_Datatype datatype );
+
+/* Parallel Medit output */
+int  PMMG_mpiio_isUsed( PMMG_pParMesh parmesh );
+int  PMMG_mpiio_hints( PMMG_pParMesh parmesh,MPI_Info *info );
 
 /* Variadic_pmmg.c */
 int PMMG_Init_parMesh_var_internal(va_list argptr,int callFromC);
@@ -614,6 +704,7 @@ const char* PMMG_Get_pmmgArgName(int typArg);
 /* Private I/Os and APIs*/
 int PMMG_loadMesh_hdf5_i(PMMG_pParMesh parmesh, int *load_entities, const char *filename);
 int PMMG_saveMesh_hdf5_i(PMMG_pParMesh parmesh, int *save_entities, const char *filename);
+int PMMG_saveCheckpoint_hdf5(PMMG_pParMesh parmesh, const char *filename);
 int PMMG_Set_defaultIOEntities_i(int io_entities[PMMG_IO_ENTITIES_size] );
 int PMMG_Set_IOEntities_i(int io_entities[PMMG_IO_ENTITIES_size], int target, int val);
 int PMMG_Get_format( char *ptr, int fmt );
@@ -0,0 +1,1158 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file partition_pmmg.c
+ * \brief Graph partitioner backends.
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * The partitionings of the mesh elements (initial distribution of a centralized
+ * mesh, split of a mesh into groups) and of the groups graph (groups
+ * redistribution) are dispatched to the backend selected by the
+ * PMMG_IPARAM_partitioner parameter. The graph backends use the graphs built by
+ * \ref PMMG_graph_meshElts2metis and \ref PMMG_graph_parmeshGrps2parmetis,
+ * the geometric backend (sfc) cuts the Hilbert curve of the barycenters.
+ *
+ */
+#include "metis_pmmg.h"
+
+/** Available partitioner backends (the first one is the default one) */
+static const PMMG_Partitioner PMMG_partitioners[] = {
+  { PMMG_LOADBALANCING_metis,"metis",
+    PMMG_part_meshElts2metis,PMMG_part_parmeshGrps2metis },
+#ifdef USE_PARMETIS
+  { PMMG_LOADBALANCING_parmetis,"parmetis",
+    PMMG_part_meshElts2metis,PMMG_part_parmeshGrps2parmetis },
+#endif
+#ifdef USE_PTSCOTCH
+  { PMMG_LOADBALANCING_ptscotch,"ptscotch",
+    PMMG_part_meshElts2scotch,PMMG_part_parmeshGrps2ptscotch },
+#endif
+  { PMMG_LOADBALANCING_sfc,"sfc",
+    PMMG_part_meshElts2sfc,PMMG_part_parmeshGrps2sfc },
+};
+
+/**
+ * \struct PMMG_sfcItem
+ *
+ * \brief Position of a graph node along the space-filling curve.
+ *
+ */
+typedef struct {
+  uint64_t key; /*!< Hilbert key of the node barycenter */
+  idx_t    idx; /*!< Index of the node */
+} PMMG_sfcItem;
+
+/**
+ * \param mode partitioner (PMMG_LOADBALANCING_metis/parmetis/ptscotch/sfc)
+ *
+ * \return the partitioner backend, NULL if the partitioner is not available.
+ *
+ */
+const PMMG_Partitioner* PMMG_partitioner_get( int mode ) {
+  size_t k;
+
+  for ( k=0; k<sizeof(PMMG_partitioners)/sizeof(PMMG_Partitioner); ++k ) {
+    if ( PMMG_partitioners[k].mode == mode ) return &PMMG_partitioners[k];
+  }
+  return NULL;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * \return the partitioner backend selected by the user (the default one if it is
+ * not available).
+ *
+ */
+static inline
+const PMMG_Partitioner* PMMG_partitioner( PMMG_pParMesh parmesh ) {
+  const PMMG_Partitioner *partitioner;
+
+  partitioner = PMMG_partitioner_get( parmesh->info.loadbalancing_mode );
+
+  return partitioner ? partitioner : &PMMG_partitioners[0];
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Partition the elements of the first mesh of the list of meshes into \a nproc
+ * parts with the selected partitioner.
+ *
+ */
+int PMMG_part_meshElts( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc ) {
+
+  return PMMG_partitioner(parmesh)->part_meshElts( parmesh,part,nproc );
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Partition the groups of all the processes into \a nproc parts with the
+ * selected partitioner (collective).
+ *
+ */
+int PMMG_part_parmeshGrps( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc ) {
+  const PMMG_Partitioner *partitioner;
+  int                    *nodeOf,nnode,ier;
+
+  nodeOf = NULL;
+
+  partitioner = PMMG_partitioner(parmesh);
+  if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+    fprintf(stdout,"               partitioner               %s\n",partitioner->name);
+  }
+
+  ier = partitioner->part_parmeshGrps( parmesh,part,nproc );
+
+  /* The parts labels are collectively known only if all the partitionings
+   * succeed */
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  /* Gather the parts that exchange the most on the same compute node */
+  if ( ier && parmesh->info.hierarchical && nproc == parmesh->nprocs ) {
+    PMMG_MALLOC(parmesh,nodeOf,nproc,int,"node of the processes",ier = 0);
+    MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+    nnode = ier ? PMMG_get_procNodes( parmesh,nodeOf ) : 0;
+    if ( !nnode ) {
+      ier = 0;
+    }
+    else if ( nnode > 1 ) {
+      ier = PMMG_map_parmeshGrps2nodes( parmesh,part,nproc,nodeOf,nnode );
+    }
+    else {
+      PMMG_DEL_MEM(parmesh,nodeOf,int,"node of the processes");
+    }
+  }
+
+  if ( ier && parmesh->info.repartItr > 0. ) {
+    ier = PMMG_remap_parmeshGrps( parmesh,part,nproc,nodeOf );
+  }
+
+  PMMG_DEL_MEM(parmesh,nodeOf,int,"node of the processes");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param nodeOf compute node of each process (to fill)
+ *
+ * \return the number of compute nodes, 0 if fail.
+ *
+ * Get the compute node of each process (collective). If \a hierarchical is
+ * greater than 1, the nodes are blocks of \a hierarchical consecutive
+ * processes, otherwise the processes that share memory are on the same node.
+ *
+ */
+int PMMG_get_procNodes( PMMG_pParMesh parmesh,int *nodeOf ) {
+  MPI_Comm comm_shm;
+  int      leader,nnode,k;
+
+  if ( parmesh->info.hierarchical > 1 ) {
+    for ( k=0; k<parmesh->nprocs; ++k ) {
+      nodeOf[k] = k/parmesh->info.hierarchical;
+    }
+    return nodeOf[parmesh->nprocs-1]+1;
+  }
+
+  /* The node leader is the lowest rank of the node */
+  leader = parmesh->myrank;
+  MPI_CHECK( MPI_Comm_split_type( parmesh->comm, MPI_COMM_TYPE_SHARED, 0,
+                                  MPI_INFO_NULL, &comm_shm ), return 0 );
+  MPI_CHECK( MPI_Allreduce( MPI_IN_PLACE, &leader, 1, MPI_INT, MPI_MIN,
+                            comm_shm ), return 0 );
+  MPI_Comm_free( &comm_shm );
+
+  MPI_CHECK( MPI_Allgather( &leader,1,MPI_INT,nodeOf,1,MPI_INT,parmesh->comm ),
+             return 0 );
+
+  /* Number the nodes in the order of their leader */
+  nnode = 0;
+  for ( k=0; k<parmesh->nprocs; ++k ) {
+    nodeOf[k] = ( nodeOf[k] == k ) ? nnode++ : nodeOf[nodeOf[k]];
+  }
+
+  return nnode;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part partition of the local groups
+ * \param nproc number of parts
+ * \param qxadj position of the neighbours of each part in \a qadj (allocated
+ * here)
+ * \param qadj neighbours of the parts (allocated here)
+ * \param qwgt number of faces shared with each neighbour (allocated here)
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Build the graph of the parts (quotient graph of the groups graph) on all the
+ * processes (collective).
+ *
+ */
+static
+int PMMG_graph_parts( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc,
+                      int **qxadj,int **qadj,double **qwgt ) {
+  real_t     *tpwgts,*ubvec;
+  idx_t      *xadj,*adjncy,*vwgt,*adjwgt,*vtxdist,adjsize;
+  idx_t      wgtflag,numflag,ncon,*partGlo;
+  double     *loc,*glo;
+  int        *counts,*displs,nloc,nglo,ngrp,igrp,j,k,p,q,iproc,ier,ieresult;
+
+  ngrp   = parmesh->ngrp;
+  xadj   = adjncy = vwgt = adjwgt = vtxdist = partGlo = NULL;
+  tpwgts = ubvec  =  NULL;
+  loc    = glo = NULL;
+  counts = displs = NULL;
+  *qxadj = *qadj = NULL;
+  *qwgt  = NULL;
+  ier    = 1;
+
+  if ( !PMMG_graph_parmeshGrps2parmetis(parmesh,&vtxdist,&xadj,&adjncy,&adjsize,
+                                        &vwgt,&adjwgt,&wgtflag,&numflag,&ncon,
+                                        nproc,&tpwgts,&ubvec) ) {
+    fprintf(stderr,"\n  ## Error: Unable to build parmetis graph.\n");
+    ier = 0;
+  }
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  /** Step 1: part of all the groups */
+  PMMG_MALLOC(parmesh,partGlo,vtxdist[nproc]+1,idx_t,"parts of the groups",ier = 0);
+  PMMG_MALLOC(parmesh,counts,nproc,int,"counts",ier = 0);
+  PMMG_MALLOC(parmesh,displs,nproc,int,"displs",ier = 0);
+  PMMG_MALLOC(parmesh,loc,3*xadj[ngrp]+1,double,"local parts edges",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( iproc=0; iproc<nproc; ++iproc ) {
+    counts[iproc] = vtxdist[iproc+1]-vtxdist[iproc];
+    displs[iproc] = vtxdist[iproc];
+  }
+  MPI_CHECK( MPI_Allgatherv(part,ngrp,MPI_INT,partGlo,counts,displs,MPI_INT,
+                            parmesh->comm), ier = 0 );
+
+  /** Step 2: local edges between different parts (each edge of the groups graph
+   * is counted from the group of lowest part) */
+  nloc = 0;
+  for ( igrp=0; ier && igrp<ngrp; ++igrp ) {
+    p = part[igrp];
+    for ( j=xadj[igrp]; j<xadj[igrp+1]; ++j ) {
+      q = partGlo[adjncy[j]];
+      if ( p >= q ) continue;
+      loc[nloc++] = (double)p;
+      loc[nloc++] = (double)q;
+      loc[nloc++] = ( adjwgt && (wgtflag & PMMG_WGTFLAG_ADJ) ) ? adjwgt[j] : 1.;
+    }
+  }
+
+  /** Step 3: gather the edges on all the processes */
+  MPI_CHECK( MPI_Allgather(&nloc,1,MPI_INT,counts,1,MPI_INT,parmesh->comm),
+             ier = 0 );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  nglo = 0;
+  for ( iproc=0; iproc<nproc; ++iproc ) {
+    displs[iproc] = nglo;
+    nglo         += counts[iproc];
+  }
+  PMMG_MALLOC(parmesh,glo,nglo+1,double,"parts edges",ier = 0);
+  PMMG_CALLOC(parmesh,*qxadj,nproc+1,int,"parts graph xadj",ier = 0);
+  PMMG_MALLOC(parmesh,*qadj,2*(nglo/3)+1,int,"parts graph adjncy",ier = 0);
+  PMMG_MALLOC(parmesh,*qwgt,2*(nglo/3)+1,double,"parts graph adjwgt",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  MPI_CHECK( MPI_Allgatherv(loc,nloc,MPI_DOUBLE,glo,counts,displs,MPI_DOUBLE,
+                            parmesh->comm), ier = 0 );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  /** Step 4: symmetric CSR graph of the parts (a pair of parts may appear
+   * several times: it doesn't matter for the mapping) */
+  for ( k=0; k<nglo; k+=3 ) {
+    ++(*qxadj)[(int)glo[k]+1];
+    ++(*qxadj)[(int)glo[k+1]+1];
+  }
+  for ( p=0; p<nproc; ++p ) {
+    (*qxadj)[p+1] += (*qxadj)[p];
+  }
+  for ( k=0; k<nglo; k+=3 ) {
+    p = (int)glo[k];
+    q = (int)glo[k+1];
+    (*qadj)[(*qxadj)[p]] = q;
+    (*qwgt)[(*qxadj)[p]++] = glo[k+2];
+    (*qadj)[(*qxadj)[q]] = p;
+    (*qwgt)[(*qxadj)[q]++] = glo[k+2];
+  }
+  for ( p=nproc; p>0; --p ) {
+    (*qxadj)[p] = (*qxadj)[p-1];
+  }
+  (*qxadj)[0] = 0;
+
+end:
+  if ( !ieresult ) {
+    PMMG_DEL_MEM(parmesh,*qwgt,double,"parts graph adjwgt");
+    PMMG_DEL_MEM(parmesh,*qadj,int,"parts graph adjncy");
+    PMMG_DEL_MEM(parmesh,*qxadj,int,"parts graph xadj");
+  }
+  PMMG_DEL_MEM(parmesh,glo,double,"parts edges");
+  PMMG_DEL_MEM(parmesh,loc,double,"local parts edges");
+  PMMG_DEL_MEM(parmesh,displs,int,"displs");
+  PMMG_DEL_MEM(parmesh,counts,int,"counts");
+  PMMG_DEL_MEM(parmesh,partGlo,idx_t,"parts of the groups");
+
+  PMMG_DEL_MEM(parmesh, adjncy, idx_t, "deallocate adjncy" );
+  PMMG_DEL_MEM(parmesh, xadj, idx_t, "deallocate xadj" );
+  PMMG_DEL_MEM(parmesh, ubvec, real_t,"parmetis ubvec");
+  PMMG_DEL_MEM(parmesh, tpwgts, real_t, "deallocate tpwgts" );
+  PMMG_DEL_MEM(parmesh, vtxdist, idx_t, "deallocate vtxdist" );
+  PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
+  PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
+
+  return ieresult;
+}
+
+/**
+ * \param nproc number of parts (and of processes)
+ * \param qxadj position of the neighbours of each part in \a qadj
+ * \param qadj neighbours of the parts
+ * \param qwgt number of faces shared with each neighbour
+ * \param nodeOf compute node of each process
+ * \param procOf process of each part (to fill)
+ * \param gain work array of size \a nproc
+ *
+ * \return the weight of the faces shared between parts of different nodes.
+ *
+ * Fill the nodes one after the other: a node starts with the first free part
+ * and then takes the free part that shares the most faces with the parts
+ * already on the node, until all its processes are used.
+ *
+ */
+static
+double PMMG_map_parts2nodes( idx_t nproc,int *qxadj,int *qadj,double *qwgt,
+                             int *nodeOf,int *procOf,double *gain ) {
+  double cut;
+  int    iproc,p,best,j;
+
+  for ( p=0; p<nproc; ++p ) {
+    procOf[p] = PMMG_UNSET;
+  }
+
+  for ( iproc=0; iproc<nproc; ++iproc ) {
+    /* Reset the gains when a new node starts */
+    if ( !iproc || nodeOf[iproc] != nodeOf[iproc-1] ) {
+      for ( p=0; p<nproc; ++p ) gain[p] = 0.;
+    }
+
+    best = PMMG_UNSET;
+    for ( p=0; p<nproc; ++p ) {
+      if ( procOf[p] != PMMG_UNSET ) continue;
+      if ( best == PMMG_UNSET || gain[p] > gain[best] ) best = p;
+    }
+    procOf[best] = iproc;
+
+    for ( j=qxadj[best]; j<qxadj[best+1]; ++j ) {
+      gain[qadj[j]] += qwgt[j];
+    }
+  }
+
+  cut = 0.;
+  for ( p=0; p<nproc; ++p ) {
+    for ( j=qxadj[p]; j<qxadj[p+1]; ++j ) {
+      if ( nodeOf[procOf[p]] != nodeOf[procOf[qadj[j]]] ) cut += qwgt[j];
+    }
+  }
+
+  return 0.5*cut;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part partition of the local groups (relabeled at the end)
+ * \param nproc number of parts
+ * \param nodeOf compute node of each process
+ * \param nnode number of compute nodes
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Relabel the parts so that the parts that share the most faces are on the
+ * same compute node (collective). The relabeling is the same on all the
+ * processes and is kept only if it reduces the faces shared between nodes.
+ *
+ * \warning the processes of a node must be consecutive (true for the usual
+ * rank placements and for the blocks of \a hierarchical processes).
+ *
+ */
+int PMMG_map_parmeshGrps2nodes( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc,
+                                int *nodeOf,int nnode ) {
+  double *qwgt,*gain,cut,cut0;
+  int    *qxadj,*qadj,*procOf,igrp,p,j,ier;
+
+  for ( p=1; p<nproc; ++p ) {
+    if ( nodeOf[p] < nodeOf[p-1] ) {
+      if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+        fprintf(stdout,"  ## Warning: %s: processes of a node are not"
+                " consecutive. Node-aware mapping skipped.\n",__func__);
+      }
+      return 1;
+    }
+  }
+
+  if ( !PMMG_graph_parts(parmesh,part,nproc,&qxadj,&qadj,&qwgt) ) return 0;
+
+  ier    = 1;
+  procOf = NULL;
+  gain   = NULL;
+  PMMG_MALLOC(parmesh,procOf,nproc,int,"process of the parts",ier = 0);
+  PMMG_MALLOC(parmesh,gain,nproc,double,"mapping gains",ier = 0);
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  if ( ier ) {
+    /* Faces shared between nodes before the mapping */
+    cut0 = 0.;
+    for ( p=0; p<nproc; ++p ) {
+      for ( j=qxadj[p]; j<qxadj[p+1]; ++j ) {
+        if ( nodeOf[p] != nodeOf[qadj[j]] ) cut0 += qwgt[j];
+      }
+    }
+    cut0 *= 0.5;
+
+    cut = PMMG_map_parts2nodes(nproc,qxadj,qadj,qwgt,nodeOf,procOf,gain);
+
+    if ( cut < cut0 ) {
+      for ( igrp=0; igrp<parmesh->ngrp; ++igrp ) {
+        part[igrp] = procOf[part[igrp]];
+      }
+    }
+    else {
+      cut = cut0;
+    }
+
+    if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+      fprintf(stdout,"               inter-node cut            %g -> %g"
+              " (%d nodes)\n",cut0,cut,nnode);
+    }
+  }
+
+  PMMG_DEL_MEM(parmesh,gain,double,"mapping gains");
+  PMMG_DEL_MEM(parmesh,procOf,int,"process of the parts");
+  PMMG_DEL_MEM(parmesh,qwgt,double,"parts graph adjwgt");
+  PMMG_DEL_MEM(parmesh,qadj,int,"parts graph adjncy");
+  PMMG_DEL_MEM(parmesh,qxadj,int,"parts graph xadj");
+
+  return ier;
+}
+
+/**
+ * \struct PMMG_remapItem
+ *
+ * \brief Overlap between a new part and a process.
+ *
+ */
+typedef struct {
+  double w;    /*!< Number of elements of the process that are in the part */
+  int    proc; /*!< Process */
+  int    part; /*!< New part */
+} PMMG_remapItem;
+
+/**
+ * \param a pointer toward a PMMG_remapItem structure.
+ * \param b pointer toward a PMMG_remapItem structure.
+ *
+ * \return -1 if a has the largest overlap, 1 if b has, 0 otherwise.
+ *
+ * Compare two overlaps (decreasing order, the process and part indices break
+ * the ties to get the same order on all the processes).
+ *
+ */
+static
+int PMMG_compare_remapItem( const void *a,const void *b ) {
+  const PMMG_remapItem *ia = (const PMMG_remapItem*)a;
+  const PMMG_remapItem *ib = (const PMMG_remapItem*)b;
+
+  if ( ia->w    != ib->w    ) return ( ia->w    > ib->w    ) ? -1 : 1;
+  if ( ia->proc != ib->proc ) return ( ia->proc > ib->proc ) ?  1 : -1;
+  if ( ia->part != ib->part ) return ( ia->part > ib->part ) ?  1 : -1;
+  return 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part partition of the local groups (relabeled at the end)
+ * \param nproc number of parts
+ * \param nodeOf compute node of each process (NULL if the parts can go to any
+ * process, otherwise the part \a k stays on the node of the process \a k)
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Relabel the parts so that each part goes to the process that already owns
+ * most of its elements (collective). Only the labels change so the edge cut
+ * and the balance of the partition are preserved, but the groups that stay on
+ * their process are not migrated.
+ *
+ * The overlaps are sorted by decreasing number of elements and greedily
+ * matched; the unmatched parts go to the remaining processes.
+ *
+ */
+int PMMG_remap_parmeshGrps( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc,
+                            int *nodeOf ) {
+  PMMG_remapItem *item;
+  MMG5_pMesh     mesh;
+  double         *w,*loc,*glo;
+  int            *counts,*displs,*perm,*used;
+  int            nloc,nglo,ngrp,igrp,iproc,k,ier,ieresult;
+
+  /* Labels can be matched with processes only if there is one part per
+   * process */
+  if ( nproc != parmesh->nprocs ) return 1;
+
+  ngrp   = parmesh->ngrp;
+  w      = loc = glo = NULL;
+  counts = displs = perm = used = NULL;
+  item   = NULL;
+  ier    = 1;
+
+  /** Step 1: number of local elements in each part */
+  PMMG_CALLOC(parmesh,w,nproc,double,"remap overlap",ier = 0);
+  PMMG_CALLOC(parmesh,counts,nproc,int,"remap counts",ier = 0);
+  PMMG_CALLOC(parmesh,displs,nproc,int,"remap displs",ier = 0);
+  PMMG_CALLOC(parmesh,perm,nproc,int,"remap permutation",ier = 0);
+  PMMG_CALLOC(parmesh,used,nproc,int,"remap used procs",ier = 0);
+
+  nloc = 0;
+  if ( ier ) {
+    for ( igrp=0; igrp<ngrp; ++igrp ) {
+      mesh = parmesh->listgrp[igrp].mesh;
+      w[part[igrp]] += ( mesh && mesh->ne ) ? mesh->ne : 1;
+    }
+    for ( iproc=0; iproc<nproc; ++iproc ) {
+      if ( w[iproc] > 0. ) ++nloc;
+    }
+    PMMG_MALLOC(parmesh,loc,2*nloc+1,double,"remap local overlaps",ier = 0);
+  }
+  if ( ier ) {
+    k = 0;
+    for ( iproc=0; iproc<nproc; ++iproc ) {
+      if ( w[iproc] > 0. ) {
+        loc[k++] = (double)iproc;
+        loc[k++] = w[iproc];
+      }
+    }
+  }
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  /** Step 2: gather the sparse overlap matrix on all the processes */
+  nloc *= 2;
+  MPI_CHECK( MPI_Allgather(&nloc,1,MPI_INT,counts,1,MPI_INT,parmesh->comm),
+             ier = 0 );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  nglo = 0;
+  for ( iproc=0; iproc<nproc; ++iproc ) {
+    displs[iproc] = nglo;
+    nglo         += counts[iproc];
+  }
+  PMMG_MALLOC(parmesh,glo,nglo+1,double,"remap overlaps",ier = 0);
+  PMMG_MALLOC(parmesh,item,nglo/2+1,PMMG_remapItem,"remap items",ier = 0);
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  MPI_CHECK( MPI_Allgatherv(loc,nloc,MPI_DOUBLE,glo,counts,displs,MPI_DOUBLE,
+                            parmesh->comm), ier = 0 );
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  for ( iproc=0; iproc<nproc; ++iproc ) {
+    for ( k=displs[iproc]; k<displs[iproc]+counts[iproc]; k+=2 ) {
+      item[k/2].part = (int)glo[k];
+      item[k/2].w    = glo[k+1];
+      item[k/2].proc = iproc;
+    }
+  }
+
+  /** Step 3: greedy matching of the largest overlaps (same result on all the
+   * processes) */
+  qsort(item,nglo/2,sizeof(PMMG_remapItem),PMMG_compare_remapItem);
+
+  for ( iproc=0; iproc<nproc; ++iproc ) {
+    perm[iproc] = PMMG_UNSET;
+  }
+  for ( k=0; k<nglo/2; ++k ) {
+    if ( perm[item[k].part] != PMMG_UNSET || used[item[k].proc] ) continue;
+    if ( nodeOf && nodeOf[item[k].part] != nodeOf[item[k].proc] ) continue;
+    perm[item[k].part]  = item[k].proc;
+    used[item[k].proc]  = 1;
+  }
+  for ( k=0; k<nproc; ++k ) {
+    if ( perm[k] != PMMG_UNSET ) continue;
+    iproc = 0;
+    while ( used[iproc] || (nodeOf && nodeOf[iproc] != nodeOf[k]) ) ++iproc;
+    perm[k]      = iproc;
+    used[iproc]  = 1;
+  }
+
+  for ( igrp=0; igrp<ngrp; ++igrp ) {
+    part[igrp] = perm[part[igrp]];
+  }
+
+end:
+  PMMG_DEL_MEM(parmesh,item,PMMG_remapItem,"remap items");
+  PMMG_DEL_MEM(parmesh,glo,double,"remap overlaps");
+  PMMG_DEL_MEM(parmesh,loc,double,"remap local overlaps");
+  PMMG_DEL_MEM(parmesh,used,int,"remap used procs");
+  PMMG_DEL_MEM(parmesh,perm,int,"remap permutation");
+  PMMG_DEL_MEM(parmesh,displs,int,"remap displs");
+  PMMG_DEL_MEM(parmesh,counts,int,"remap counts");
+  PMMG_DEL_MEM(parmesh,w,double,"remap overlap");
+
+  return ieresult;
+}
+
+/**
+ * \param a pointer toward a PMMG_sfcItem structure.
+ * \param b pointer toward a PMMG_sfcItem structure.
+ *
+ * \return 1 if a is after b along the curve, -1 if before, 0 otherwise.
+ *
+ * Compare two items along the space-filling curve (the node index breaks the
+ * ties to get the same order on all the processes).
+ *
+ */
+static
+int PMMG_compare_sfcItem( const void *a,const void *b ) {
+  const PMMG_sfcItem *ia = (const PMMG_sfcItem*)a;
+  const PMMG_sfcItem *ib = (const PMMG_sfcItem*)b;
+
+  if ( ia->key != ib->key ) return ( ia->key > ib->key ) ? 1 : -1;
+  if ( ia->idx != ib->idx ) return ( ia->idx > ib->idx ) ? 1 : -1;
+  return 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param n number of nodes
+ * \param coor barycenters of the nodes
+ * \param wgt weights of the nodes
+ * \param nproc number of partitions asked
+ * \param part pointer of an array containing the partitions (at the end)
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Sort the nodes along the Hilbert curve of their bounding box and cut the
+ * curve into \a nproc parts of same cumulated weight.
+ *
+ */
+static
+int PMMG_sfc_cut( PMMG_pParMesh parmesh,idx_t n,double *coor,double *wgt,
+                  idx_t nproc,idx_t *part ) {
+  PMMG_sfcItem *item;
+  double       min[3],max[3],scale,wtot,wcum;
+  uint32_t     x[3];
+  idx_t        k,ip;
+  int          i;
+
+  if ( !n ) return 1;
+
+  for ( i=0; i<3; ++i ) {
+    min[i] = coor[i];
+    max[i] = coor[i];
+  }
+  wtot = 0.;
+  for ( k=0; k<n; ++k ) {
+    for ( i=0; i<3; ++i ) {
+      min[i] = MG_MIN(min[i],coor[3*k+i]);
+      max[i] = MG_MAX(max[i],coor[3*k+i]);
+    }
+    wtot += wgt[k];
+  }
+
+  /* Same scale in each direction to keep the locality of the curve */
+  scale = MG_MAX(max[0]-min[0],MG_MAX(max[1]-min[1],max[2]-min[2]));
+  scale = ( scale > 0. ) ? ((double)((1u<<PMMG_SFC_NBITS)-1))/scale : 0.;
+
+  PMMG_MALLOC(parmesh,item,n,PMMG_sfcItem,"sfc items",return 0);
+
+  for ( k=0; k<n; ++k ) {
+    for ( i=0; i<3; ++i ) {
+      x[i] = (uint32_t)(scale*(coor[3*k+i]-min[i]));
+    }
+    item[k].key = PMMG_locate_hilbertKey(x);
+    item[k].idx = k;
+  }
+
+  qsort(item,n,sizeof(PMMG_sfcItem),PMMG_compare_sfcItem);
+
+  /* Each node goes to the part that contains the middle of its weight */
+  wcum = 0.;
+  for ( k=0; k<n; ++k ) {
+    ip = (idx_t)(nproc*(wcum+0.5*wgt[item[k].idx])/wtot);
+    part[item[k].idx] = MG_MIN(ip,nproc-1);
+    wcum += wgt[item[k].idx];
+  }
+
+  PMMG_DEL_MEM(parmesh,item,PMMG_sfcItem,"sfc items");
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure
+ * \param met pointer toward the metric structure
+ * \param k index of the tetrahedron
+ * \param costWeights 1 if the predicted remeshing cost is the element weight
+ * \param c barycenter of the element (to fill)
+ *
+ * \return the weight of the element.
+ *
+ */
+static inline
+double PMMG_sfc_elt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int costWeights,
+                     double c[3] ) {
+  MMG5_pTetra pt = &mesh->tetra[k];
+  double      *p;
+  int         i,j;
+
+  c[0] = c[1] = c[2] = 0.;
+  for ( j=0; j<4; ++j ) {
+    p = mesh->point[pt->v[j]].c;
+    for ( i=0; i<3; ++i ) c[i] += 0.25*p[i];
+  }
+
+  return costWeights ? PMMG_computeCost(mesh,met,pt) : 1.;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Partition the elements of the first mesh in the list of meshes into nproc
+ * groups by cutting the Hilbert curve of the element barycenters.
+ *
+ */
+int PMMG_part_meshElts2sfc( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc ) {
+  MMG5_pMesh mesh = parmesh->listgrp[0].mesh;
+  MMG5_pSol  met  = parmesh->listgrp[0].met;
+  double     *coor,*wgt;
+  idx_t      nelt = mesh->ne;
+  MMG5_int   k;
+  int        costWeights,ier;
+
+  if ( !nelt ) return 1;
+
+  PMMG_MALLOC(parmesh,coor,3*nelt,double,"sfc coordinates",return 0);
+  PMMG_MALLOC(parmesh,wgt,nelt,double,"sfc weights",
+              PMMG_DEL_MEM(parmesh,coor,double,"sfc coordinates");return 0);
+
+  costWeights = PMMG_costWeights_isUsed(parmesh);
+  for ( k=1; k<=mesh->ne; ++k ) {
+    wgt[k-1] = PMMG_sfc_elt(mesh,met,k,costWeights,&coor[3*(k-1)]);
+  }
+
+  ier = PMMG_sfc_cut(parmesh,nelt,coor,wgt,nproc,part);
+
+  PMMG_DEL_MEM(parmesh,wgt,double,"sfc weights");
+  PMMG_DEL_MEM(parmesh,coor,double,"sfc coordinates");
+
+  /** Correct partitioning to avoid empty partitions */
+  if ( ier && !PMMG_correct_meshElts2metis( parmesh,part,nelt,nproc ) ) ier = 0;
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Partition the groups of all the processes into nproc parts by cutting the
+ * Hilbert curve of the group barycenters (collective). The groups are few
+ * compared to the elements, so the group barycenters and weights are gathered
+ * on all the processes and each process sorts the whole curve: no graph is
+ * built and the face communicators are not used.
+ *
+ */
+int PMMG_part_parmeshGrps2sfc( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc ) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  double     *coor,*wgt,*coorGlo,*wgtGlo,c[3],w;
+  idx_t      *vtxdist,*partGlo,ngrpGlo;
+  int        *counts,*displs;
+  MMG5_int   k;
+  int        ngrp,igrp,iproc,i,costWeights,ier,ieresult;
+
+  ngrp    = parmesh->ngrp;
+  coor    = wgt = coorGlo = wgtGlo = NULL;
+  vtxdist = partGlo = NULL;
+  counts  = displs = NULL;
+  ier     = 1;
+
+  /** Step 1: barycenter and weight of the local groups */
+  PMMG_CALLOC(parmesh,coor,3*ngrp+1,double,"sfc coordinates",ier = 0);
+  PMMG_CALLOC(parmesh,wgt,ngrp+1,double,"sfc weights",ier = 0);
+  PMMG_CALLOC(parmesh,vtxdist,nproc+1,idx_t,"sfc vtxdist",ier = 0);
+  PMMG_CALLOC(parmesh,counts,nproc,int,"sfc counts",ier = 0);
+  PMMG_CALLOC(parmesh,displs,nproc,int,"sfc displs",ier = 0);
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) goto end;
+
+  costWeights = PMMG_costWeights_isUsed(parmesh);
+  for ( igrp=0; igrp<ngrp; ++igrp ) {
+    mesh = parmesh->listgrp[igrp].mesh;
+    met  = parmesh->listgrp[igrp].met;
+
+    if ( mesh ) {
+      for ( k=1; k<=mesh->ne; ++k ) {
+        if ( !MG_EOK(&mesh->tetra[k]) ) continue;
+        w = PMMG_sfc_elt(mesh,met,k,costWeights,c);
+        for ( i=0; i<3; ++i ) coor[3*igrp+i] += w*c[i];
+        wgt[igrp] += w;
+      }
+      if ( wgt[igrp] > 0. ) {
+        for ( i=0; i<3; ++i ) coor[3*igrp+i] /= wgt[igrp];
+      }
+    }
+    /* An empty group still has to be placed */
+    wgt[igrp] = MG_MAX(wgt[igrp],1.);
+  }
+
+  /** Step 2: gather the curve on all the processes */
+  MPI_CHECK( MPI_Allgather(&ngrp,1,MPI_INT,&vtxdist[1],1,MPI_INT,parmesh->comm),
+             ier = 0 );
+  for ( iproc=0; iproc<nproc; ++iproc ) {
+    vtxdist[iproc+1] += vtxdist[iproc];
+  }
+  ngrpGlo = vtxdist[nproc];
+
+  PMMG_MALLOC(parmesh,coorGlo,3*ngrpGlo+1,double,"sfc coordinates",ier = 0);
+  PMMG_MALLOC(parmesh,wgtGlo,ngrpGlo+1,double,"sfc weights",ier = 0);
+  PMMG_MALLOC(parmesh,partGlo,ngrpGlo+1,idx_t,"sfc partition",ier = 0);
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  if ( ieresult ) {
+    for ( iproc=0; iproc<nproc; ++iproc ) {
+      counts[iproc] = 3*(vtxdist[iproc+1]-vtxdist[iproc]);
+      displs[iproc] = 3*vtxdist[iproc];
+    }
+    MPI_CHECK( MPI_Allgatherv(coor,3*ngrp,MPI_DOUBLE,coorGlo,counts,displs,
+                              MPI_DOUBLE,parmesh->comm), ier = 0 );
+    for ( iproc=0; iproc<nproc; ++iproc ) {
+      counts[iproc] /= 3;
+      displs[iproc] /= 3;
+    }
+    MPI_CHECK( MPI_Allgatherv(wgt,ngrp,MPI_DOUBLE,wgtGlo,counts,displs,
+                              MPI_DOUBLE,parmesh->comm), ier = 0 );
+
+    /** Step 3: cut the curve (same result on all the processes) */
+    if ( ier ) {
+      ier = PMMG_sfc_cut(parmesh,ngrpGlo,coorGlo,wgtGlo,nproc,partGlo);
+    }
+    if ( ier ) {
+      for ( igrp=0; igrp<ngrp; ++igrp ) {
+        part[igrp] = partGlo[vtxdist[parmesh->myrank]+igrp];
+      }
+    }
+    MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  }
+
+  /** Correct partitioning to avoid empty procs */
+  if ( ieresult && !PMMG_correct_parmeshGrps2parmetis(parmesh,vtxdist,part,nproc) ) {
+    ier = 0;
+  }
+
+end:
+  PMMG_DEL_MEM(parmesh,partGlo,idx_t,"sfc partition");
+  PMMG_DEL_MEM(parmesh,wgtGlo,double,"sfc weights");
+  PMMG_DEL_MEM(parmesh,coorGlo,double,"sfc coordinates");
+  PMMG_DEL_MEM(parmesh,displs,int,"sfc displs");
+  PMMG_DEL_MEM(parmesh,counts,int,"sfc counts");
+  PMMG_DEL_MEM(parmesh,vtxdist,idx_t,"sfc vtxdist");
+  PMMG_DEL_MEM(parmesh,wgt,double,"sfc weights");
+  PMMG_DEL_MEM(parmesh,coor,double,"sfc coordinates");
+
+  return ier && ieresult;
+}
+
+#ifdef USE_PTSCOTCH
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param tab array to convert (may be NULL)
+ * \param n size of the array
+ * \param scotchTab pointer toward the converted array (allocated here, NULL if
+ * \a tab is NULL)
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Copy a metis array into a Scotch one: the integer types of the two libraries
+ * may differ.
+ *
+ */
+static
+int PMMG_idx2scotch( PMMG_pParMesh parmesh,idx_t *tab,idx_t n,
+                     SCOTCH_Num **scotchTab ) {
+  idx_t k;
+
+  *scotchTab = NULL;
+  if ( !tab ) return 1;
+
+  PMMG_MALLOC(parmesh,*scotchTab,n,SCOTCH_Num,"scotch array",return 0);
+  for ( k=0; k<n; ++k ) {
+    (*scotchTab)[k] = (SCOTCH_Num)tab[k];
+  }
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Use Scotch to partition the first mesh in the list of meshes into nproc
+ * groups
+ *
+ */
+int PMMG_part_meshElts2scotch( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc ) {
+  MMG5_pMesh   mesh = parmesh->listgrp[0].mesh;
+  MMG5_pSol    met  = parmesh->listgrp[0].met;
+  SCOTCH_Graph graph;
+  SCOTCH_Strat strat;
+  SCOTCH_Num   *verttab,*edgetab,*velotab,*edlotab,*parttab;
+  idx_t        *xadj,*adjncy,*vwgt,*adjwgt;
+  idx_t        adjsize,k;
+  idx_t        nelt = mesh->ne;
+  int          ier;
+
+  xadj = adjncy = vwgt = adjwgt = NULL;
+  verttab = edgetab = velotab = edlotab = parttab = NULL;
+
+  if (!nelt) return 1;
+
+  /** Build the graph */
+  if ( !PMMG_graph_meshElts2metis(parmesh,mesh,met,&xadj,&adjncy,&vwgt,&adjwgt,
+                                  &adjsize) )
+    return 0;
+
+  ier = PMMG_idx2scotch(parmesh,xadj,nelt+1,&verttab)          &&
+    PMMG_idx2scotch(parmesh,adjncy,xadj[nelt],&edgetab)         &&
+    PMMG_idx2scotch(parmesh,vwgt,nelt,&velotab)                 &&
+    PMMG_idx2scotch(parmesh,adjwgt,xadj[nelt],&edlotab);
+
+  if ( ier ) {
+    PMMG_MALLOC(parmesh,parttab,nelt,SCOTCH_Num,"scotch partition",ier = 0);
+  }
+
+  /** Call scotch and get the partition array */
+  if ( ier ) {
+    SCOTCH_graphInit(&graph);
+    SCOTCH_stratInit(&strat);
+
+    if ( SCOTCH_graphBuild(&graph,0,nelt,verttab,NULL,velotab,NULL,
+                           xadj[nelt],edgetab,edlotab) ) {
+      fprintf(stderr,"\n  ## Error: %s: unable to build the scotch graph.\n",
+              __func__);
+      ier = 0;
+    }
+    else if ( SCOTCH_stratGraphMapBuild(&strat,SCOTCH_STRATDEFAULT,nproc,
+                                        PMMG_UBVEC_DEF-1.) ||
+              SCOTCH_graphPart(&graph,nproc,&strat,parttab) ) {
+      fprintf(stderr,"\n  ## Error: %s: scotch partitioning fails.\n",
+              __func__);
+      ier = 0;
+    }
+
+    SCOTCH_stratExit(&strat);
+    SCOTCH_graphExit(&graph);
+  }
+
+  if ( ier ) {
+    for ( k=0; k<nelt; ++k ) {
+      part[k] = (idx_t)parttab[k];
+    }
+
+    /** Correct partitioning to avoid empty partitions */
+    if( !PMMG_correct_meshElts2metis( parmesh,part,nelt,nproc ) ) ier = 0;
+  }
+
+  PMMG_DEL_MEM(parmesh, parttab, SCOTCH_Num, "scotch partition" );
+  PMMG_DEL_MEM(parmesh, edlotab, SCOTCH_Num, "scotch array" );
+  PMMG_DEL_MEM(parmesh, velotab, SCOTCH_Num, "scotch array" );
+  PMMG_DEL_MEM(parmesh, edgetab, SCOTCH_Num, "scotch array" );
+  PMMG_DEL_MEM(parmesh, verttab, SCOTCH_Num, "scotch array" );
+
+  PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
+  PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
+  PMMG_DEL_MEM(parmesh, adjncy, idx_t, "deallocate adjncy" );
+  PMMG_DEL_MEM(parmesh, xadj, idx_t, "deallocate xadj" );
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Use PT-Scotch to partition the distributed graph of the groups into nproc
+ * parts (collective).
+ *
+ */
+int PMMG_part_parmeshGrps2ptscotch( PMMG_pParMesh parmesh,idx_t *part,idx_t nproc ) {
+  SCOTCH_Dgraph dgraph;
+  SCOTCH_Strat  strat;
+  SCOTCH_Num    *vertloctab,*edgeloctab,*veloloctab,*edloloctab,*partloctab;
+  real_t        *tpwgts,*ubvec;
+  idx_t         *xadj,*adjncy,*vwgt,*adjwgt,*vtxdist,adjsize;
+  idx_t         wgtflag,numflag,ncon,nvtx,k;
+  int           ier,ieresult;
+
+  ier = 1;
+
+  /** Build the parmetis graph */
+  xadj   = adjncy = vwgt = adjwgt = vtxdist = NULL;
+  tpwgts = ubvec  =  NULL;
+  vertloctab = edgeloctab = veloloctab = edloloctab = partloctab = NULL;
+
+  if ( !PMMG_graph_parmeshGrps2parmetis(parmesh,&vtxdist,&xadj,&adjncy,&adjsize,
+                                        &vwgt,&adjwgt,&wgtflag,&numflag,&ncon,
+                                        nproc,&tpwgts,&ubvec) ) {
+    fprintf(stderr,"\n  ## Error: Unable to build parmetis graph.\n");
+    return 0;
+  }
+  nvtx = vtxdist[parmesh->myrank+1] - vtxdist[parmesh->myrank];
+
+  /** Convert the graph (weights are used only if the builder asks for them) */
+  ier = PMMG_idx2scotch(parmesh,xadj,nvtx+1,&vertloctab) &&
+    PMMG_idx2scotch(parmesh,adjncy,xadj[nvtx],&edgeloctab);
+
+  if ( ier && (wgtflag == PMMG_WGTFLAG_VTX || wgtflag == PMMG_WGTFLAG_BOTH) ) {
+    ier = PMMG_idx2scotch(parmesh,vwgt,nvtx,&veloloctab);
+  }
+  if ( ier && (wgtflag == PMMG_WGTFLAG_ADJ || wgtflag == PMMG_WGTFLAG_BOTH) ) {
+    ier = PMMG_idx2scotch(parmesh,adjwgt,xadj[nvtx],&edloloctab);
+  }
+  if ( ier && nvtx ) {
+    PMMG_MALLOC(parmesh,partloctab,nvtx,SCOTCH_Num,"scotch partition",ier = 0);
+  }
+
+  /* The partitioning is collective */
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  /** Call PT-Scotch and get the partition array */
+  if ( ieresult ) {
+    SCOTCH_dgraphInit(&dgraph,parmesh->comm);
+    SCOTCH_stratInit(&strat);
+
+    if ( SCOTCH_dgraphBuild(&dgraph,numflag,nvtx,nvtx,vertloctab,NULL,
+                            veloloctab,NULL,xadj[nvtx],xadj[nvtx],edgeloctab,
+                            NULL,edloloctab) ) {
+      fprintf(stderr,"\n  ## Error: %s: unable to build the PT-Scotch graph.\n",
+              __func__);
+      ier = 0;
+    }
+    MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+    if ( ieresult ) {
+      if ( SCOTCH_stratDgraphMapBuild(&strat,SCOTCH_STRATDEFAULT,nproc,nproc,
+                                      PMMG_UBVEC_DEF-1.) ||
+           SCOTCH_dgraphPart(&dgraph,nproc,&strat,partloctab) ) {
+        fprintf(stderr,"\n  ## Error: PT-Scotch fails.\n" );
+        ier = 0;
+      }
+    }
+
+    SCOTCH_stratExit(&strat);
+    SCOTCH_dgraphExit(&dgraph);
+  }
+  else {
+    ier = 0;
+  }
+
+  if ( ier ) {
+    for ( k=0; k<nvtx; ++k ) {
+      part[k] = (idx_t)partloctab[k];
+    }
+  }
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  /** Correct partitioning to avoid empty procs */
+  if( ieresult && !PMMG_correct_parmeshGrps2parmetis(parmesh,vtxdist,part,nproc) ) {
+    ier = 0;
+  }
+
+  PMMG_DEL_MEM(parmesh, partloctab, SCOTCH_Num, "scotch partition" );
+  PMMG_DEL_MEM(parmesh, edloloctab, SCOTCH_Num, "scotch array" );
+  PMMG_DEL_MEM(parmesh, veloloctab, SCOTCH_Num, "scotch array" );
+  PMMG_DEL_MEM(parmesh, edgeloctab, SCOTCH_Num, "scotch array" );
+  PMMG_DEL_MEM(parmesh, vertloctab, SCOTCH_Num, "scotch array" );
+
+  PMMG_DEL_MEM(parmesh, adjncy, idx_t, "deallocate adjncy" );
+  PMMG_DEL_MEM(parmesh, xadj, idx_t, "deallocate xadj" );
+  PMMG_DEL_MEM(parmesh, ubvec, real_t,"parmetis ubvec");
+  PMMG_DEL_MEM(parmesh, tpwgts, real_t, "deallocate tpwgts" );
+  PMMG_DEL_MEM(parmesh, vtxdist, idx_t, "deallocate vtxdist" );
+  switch (wgtflag) {
+    case PMMG_WGTFLAG_ADJ:
+      PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
+      break;
+    case PMMG_WGTFLAG_VTX:
+      PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
+      break;
+    case PMMG_WGTFLAG_BOTH:
+      PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
+      PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
+      break;
+    default:
+      break;
+  }
+
+  return ier && ieresult;
+}
+#endif
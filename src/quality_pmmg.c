@@ -778,3 +778,174 @@ int PMMG_tetraQual( PMMG_pParMesh parmesh,int8_t metRidTyp ) {
 
   return 1;
 }
+
+/**
+ * \param parmesh pointer to parmesh structure
+ * \param metRidTyp Type of storage of ridges metrics: 0 for classic storage,
+ * \param lenOut fraction of edges whose length is outside [1/sqrt(2),sqrt(2)]
+ * \param qualIfc worst quality of the elements touching a parallel interface
+ *
+ * \return 1 if success, 2 if the statistics are not available (no metric on
+ * at least one process), 0 if fail.
+ *
+ * Compute the global statistics used to decide if the adaptation has
+ * converged. Unlike \ref PMMG_prilen, this function can be called on the
+ * groups of the adaptation loop: it doesn't need edge communicators, so edges
+ * shared by several groups or processes are counted several times. The
+ * quality of the elements has to be up to date (\ref PMMG_tetraQual).
+ *
+ * \remark collective on the parmesh communicator.
+ *
+ */
+int PMMG_convergenceStats( PMMG_pParMesh parmesh,int8_t metRidTyp,
+                           double *lenOut,double *qualIfc ) {
+  MMG5_pMesh  mesh;
+  MMG5_pSol   met;
+  MMG5_pTetra pt;
+  MMG5_Hash   hash;
+  double      len,qual,qual_result;
+  int64_t     ned[2],ned_result[2];
+  int         flag[2],flag_result[2];
+  int         igrp,k,ia,i,np,nq,ier;
+
+  ier    = 1;
+  ned[0] = ned[1] = 0;
+  qual   = DBL_MAX;
+
+  for ( igrp=0; igrp<parmesh->ngrp; ++igrp ) {
+    mesh = parmesh->listgrp[igrp].mesh;
+    met  = parmesh->listgrp[igrp].met;
+    if ( !mesh || !mesh->ne ) continue;
+
+    if ( !met || !met->m ) {
+      /* edge lengths can't be computed without metric */
+      ier = 2;
+      break;
+    }
+
+    /* Worst quality of the elements touching the interfaces */
+    for ( k=1; k<=mesh->ne; ++k ) {
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) ) continue;
+
+      for ( i=0; i<4; ++i ) {
+        if ( mesh->point[pt->v[i]].tag & MG_PARBDY ) break;
+      }
+      if ( i==4 ) continue;
+
+      if ( MMG3D_ALPHAD * pt->qual < qual ) qual = MMG3D_ALPHAD * pt->qual;
+    }
+
+    /* Edges whose length is outside [1/sqrt(2),sqrt(2)] */
+    if ( !MMG5_hashNew(mesh,&hash,mesh->np,7*mesh->np) ) {
+      ier = 0;
+      break;
+    }
+
+    for ( k=1; k<=mesh->ne; ++k ) {
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) ) continue;
+
+      for ( ia=0; ia<6; ++ia ) {
+        np = pt->v[MMG5_iare[ia][0]];
+        nq = pt->v[MMG5_iare[ia][1]];
+        if ( !MMG5_hashEdge(mesh,&hash,np,nq,0) ) {
+          fprintf(stderr,"  ## Error: %s: function MMG5_hashEdge return 0\n",
+                  __func__);
+          ier = 0;
+          break;
+        }
+      }
+      if ( !ier ) break;
+    }
+
+    for ( k=1; ier && k<=mesh->ne; ++k ) {
+      pt = &mesh->tetra[k];
+      if ( !MG_EOK(pt) ) continue;
+
+      for ( ia=0; ia<6; ++ia ) {
+        np = pt->v[MMG5_iare[ia][0]];
+        nq = pt->v[MMG5_iare[ia][1]];
+
+        /* Remove edge from hash to analyze it only once */
+        if ( !MMG5_hashPop(&hash,np,nq) ) continue;
+
+        if ( (!metRidTyp) && met->size==6 ) {
+          len = MMG5_lenedg33_ani(mesh,met,ia,pt);
+        }
+        else {
+          len = MMG5_lenedg(mesh,met,ia,pt);
+        }
+        if ( !len ) continue;
+
+        ++ned[0];
+        if ( len < 0.7071 || len > 1.4142 ) ++ned[1];
+      }
+    }
+    MMG5_DEL_MEM(mesh,hash.item);
+
+    if ( !ier ) break;
+  }
+
+  /* Failure on a process or metric missing on a process */
+  flag[0] = ( ier == 0 );
+  flag[1] = ( ier == 2 );
+  MPI_CHECK( MPI_Allreduce( flag, flag_result, 2, MPI_INT, MPI_MAX, parmesh->comm ),
+             return 0 );
+  if ( flag_result[0] ) return 0;
+  if ( flag_result[1] ) return 2;
+
+  MPI_CHECK( MPI_Allreduce( ned, ned_result, 2, MPI_INT64_T, MPI_SUM, parmesh->comm ),
+             return 0 );
+  MPI_CHECK( MPI_Allreduce( &qual, &qual_result, 1, MPI_DOUBLE, MPI_MIN, parmesh->comm ),
+             return 0 );
+
+  *lenOut  = ned_result[0] ? (double)ned_result[1] / (double)ned_result[0] : 0.;
+
+  /* no interface (one process and one group): nothing to wait for */
+  *qualIfc = ( qual_result < DBL_MAX ) ? qual_result : 1.;
+
+  return 1;
+}
+
+/**
+ * \param mesh pointer to the mesh structure of a group
+ * \param met pointer to the metric structure of the group
+ * \param metRidTyp Type of storage of ridges metrics: 0 for classic storage,
+ * \param qualMin minimal quality of the elements
+ *
+ * \return 1 if the mesh conforms to the metric, 0 otherwise.
+ *
+ * Check if all the edges of the mesh have a length inside
+ * [1/sqrt(2),sqrt(2)] and if all its elements have a quality greater than \a
+ * qualMin. The sweep stops at the first bad entity and no edge hashing is
+ * needed (edges are checked once per element) so it is cheap compared to a
+ * remeshing. The quality field of the elements is not updated.
+ *
+ */
+int PMMG_isConform( MMG5_pMesh mesh,MMG5_pSol met,int8_t metRidTyp,double qualMin ) {
+  MMG5_pTetra pt;
+  double      len;
+  int         k,ia;
+
+  if ( !mesh->ne || !met || !met->m ) return 0;
+
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    if ( MMG3D_ALPHAD * MMG5_caltet(mesh,met,pt) < qualMin ) return 0;
+
+    for ( ia=0; ia<6; ++ia ) {
+      if ( (!metRidTyp) && met->size==6 ) {
+        len = MMG5_lenedg33_ani(mesh,met,ia,pt);
+      }
+      else {
+        len = MMG5_lenedg(mesh,met,ia,pt);
+      }
+      if ( len < 0.7071 || len > 1.4142 ) return 0;
+    }
+  }
+
+  return 1;
+}
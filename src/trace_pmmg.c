@@ -0,0 +1,479 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file trace_pmmg.c
+ * \brief Per-phase performance trace of the processes.
+ * \version 1
+ * \copyright GNU Lesser General Public License.
+ *
+ * Each process records the wall time, the memory use, the mesh sizes and the
+ * amount of sent data of the main steps of the remeshing loop. The records of
+ * all the processes are gathered on the root process at the end of the run and
+ * written either as JSON lines or as a Chrome trace (that can be loaded in
+ * chrome://tracing or Perfetto).
+ *
+ */
+#include "parmmg.h"
+
+/** Names of the traced phases (see \ref PMMG_TRACE_phases) */
+static const char *PMMG_TRACE_names[PMMG_TRACE_PHASES_size] = {
+  "grpsplit",
+  "remesh",
+  "interp",
+  "loadbalancing",
+  "split_metis",
+  "distribute",
+  "split_mmg",
+  "analys",
+  "packing",
+  "merging",
+  "checkpoint"
+};
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * \return memory used by the parmesh and by the meshes of its groups.
+ *
+ */
+static inline
+size_t PMMG_trace_memCur( PMMG_pParMesh parmesh ) {
+  size_t memCur;
+  int    k;
+
+  memCur = parmesh->memCur;
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    if ( parmesh->listgrp[k].mesh ) {
+      memCur += parmesh->listgrp[k].mesh->memCur;
+    }
+  }
+  return memCur;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param memCur memory currently used
+ *
+ * Update the highest memory use sampled during the running phases. The memory
+ * is only sampled at the phase boundaries, so this is not a true high-water
+ * mark.
+ *
+ */
+static inline
+void PMMG_trace_sample( PMMG_pParMesh parmesh,size_t memCur ) {
+  PMMG_Trace *trace = &parmesh->trace;
+  int        k;
+
+  for ( k=0; k<PMMG_TRACE_PHASES_size; ++k ) {
+    if ( trace->open[k] && memCur > trace->memSampled[k] ) {
+      trace->memSampled[k] = memCur;
+    }
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * \return pointer toward a new event of the trace, NULL if we fail to allocate
+ * it (the event is dropped).
+ *
+ */
+static
+PMMG_pTrace_event PMMG_trace_newEvent( PMMG_pParMesh parmesh ) {
+  PMMG_Trace *trace = &parmesh->trace;
+  int        nmax;
+
+  if ( trace->nevent == trace->nevent_max ) {
+    nmax = MG_MAX ( 64,(int)((1.+PMMG_GAP)*trace->nevent_max) );
+    PMMG_REALLOC(parmesh,trace->event,nmax,trace->nevent_max,PMMG_Trace_event,
+                 "trace events",
+                 if ( !trace->event ) trace->nevent = trace->nevent_max = 0;
+                 return NULL);
+    trace->nevent_max = nmax;
+  }
+  return &trace->event[trace->nevent++];
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Reset the trace and synchronize its time origin between the processes
+ * (collective if the trace is enabled).
+ *
+ */
+int PMMG_trace_init( PMMG_pParMesh parmesh ) {
+  PMMG_Trace *trace = &parmesh->trace;
+  int        k;
+
+  if ( parmesh->info.trace == PMMG_TRACE_none ) return 1;
+
+  trace->nevent = 0;
+  trace->nbytes = 0;
+  for ( k=0; k<PMMG_TRACE_PHASES_size; ++k ) {
+    trace->open[k] = 0;
+  }
+
+  MPI_CHECK( MPI_Barrier(parmesh->comm), return 0 );
+  trace->t0 = MPI_Wtime();
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param phase traced phase (see \ref PMMG_TRACE_phases)
+ *
+ * Start the recording of a phase.
+ *
+ */
+void PMMG_trace_start( PMMG_pParMesh parmesh,int phase ) {
+  PMMG_Trace *trace = &parmesh->trace;
+  size_t     memCur;
+
+  if ( parmesh->info.trace == PMMG_TRACE_none ) return;
+
+  assert ( 0 <= phase && phase < PMMG_TRACE_PHASES_size );
+
+  memCur = PMMG_trace_memCur(parmesh);
+  PMMG_trace_sample(parmesh,memCur);
+
+  trace->open[phase]       = 1;
+  trace->tstart[phase]     = MPI_Wtime() - trace->t0;
+  trace->nbytes0[phase]    = trace->nbytes;
+  trace->memSampled[phase] = memCur;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param phase traced phase (see \ref PMMG_TRACE_phases)
+ *
+ * End the recording of a phase and store its record.
+ *
+ */
+void PMMG_trace_end( PMMG_pParMesh parmesh,int phase ) {
+  PMMG_Trace        *trace = &parmesh->trace;
+  PMMG_pTrace_event event;
+  MMG5_pMesh        mesh;
+  size_t            memCur;
+  double            tend;
+  int               k;
+
+  if ( parmesh->info.trace == PMMG_TRACE_none ) return;
+
+  assert ( 0 <= phase && phase < PMMG_TRACE_PHASES_size );
+
+  if ( !trace->open[phase] ) return;
+
+  tend   = MPI_Wtime() - trace->t0;
+  memCur = PMMG_trace_memCur(parmesh);
+  PMMG_trace_sample(parmesh,memCur);
+  trace->open[phase] = 0;
+
+  event = PMMG_trace_newEvent(parmesh);
+  if ( !event ) return;
+
+  event->tstart     = trace->tstart[phase];
+  event->tend       = tend;
+  event->memCur     = memCur;
+  event->memSampled = trace->memSampled[phase];
+  event->nbytes     = trace->nbytes - trace->nbytes0[phase];
+  event->phase      = phase;
+  event->iter       = ( parmesh->iter < parmesh->niter ) ? parmesh->iter : -1;
+  event->igrp       = -1;
+  event->ngrp       = parmesh->ngrp;
+  event->np         = 0;
+  event->ne         = 0;
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    mesh = parmesh->listgrp[k].mesh;
+    if ( !mesh ) continue;
+    event->np += mesh->np;
+    event->ne += mesh->ne;
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param phase traced phase (see \ref PMMG_TRACE_phases)
+ *
+ * Store the size of each group at the end of a phase.
+ *
+ */
+void PMMG_trace_grps( PMMG_pParMesh parmesh,int phase ) {
+  PMMG_Trace        *trace = &parmesh->trace;
+  PMMG_pTrace_event event;
+  MMG5_pMesh        mesh;
+  double            t;
+  int               k;
+
+  if ( parmesh->info.trace == PMMG_TRACE_none ) return;
+
+  assert ( 0 <= phase && phase < PMMG_TRACE_PHASES_size );
+
+  t = MPI_Wtime() - trace->t0;
+
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    mesh = parmesh->listgrp[k].mesh;
+    if ( !mesh ) continue;
+
+    event = PMMG_trace_newEvent(parmesh);
+    if ( !event ) return;
+
+    event->tstart     = t;
+    event->tend       = t;
+    event->memCur     = mesh->memCur;
+    event->memSampled = mesh->memCur;
+    event->nbytes     = 0;
+    event->phase      = phase;
+    event->iter       = ( parmesh->iter < parmesh->niter ) ? parmesh->iter : -1;
+    event->igrp       = k;
+    event->ngrp       = parmesh->ngrp;
+    event->np         = mesh->np;
+    event->ne         = mesh->ne;
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param nbytes number of bytes sent to other processes
+ *
+ * Count the data sent to other processes.
+ *
+ */
+void PMMG_trace_bytes( PMMG_pParMesh parmesh,size_t nbytes ) {
+
+  parmesh->trace.nbytes += nbytes;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param fmt trace format
+ *
+ * \return name of the trace file (to be freed by the caller), NULL if fail.
+ *
+ * Build the trace file name from the output mesh name (or the input one).
+ *
+ */
+static
+char* PMMG_trace_name( PMMG_pParMesh parmesh,int fmt ) {
+  const char *ext;
+  char       *name,*ptr;
+  const char *base;
+
+  ext  = ( fmt == PMMG_TRACE_chrome ) ? ".trace.json" : ".trace.jsonl";
+  base = parmesh->meshout ? parmesh->meshout :
+    ( parmesh->meshin ? parmesh->meshin : "parmmg" );
+
+  PMMG_MALLOC(parmesh,name,strlen(base)+strlen(ext)+1,char,"trace name",
+              return NULL);
+  strcpy(name,base);
+
+  ptr = MMG5_Get_filenameExt(name);
+  if ( ptr ) *ptr = '\0';
+  strcat(name,ext);
+
+  return name;
+}
+
+/**
+ * \param inm trace file
+ * \param rank rank of the process that has recorded the event
+ * \param event trace event
+ *
+ * Write a trace event as a JSON line.
+ *
+ */
+static
+void PMMG_trace_writeJsonl( FILE *inm,int rank,PMMG_pTrace_event event ) {
+
+  fprintf(inm,"{\"rank\":%d,\"iter\":%d,\"phase\":\"%s\",\"grp\":%d,"
+          "\"tstart\":%.6f,\"tend\":%.6f,\"wtime\":%.6f,\"ngrp\":%d,"
+          "\"np\":%d,\"ne\":%d,\"memCur\":%zu,\"memSampled\":%zu,\"nbytes\":%zu}\n",
+          rank,event->iter,PMMG_TRACE_names[event->phase],event->igrp,
+          event->tstart,event->tend,event->tend-event->tstart,event->ngrp,
+          event->np,event->ne,event->memCur,event->memSampled,event->nbytes);
+}
+
+/**
+ * \param inm trace file
+ * \param rank rank of the process that has recorded the event
+ * \param event trace event
+ *
+ * Write a trace event in the Chrome trace format: a complete event for a
+ * process record (followed by a memory counter), an instant event for a group
+ * record.
+ *
+ */
+static
+void PMMG_trace_writeChrome( FILE *inm,int rank,PMMG_pTrace_event event ) {
+
+  if ( event->igrp < 0 ) {
+    fprintf(inm,",\n{\"name\":\"%s\",\"cat\":\"parmmg\",\"ph\":\"X\","
+            "\"pid\":%d,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,"
+            "\"args\":{\"iter\":%d,\"ngrp\":%d,\"np\":%d,\"ne\":%d,"
+            "\"memCur\":%zu,\"memSampled\":%zu,\"nbytes\":%zu}}",
+            PMMG_TRACE_names[event->phase],rank,1.e6*event->tstart,
+            1.e6*(event->tend-event->tstart),event->iter,event->ngrp,
+            event->np,event->ne,event->memCur,event->memSampled,event->nbytes);
+    fprintf(inm,",\n{\"name\":\"memory\",\"ph\":\"C\",\"pid\":%d,\"ts\":%.3f,"
+            "\"args\":{\"memCur\":%zu}}",rank,1.e6*event->tend,event->memCur);
+  }
+  else {
+    fprintf(inm,",\n{\"name\":\"%s grp\",\"cat\":\"parmmg\",\"ph\":\"i\","
+            "\"s\":\"t\",\"pid\":%d,\"tid\":0,\"ts\":%.3f,"
+            "\"args\":{\"iter\":%d,\"grp\":%d,\"np\":%d,\"ne\":%d,"
+            "\"memCur\":%zu}}",
+            PMMG_TRACE_names[event->phase],rank,1.e6*event->tstart,
+            event->iter,event->igrp,event->np,event->ne,event->memCur);
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Gather the trace events of all the processes on the root process and write
+ * them in the trace file (collective if the trace is enabled). The events are
+ * released.
+ *
+ */
+int PMMG_trace_write( PMMG_pParMesh parmesh ) {
+  PMMG_Trace        *trace = &parmesh->trace;
+  PMMG_pTrace_event events;
+  FILE              *inm;
+  char              *name;
+  int               *rcounts,*displs,nbytes,ntot,rank,k,ier,root;
+
+  if ( parmesh->info.trace == PMMG_TRACE_none ) return 1;
+
+  ier     = 1;
+  root    = parmesh->info.root;
+  rcounts = displs = NULL;
+  events  = NULL;
+  nbytes  = trace->nevent * sizeof(PMMG_Trace_event);
+
+  if ( parmesh->myrank == root ) {
+    PMMG_MALLOC(parmesh,rcounts,parmesh->nprocs,int,"trace counts",ier = 0);
+    PMMG_MALLOC(parmesh,displs,parmesh->nprocs,int,"trace displs",ier = 0);
+  }
+
+  /* The receive buffers of the root are needed by all the processes: skip the
+   * gathers on all of them if an allocation fails */
+  MPI_Allreduce( MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  if ( ier ) {
+    MPI_CHECK( MPI_Gather(&nbytes,1,MPI_INT,rcounts,1,MPI_INT,root,parmesh->comm),
+               ier = 0 );
+  }
+
+  ntot = 0;
+  if ( parmesh->myrank == root && ier ) {
+    for ( k=0; k<parmesh->nprocs; ++k ) {
+      displs[k] = ntot;
+      ntot     += rcounts[k];
+    }
+    PMMG_MALLOC(parmesh,events,ntot/sizeof(PMMG_Trace_event),PMMG_Trace_event,
+                "gathered trace events",ier = 0; ntot = 0);
+  }
+
+  MPI_Allreduce( MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,parmesh->comm );
+
+  if ( ier ) {
+    MPI_CHECK( MPI_Gatherv(trace->event,nbytes,MPI_BYTE,events,rcounts,displs,
+                           MPI_BYTE,root,parmesh->comm), ier = 0 );
+  }
+
+  PMMG_trace_free(parmesh);
+
+  if ( parmesh->myrank == root && ier ) {
+    name = PMMG_trace_name(parmesh,parmesh->info.trace);
+
+    if ( !(name && (inm = fopen(name,"w"))) ) {
+      fprintf(stderr,"  ** UNABLE TO OPEN THE TRACE FILE %s.\n",name ? name : "");
+      ier = 0;
+    }
+    else {
+      if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+        fprintf(stdout,"  %%%% %s OPENED\n",name);
+      }
+
+      if ( parmesh->info.trace == PMMG_TRACE_chrome ) {
+        fprintf(inm,"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        fprintf(inm,"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,"
+                "\"args\":{\"name\":\"rank 0\"}}");
+        for ( rank=1; rank<parmesh->nprocs; ++rank ) {
+          fprintf(inm,",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                  "\"args\":{\"name\":\"rank %d\"}}",rank,rank);
+        }
+      }
+
+      for ( rank=0; rank<parmesh->nprocs; ++rank ) {
+        for ( k=displs[rank]/(int)sizeof(PMMG_Trace_event);
+              k<(displs[rank]+rcounts[rank])/(int)sizeof(PMMG_Trace_event); ++k ) {
+          if ( parmesh->info.trace == PMMG_TRACE_chrome ) {
+            PMMG_trace_writeChrome(inm,rank,&events[k]);
+          }
+          else {
+            PMMG_trace_writeJsonl(inm,rank,&events[k]);
+          }
+        }
+      }
+
+      if ( parmesh->info.trace == PMMG_TRACE_chrome ) {
+        fprintf(inm,"\n]}\n");
+      }
+      fclose(inm);
+
+      if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+        fprintf(stdout,"     %d trace events of %d processes written\n",
+                ntot/(int)sizeof(PMMG_Trace_event),parmesh->nprocs);
+      }
+    }
+    if ( name ) {
+      PMMG_DEL_MEM(parmesh,name,char,"trace name");
+    }
+  }
+
+  PMMG_DEL_MEM(parmesh,events,PMMG_Trace_event,"gathered trace events");
+  PMMG_DEL_MEM(parmesh,displs,int,"trace displs");
+  PMMG_DEL_MEM(parmesh,rcounts,int,"trace counts");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * Free the trace events.
+ *
+ */
+void PMMG_trace_free( PMMG_pParMesh parmesh ) {
+  PMMG_Trace *trace = &parmesh->trace;
+
+  PMMG_DEL_MEM(parmesh,trace->event,PMMG_Trace_event,"trace events");
+  trace->nevent     = 0;
+  trace->nevent_max = 0;
+}
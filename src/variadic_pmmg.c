@@ -295,6 +295,8 @@ int PMMG_Free_all_var(va_list argptr)
 
   PMMG_parmesh_Free_Listgrp( *parmesh );
 
+  PMMG_trace_free( *parmesh );
+
   (*parmesh)->memCur -= sizeof(PMMG_ParMesh);
 
   if ( (*parmesh)->info.imprim>5 || (*parmesh)->ddebug ) {